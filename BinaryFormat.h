@@ -0,0 +1,124 @@
+#ifndef BINARYFORMAT_H
+#define BINARYFORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+
+/*
+    ========================================================================
+                            HEADER : BinaryFormat
+    ========================================================================
+
+    Objective:
+        Section layout helpers shared by the binary files the checker
+        writes and maps back (corpus index, result cache, binary
+        report). Each file is a fixed header followed by sections
+        placed back to back at 8-byte boundaries, so mapped sections
+        can be read in place as arrays.
+
+    Input:
+        - Byte offsets and sizes, raw section data to write, or offset
+          tables read from a mapped file.
+
+    Output:
+        - Aligned offsets, padded sections and validity checks.
+
+    Side Effects:
+        - writeSection() writes to the given stream; the rest is pure.
+*/
+
+// Read back as a different value on a host with the other byte order
+constexpr uint32_t binaryByteOrderMark = 0x01020304;
+
+/*
+    Objective:
+        Round a byte offset up to the section alignment.
+
+    Input:
+        offset → byte offset.
+
+    Output:
+        Smallest multiple of 8 >= offset.
+
+    Side Effects:
+        None.
+*/
+inline uint64_t alignUp(uint64_t offset) {
+    return (offset + 7) & ~static_cast<uint64_t>(7);
+}
+
+/*
+    Objective:
+        Append one section to a file being written.
+
+    Input:
+        out   → destination stream.
+        data  → section bytes.
+        bytes → section size.
+
+    Output:
+        None.
+
+    Side Effects:
+        Writes the bytes, then zero padding up to the section alignment.
+*/
+inline void writeSection(std::ofstream& out, const void* data, size_t bytes) {
+    static const char padding[8] = {};
+
+    if (bytes > 0) {
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    }
+
+    out.write(padding, static_cast<std::streamsize>(alignUp(bytes) - bytes));
+}
+
+/*
+    Objective:
+        Check a section's bounds against the file size.
+
+    Input:
+        at       → section offset from the header.
+        bytes    → section size.
+        fileSize → size of the mapped file.
+
+    Output:
+        true if [at, at + bytes) is aligned and lies inside the file.
+
+    Side Effects:
+        None.
+*/
+inline bool sectionFits(uint64_t at, uint64_t bytes, uint64_t fileSize) {
+    return at % 8 == 0 && at <= fileSize && bytes <= fileSize - at;
+}
+
+/*
+    Objective:
+        Check an offset table read from a file.
+
+    Input:
+        offsets → count + 1 offsets.
+        count   → number of ranges.
+        limit   → size of the array the offsets index.
+
+    Output:
+        true if the offsets start at 0, never decrease and end at limit.
+
+    Side Effects:
+        None.
+*/
+inline bool offsetsValid(const uint64_t* offsets, size_t count, uint64_t limit) {
+    if (offsets[0] != 0 || offsets[count] != limit) {
+        return false;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (offsets[i] > offsets[i + 1]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#endif // BINARYFORMAT_H
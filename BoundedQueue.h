@@ -0,0 +1,145 @@
+#ifndef BOUNDEDQUEUE_H
+#define BOUNDEDQUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+/*
+    ========================================================================
+                        CLASS TEMPLATE : BoundedQueue
+    ========================================================================
+
+    Objective:
+        A blocking FIFO queue with a fixed capacity, used to connect
+        producer and consumer threads in a pipeline:
+            - push() waits while the queue is full (back-pressure)
+            - pop() waits while the queue is empty
+            - close() wakes everyone; pop() then drains what is left
+              and reports the end of the stream
+
+    Input:
+        - capacity : maximum number of queued items.
+
+    Output:
+        - Items in the order they were pushed.
+
+    Side Effects:
+        - Blocks calling threads while waiting.
+
+    Notes:
+        Defined in the header because it is a template.
+*/
+
+template <typename T>
+class BoundedQueue {
+private:
+
+    // Queued items
+    std::deque<T> items;
+
+    // Maximum number of queued items
+    size_t capacity;
+
+    // Set by close(); no more pushes are accepted afterwards
+    bool closed = false;
+
+    std::mutex lock;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+
+public:
+
+    /*
+        Objective:
+            Create an empty queue.
+
+        Input:
+            maxItems → capacity (raised to 1 if 0).
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    explicit BoundedQueue(size_t maxItems) : capacity(maxItems ? maxItems : 1) {
+    }
+
+    /*
+        Objective:
+            Append an item, waiting for room if the queue is full.
+
+        Input:
+            item → value to enqueue (moved).
+
+        Output:
+            false if the queue was closed and the item was dropped.
+
+        Side Effects:
+            Wakes one waiting consumer.
+    */
+    bool push(T item) {
+        std::unique_lock<std::mutex> guard(lock);
+        notFull.wait(guard, [this] { return closed || items.size() < capacity; });
+
+        if (closed) {
+            return false;
+        }
+
+        items.push_back(std::move(item));
+        notEmpty.notify_one();
+        return true;
+    }
+
+    /*
+        Objective:
+            Remove the oldest item, waiting if the queue is empty.
+
+        Input:
+            item → receives the dequeued value.
+
+        Output:
+            false once the queue is closed and empty.
+
+        Side Effects:
+            Wakes one waiting producer.
+    */
+    bool pop(T& item) {
+        std::unique_lock<std::mutex> guard(lock);
+        notEmpty.wait(guard, [this] { return closed || !items.empty(); });
+
+        if (items.empty()) {
+            return false;
+        }
+
+        item = std::move(items.front());
+        items.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    /*
+        Objective:
+            Mark the end of the stream.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Wakes all waiting producers and consumers.
+    */
+    void close() {
+        std::lock_guard<std::mutex> guard(lock);
+        closed = true;
+        notFull.notify_all();
+        notEmpty.notify_all();
+    }
+};
+
+#endif // BOUNDEDQUEUE_H
@@ -0,0 +1,53 @@
+#ifndef CANDIDATEGENERATOR_H
+#define CANDIDATEGENERATOR_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/*
+    ========================================================================
+                       CLASS : CandidateGenerator
+    ========================================================================
+
+    Objective:
+        Interface for pipeline stages that run between FeatureExtractor
+        and SimilarityChecker and propose which document pairs are worth
+        scoring. Implementations trade recall for speed by avoiding the
+        quadratic all-pairs comparison.
+
+    Input:
+        - Tokenized documents (TermDictionary IDs), indexed by document.
+
+    Output:
+        - Candidate pairs (doc1, doc2) with doc1 < doc2, sorted and
+          without duplicates.
+
+    Side Effects:
+        - Defined by each implementation; none are expected to modify
+          their inputs.
+*/
+
+class CandidateGenerator {
+public:
+
+    virtual ~CandidateGenerator() = default;
+
+    /*
+        Objective:
+            Propose document pairs for exact scoring.
+
+        Input:
+            documents → tokenized documents (term IDs).
+
+        Output:
+            Sorted, unique (doc1, doc2) pairs with doc1 < doc2.
+
+        Side Effects:
+            None.
+    */
+    virtual std::vector<std::pair<int, int>>
+    generateCandidates(const std::vector<std::vector<uint32_t>>& documents) const = 0;
+};
+
+#endif // CANDIDATEGENERATOR_H
@@ -0,0 +1,563 @@
+#include "CorpusIndex.h"
+#include "BinaryFormat.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace {
+
+// Marks an index file; the trailing bytes keep the header 8-byte aligned
+const char indexMagic[8] = {'P', 'L', 'A', 'G', 'I', 'D', 'X', '\0'};
+
+// Fixed-size file header; every offset is in bytes from the file start
+struct IndexHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t documentCount;
+    uint64_t termCount;
+    uint64_t entryCount;
+    uint64_t termOffsetsAt;
+    uint64_t termCharsAt;
+    uint64_t dfAt;
+    uint64_t nameOffsetsAt;
+    uint64_t nameCharsAt;
+    uint64_t lengthsAt;
+    uint64_t docOffsetsAt;
+    uint64_t entriesAt;
+    uint64_t normsAt;
+    uint64_t fileSize;
+};
+
+} // namespace
+
+/*
+-------------------------------------------------
+Function Name : write()
+
+Objective:
+    Save a processed corpus as an index file.
+
+Input:
+    path         → Destination file.
+    dictionary   → Term dictionary.
+    names        → Document names.
+    index        → Corpus inverted index.
+    tfidfVectors → TF-IDF vectors of the corpus.
+
+Output:
+    true on success.
+
+Side Effect:
+    Writes path + ".tmp", then renames it to path.
+
+Approach:
+    Flatten dictionary, names and per-document counts into offset
+    and value arrays, lay the sections out back to back at 8-byte
+    boundaries, and write header and sections in one sequential pass.
+
+    // call InvertedIndex::getDocumentCounts()
+*/
+bool CorpusIndex::write(const std::string& path,
+                        const TermDictionary& dictionary,
+                        const std::vector<std::string>& names,
+                        const InvertedIndex& index,
+                        const std::vector<SparseVector>& tfidfVectors) {
+
+    size_t docs = static_cast<size_t>(index.documentCount());
+    size_t termTotal = dictionary.size();
+
+    // Terms and document frequencies
+    std::vector<uint64_t> termOffsetTable(termTotal + 1, 0);
+    std::vector<uint32_t> dfTable(termTotal, 0);
+    std::string termBytes;
+
+    for (size_t termId = 0; termId < termTotal; termId++) {
+        termBytes += dictionary.getTerm(static_cast<uint32_t>(termId));
+        termOffsetTable[termId + 1] = termBytes.size();
+        dfTable[termId] = static_cast<uint32_t>(index.documentFrequency(static_cast<uint32_t>(termId)));
+    }
+
+    // Document names and lengths
+    std::vector<uint64_t> nameOffsetTable(docs + 1, 0);
+    std::vector<uint32_t> lengthTable(docs, 0);
+    std::string nameBytes;
+
+    for (size_t d = 0; d < docs; d++) {
+        if (d < names.size()) {
+            nameBytes += names[d];
+        }
+        nameOffsetTable[d + 1] = nameBytes.size();
+        lengthTable[d] = static_cast<uint32_t>(index.documentLength(static_cast<int>(d)));
+    }
+
+    // Per-document term counts and TF-IDF norms
+    // call InvertedIndex::getDocumentCounts()
+    std::vector<std::vector<TermCount>> counts = index.getDocumentCounts();
+    std::vector<uint64_t> docOffsetTable(docs + 1, 0);
+    std::vector<TermCount> entryTable;
+    std::vector<double> normTable(docs, 0.0);
+
+    for (size_t d = 0; d < docs; d++) {
+        entryTable.insert(entryTable.end(), counts[d].begin(), counts[d].end());
+        docOffsetTable[d + 1] = entryTable.size();
+
+        if (d < tfidfVectors.size()) {
+            double sum = 0.0;
+            for (const auto& entry : tfidfVectors[d]) {
+                sum += entry.weight * entry.weight;
+            }
+            normTable[d] = std::sqrt(sum);
+        }
+    }
+
+    // Section layout
+    IndexHeader header = {};
+    std::memcpy(header.magic, indexMagic, sizeof(indexMagic));
+    header.version = formatVersion;
+    header.byteOrder = binaryByteOrderMark;
+    header.documentCount = docs;
+    header.termCount = termTotal;
+    header.entryCount = entryTable.size();
+
+    uint64_t at = alignUp(sizeof(IndexHeader));
+    header.termOffsetsAt = at;  at += alignUp(termOffsetTable.size() * sizeof(uint64_t));
+    header.termCharsAt = at;    at += alignUp(termBytes.size());
+    header.dfAt = at;           at += alignUp(dfTable.size() * sizeof(uint32_t));
+    header.nameOffsetsAt = at;  at += alignUp(nameOffsetTable.size() * sizeof(uint64_t));
+    header.nameCharsAt = at;    at += alignUp(nameBytes.size());
+    header.lengthsAt = at;      at += alignUp(lengthTable.size() * sizeof(uint32_t));
+    header.docOffsetsAt = at;   at += alignUp(docOffsetTable.size() * sizeof(uint64_t));
+    header.entriesAt = at;      at += alignUp(entryTable.size() * sizeof(TermCount));
+    header.normsAt = at;        at += alignUp(normTable.size() * sizeof(double));
+    header.fileSize = at;
+
+    std::string tempPath = path + ".tmp";
+    std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+
+    if (!out.is_open()) {
+        return false;
+    }
+
+    writeSection(out, &header, sizeof(header));
+    writeSection(out, termOffsetTable.data(), termOffsetTable.size() * sizeof(uint64_t));
+    writeSection(out, termBytes.data(), termBytes.size());
+    writeSection(out, dfTable.data(), dfTable.size() * sizeof(uint32_t));
+    writeSection(out, nameOffsetTable.data(), nameOffsetTable.size() * sizeof(uint64_t));
+    writeSection(out, nameBytes.data(), nameBytes.size());
+    writeSection(out, lengthTable.data(), lengthTable.size() * sizeof(uint32_t));
+    writeSection(out, docOffsetTable.data(), docOffsetTable.size() * sizeof(uint64_t));
+    writeSection(out, entryTable.data(), entryTable.size() * sizeof(TermCount));
+    writeSection(out, normTable.data(), normTable.size() * sizeof(double));
+
+    out.close();
+
+    if (!out) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    // rename() replaces the old file atomically on POSIX, so readers
+    // always find one; on Windows it fails if the target exists
+#ifdef _WIN32
+    std::remove(path.c_str());
+#endif
+    return std::rename(tempPath.c_str(), path.c_str()) == 0;
+}
+
+/*
+-------------------------------------------------
+Function Name : load()
+
+Objective:
+    Open and validate an index file.
+
+Input:
+    path → Index file.
+
+Output:
+    true if the index is usable.
+
+Side Effect:
+    Maps the file; sets section views.
+
+Approach:
+    Validate the header and section bounds, point the views into
+    the mapping, then check offset tables and term IDs (in range
+    and strictly increasing within each document) so that no
+    accessor can read outside the file and every loaded document
+    is sorted as the in-memory index expects.
+
+    // call MappedFile::open()
+*/
+bool CorpusIndex::load(const std::string& path) {
+
+    reset();
+
+    // call MappedFile::open()
+    if (!file.open(path)) {
+        return false;
+    }
+
+    std::string_view bytes = file.view();
+
+    if (bytes.size() < sizeof(IndexHeader)) {
+        reset();
+        return false;
+    }
+
+    IndexHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, indexMagic, sizeof(indexMagic)) != 0 ||
+        header.version != formatVersion ||
+        header.byteOrder != binaryByteOrderMark ||
+        header.fileSize != bytes.size()) {
+        reset();
+        return false;
+    }
+
+    uint64_t size = header.fileSize;
+    uint64_t docs = header.documentCount;
+    uint64_t termTotal = header.termCount;
+
+    // Reject counts large enough to overflow the size arithmetic below
+    if (docs >= size || termTotal >= size || header.entryCount >= size) {
+        reset();
+        return false;
+    }
+
+    bool fits =
+        sectionFits(header.termOffsetsAt, (termTotal + 1) * sizeof(uint64_t), size) &&
+        sectionFits(header.dfAt, termTotal * sizeof(uint32_t), size) &&
+        sectionFits(header.nameOffsetsAt, (docs + 1) * sizeof(uint64_t), size) &&
+        sectionFits(header.lengthsAt, docs * sizeof(uint32_t), size) &&
+        sectionFits(header.docOffsetsAt, (docs + 1) * sizeof(uint64_t), size) &&
+        sectionFits(header.entriesAt, header.entryCount * sizeof(TermCount), size) &&
+        sectionFits(header.normsAt, docs * sizeof(double), size) &&
+        sectionFits(header.termCharsAt, 0, size) &&
+        sectionFits(header.nameCharsAt, 0, size);
+
+    if (!fits) {
+        reset();
+        return false;
+    }
+
+    // Mappings are page-aligned and buffers come from the heap, so
+    // 8-byte aligned offsets give aligned section pointers
+    const char* base = bytes.data();
+    termOffsets = reinterpret_cast<const uint64_t*>(base + header.termOffsetsAt);
+    termChars = base + header.termCharsAt;
+    documentFrequencies = reinterpret_cast<const uint32_t*>(base + header.dfAt);
+    nameOffsets = reinterpret_cast<const uint64_t*>(base + header.nameOffsetsAt);
+    nameChars = base + header.nameCharsAt;
+    lengths = reinterpret_cast<const uint32_t*>(base + header.lengthsAt);
+    docOffsets = reinterpret_cast<const uint64_t*>(base + header.docOffsetsAt);
+    entries = reinterpret_cast<const TermCount*>(base + header.entriesAt);
+    norms = reinterpret_cast<const double*>(base + header.normsAt);
+
+    terms = static_cast<size_t>(termTotal);
+    docCount = static_cast<size_t>(docs);
+
+    bool consistent =
+        offsetsValid(termOffsets, terms, termOffsets[terms]) &&
+        sectionFits(header.termCharsAt, termOffsets[terms], size) &&
+        offsetsValid(nameOffsets, docCount, nameOffsets[docCount]) &&
+        sectionFits(header.nameCharsAt, nameOffsets[docCount], size) &&
+        offsetsValid(docOffsets, docCount, header.entryCount);
+
+    // Every document's entries hold valid, strictly increasing term IDs
+    for (size_t d = 0; consistent && d < docCount; d++) {
+        for (uint64_t e = docOffsets[d]; consistent && e < docOffsets[d + 1]; e++) {
+            consistent = entries[e].termId < terms &&
+                         (e == docOffsets[d] || entries[e - 1].termId < entries[e].termId);
+        }
+    }
+
+    if (!consistent) {
+        reset();
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-------------------------------------------------
+Function Name : reset()
+
+Objective:
+    Return to the empty state.
+
+Input:
+    None.
+
+Output:
+    None.
+
+Side Effect:
+    Releases the file and clears views.
+
+Approach:
+    Replace the mapping with an empty one and null every pointer.
+*/
+void CorpusIndex::reset() {
+    file = MappedFile();
+    docCount = 0;
+    terms = 0;
+    termOffsets = nullptr;
+    termChars = nullptr;
+    documentFrequencies = nullptr;
+    nameOffsets = nullptr;
+    nameChars = nullptr;
+    lengths = nullptr;
+    docOffsets = nullptr;
+    entries = nullptr;
+    norms = nullptr;
+}
+
+/*
+-------------------------------------------------
+Function Name : documentCount()
+
+Objective:
+    Retrieve number of stored documents.
+
+Input:
+    None.
+
+Output:
+    Document count.
+
+Side Effect:
+    None.
+
+Approach:
+    Return count read from the header.
+*/
+size_t CorpusIndex::documentCount() const {
+    return docCount;
+}
+
+/*
+-------------------------------------------------
+Function Name : termCount()
+
+Objective:
+    Retrieve number of stored terms.
+
+Input:
+    None.
+
+Output:
+    Term count.
+
+Side Effect:
+    None.
+
+Approach:
+    Return count read from the header.
+*/
+size_t CorpusIndex::termCount() const {
+    return terms;
+}
+
+/*
+-------------------------------------------------
+Function Name : loadDictionary()
+
+Objective:
+    Recreate the stored term dictionary.
+
+Input:
+    dictionary → Empty dictionary to fill.
+
+Output:
+    false if the dictionary already held terms.
+
+Side Effect:
+    Interns all stored terms.
+
+Approach:
+    Intern terms in ID order; an empty dictionary assigns IDs in
+    the same order, so stored IDs map to themselves.
+
+    // call TermDictionary::intern()
+*/
+bool CorpusIndex::loadDictionary(TermDictionary& dictionary) const {
+    if (dictionary.size() != 0) {
+        return false;
+    }
+
+    for (size_t termId = 0; termId < terms; termId++) {
+        // call TermDictionary::intern()
+        dictionary.intern(getTerm(static_cast<uint32_t>(termId)));
+    }
+
+    return true;
+}
+
+/*
+-------------------------------------------------
+Function Name : getTerm()
+
+Objective:
+    Retrieve a stored term.
+
+Input:
+    termId → Term ID.
+
+Output:
+    View of the term bytes (empty if out of range).
+
+Side Effect:
+    None.
+
+Approach:
+    Slice the term bytes between consecutive offsets.
+*/
+std::string_view CorpusIndex::getTerm(uint32_t termId) const {
+    if (termId >= terms) {
+        return {};
+    }
+
+    return std::string_view(termChars + termOffsets[termId],
+                            static_cast<size_t>(termOffsets[termId + 1] - termOffsets[termId]));
+}
+
+/*
+-------------------------------------------------
+Function Name : documentFrequency()
+
+Objective:
+    Retrieve stored DF of a term.
+
+Input:
+    termId → Term ID.
+
+Output:
+    Number of stored documents containing the term.
+
+Side Effect:
+    None.
+
+Approach:
+    Check bounds and read the DF table.
+*/
+int CorpusIndex::documentFrequency(uint32_t termId) const {
+    if (termId >= terms) {
+        return 0;
+    }
+
+    return static_cast<int>(documentFrequencies[termId]);
+}
+
+/*
+-------------------------------------------------
+Function Name : documentName()
+
+Objective:
+    Retrieve a stored document name.
+
+Input:
+    docId → Document index.
+
+Output:
+    View of the name (empty if out of range).
+
+Side Effect:
+    None.
+
+Approach:
+    Slice the name bytes between consecutive offsets.
+*/
+std::string_view CorpusIndex::documentName(size_t docId) const {
+    if (docId >= docCount) {
+        return {};
+    }
+
+    return std::string_view(nameChars + nameOffsets[docId],
+                            static_cast<size_t>(nameOffsets[docId + 1] - nameOffsets[docId]));
+}
+
+/*
+-------------------------------------------------
+Function Name : documentLength()
+
+Objective:
+    Retrieve stored token count of a document.
+
+Input:
+    docId → Document index.
+
+Output:
+    Token count (0 if out of range).
+
+Side Effect:
+    None.
+
+Approach:
+    Check bounds and read the length table.
+*/
+int CorpusIndex::documentLength(size_t docId) const {
+    if (docId >= docCount) {
+        return 0;
+    }
+
+    return static_cast<int>(lengths[docId]);
+}
+
+/*
+-------------------------------------------------
+Function Name : documentCounts()
+
+Objective:
+    Retrieve the term counts of a document.
+
+Input:
+    docId → Document index.
+
+Output:
+    Sorted (termId, count) entries (empty if out of range).
+
+Side Effect:
+    None.
+
+Approach:
+    Copy the document's slice of the entry table.
+*/
+std::vector<TermCount> CorpusIndex::documentCounts(size_t docId) const {
+    if (docId >= docCount) {
+        return {};
+    }
+
+    return std::vector<TermCount>(entries + docOffsets[docId], entries + docOffsets[docId + 1]);
+}
+
+/*
+-------------------------------------------------
+Function Name : norm()
+
+Objective:
+    Retrieve stored TF-IDF norm of a document.
+
+Input:
+    docId → Document index.
+
+Output:
+    L2 norm at write time (0 if out of range).
+
+Side Effect:
+    None.
+
+Approach:
+    Check bounds and read the norm table.
+*/
+double CorpusIndex::norm(size_t docId) const {
+    if (docId >= docCount) {
+        return 0.0;
+    }
+
+    return norms[docId];
+}
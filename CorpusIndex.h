@@ -0,0 +1,220 @@
+#ifndef CORPUSINDEX_H
+#define CORPUSINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "MappedFile.h"
+#include "InvertedIndex.h"
+#include "SparseVector.h"
+#include "TermDictionary.h"
+
+/*
+    ========================================================================
+                            CLASS : CorpusIndex
+    ========================================================================
+
+    Objective:
+        The CorpusIndex class stores a preprocessed corpus on disk so that
+        past submissions do not have to be read, cleaned and counted again
+        on every run:
+            - write() saves the term dictionary, document names, per-document
+              sparse term counts (TF), the DF table and TF-IDF norms
+            - load() maps the file and exposes every table in place, without
+              parsing or copying it
+
+    Input:
+        - For write(): the dictionary, names, inverted index and TF-IDF
+          vectors of a processed corpus.
+        - For load(): the path of a file produced by write().
+
+    Output:
+        - Read-only views of the stored tables.
+
+    Side Effects:
+        - write() creates or replaces a file on disk.
+        - load() keeps the file mapped until the object is destroyed.
+
+    File Format (version 1, native byte order, every section 8-byte aligned):
+        header        magic "PLAGIDX", version, byte-order mark, counts
+                      and the byte offset of every section below
+        termOffsets   uint64[terms + 1]   term i = termChars[off[i], off[i+1])
+        termChars     concatenated term bytes
+        df            uint32[terms]       document frequency per term
+        nameOffsets   uint64[docs + 1]    same layout as termOffsets
+        nameChars     concatenated document names
+        lengths       uint32[docs]        token count per document
+        docOffsets    uint64[docs + 1]    document d = entries[off[d], off[d+1])
+        entries       TermCount[nnz]      (termId, count), sorted per document
+        norms         double[docs]        L2 norm of each TF-IDF vector
+
+    Notes:
+        - Term IDs in the file are the dictionary IDs at write time, so
+          loadDictionary() into an empty dictionary reproduces them exactly.
+        - Documents are identified by name; a renamed file is a new document.
+        - Norms use the IDF of the corpus that was written; once documents
+          are added they have to be recomputed from the counts.
+*/
+
+class CorpusIndex {
+private:
+
+    // Backing file (mapped, or buffered when small)
+    MappedFile file;
+
+    // Table sizes
+    size_t docCount = 0;
+    size_t terms = 0;
+
+    // Section views into 'file'
+    const uint64_t* termOffsets = nullptr;
+    const char* termChars = nullptr;
+    const uint32_t* documentFrequencies = nullptr;
+    const uint64_t* nameOffsets = nullptr;
+    const char* nameChars = nullptr;
+    const uint32_t* lengths = nullptr;
+    const uint64_t* docOffsets = nullptr;
+    const TermCount* entries = nullptr;
+    const double* norms = nullptr;
+
+    /*
+        Objective:
+            Forget any loaded file.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Unmaps the file and clears every view.
+    */
+    void reset();
+
+public:
+
+    // Format version written by write() and accepted by load()
+    static constexpr uint32_t formatVersion = 1;
+
+    CorpusIndex() = default;
+
+    // Views point into the owned mapping, so the object stays in place
+    CorpusIndex(const CorpusIndex&) = delete;
+    CorpusIndex& operator=(const CorpusIndex&) = delete;
+
+    /*
+        Objective:
+            Save a processed corpus.
+
+        Input:
+            path         → destination file.
+            dictionary   → dictionary the term IDs refer to.
+            names        → document names, indexed by document.
+            index        → inverted index of the corpus.
+            tfidfVectors → TF-IDF vectors used for the stored norms.
+
+        Output:
+            true if the file was written completely.
+
+        Side Effects:
+            Writes 'path' + ".tmp" and renames it over 'path', so a
+            reader never sees a half-written index.
+    */
+    static bool write(const std::string& path,
+                      const TermDictionary& dictionary,
+                      const std::vector<std::string>& names,
+                      const InvertedIndex& index,
+                      const std::vector<SparseVector>& tfidfVectors);
+
+    /*
+        Objective:
+            Open an index file.
+
+        Input:
+            path → file produced by write().
+
+        Output:
+            true if the file is a valid index of this version.
+
+        Side Effects:
+            Maps the file. On failure the object is left empty.
+
+        Approach:
+            Check magic, version, byte order and that every section lies
+            inside the file, then point the views at the sections.
+    */
+    bool load(const std::string& path);
+
+    /*
+        Objective:
+            Report the number of stored documents / terms.
+
+        Input:
+            None.
+
+        Output:
+            Count (0 when nothing is loaded).
+
+        Side Effects:
+            None.
+    */
+    size_t documentCount() const;
+    size_t termCount() const;
+
+    /*
+        Objective:
+            Intern all stored terms into a dictionary.
+
+        Input:
+            dictionary → dictionary to fill; must be empty for the stored
+                         term IDs to stay valid.
+
+        Output:
+            false if the dictionary was not empty (nothing is added).
+
+        Side Effects:
+            Adds termCount() terms in ID order.
+    */
+    bool loadDictionary(TermDictionary& dictionary) const;
+
+    /*
+        Objective:
+            Access stored terms and their document frequencies.
+
+        Input:
+            termId → ID below termCount().
+
+        Output:
+            Term bytes / number of documents containing the term.
+
+        Side Effects:
+            None.
+    */
+    std::string_view getTerm(uint32_t termId) const;
+    int documentFrequency(uint32_t termId) const;
+
+    /*
+        Objective:
+            Access one stored document.
+
+        Input:
+            docId → index below documentCount().
+
+        Output:
+            Name, token count, sorted (termId, count) entries, and L2
+            norm of the stored TF-IDF vector.
+
+        Side Effects:
+            None.
+    */
+    std::string_view documentName(size_t docId) const;
+    int documentLength(size_t docId) const;
+    std::vector<TermCount> documentCounts(size_t docId) const;
+    double norm(size_t docId) const;
+};
+
+#endif // CORPUSINDEX_H
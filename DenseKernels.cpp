@@ -0,0 +1,302 @@
+#include "DenseKernels.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define DENSE_KERNELS_X86 1
+    #include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    #define DENSE_KERNELS_NEON 1
+    #include <arm_neon.h>
+#endif
+
+namespace {
+
+using DotFunction = float (*)(const float*, const float*, size_t);
+
+/*
+-------------------------------------------------
+Function Name : dotScalar()
+
+Objective:
+    Portable fallback dot product.
+
+Input:
+    a, b   → Input arrays.
+    length → Number of elements.
+
+Output:
+    Dot product.
+
+Side Effect:
+    None.
+
+Approach:
+    Four independent accumulators so the compiler can pipeline
+    (and auto-vectorize) the loop.
+*/
+float dotScalar(const float* a, const float* b, size_t length) {
+    float sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+    size_t i = 0;
+
+    for (; i + 4 <= length; i += 4) {
+        sum0 += a[i] * b[i];
+        sum1 += a[i + 1] * b[i + 1];
+        sum2 += a[i + 2] * b[i + 2];
+        sum3 += a[i + 3] * b[i + 3];
+    }
+
+    for (; i < length; i++) {
+        sum0 += a[i] * b[i];
+    }
+
+    return (sum0 + sum1) + (sum2 + sum3);
+}
+
+#ifdef DENSE_KERNELS_X86
+
+/*
+-------------------------------------------------
+Function Name : dotAVX2()
+
+Objective:
+    Dot product with 256-bit AVX2 fused multiply-add.
+
+Input:
+    a, b   → Input arrays.
+    length → Number of elements.
+
+Output:
+    Dot product.
+
+Side Effect:
+    None.
+
+Approach:
+    Two 8-float accumulators hide FMA latency; a horizontal add
+    and scalar tail finish the sum.
+*/
+__attribute__((target("avx2,fma")))
+float dotAVX2(const float* a, const float* b, size_t length) {
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    size_t i = 0;
+
+    for (; i + 16 <= length; i += 16) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8), acc1);
+    }
+
+    for (; i + 8 <= length; i += 8) {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc0);
+    }
+
+    __m256 acc = _mm256_add_ps(acc0, acc1);
+    __m128 half = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+    half = _mm_add_ss(half, _mm_shuffle_ps(half, half, 0x55));
+
+    float sum = _mm_cvtss_f32(half);
+
+    for (; i < length; i++) {
+        sum += a[i] * b[i];
+    }
+
+    return sum;
+}
+
+/*
+-------------------------------------------------
+Function Name : dotAVX512()
+
+Objective:
+    Dot product with 512-bit AVX-512F fused multiply-add.
+
+Input:
+    a, b   → Input arrays.
+    length → Number of elements.
+
+Output:
+    Dot product.
+
+Side Effect:
+    None.
+
+Approach:
+    Two 16-float accumulators, one horizontal reduction, scalar
+    tail.
+*/
+__attribute__((target("avx512f")))
+float dotAVX512(const float* a, const float* b, size_t length) {
+    __m512 acc0 = _mm512_setzero_ps();
+    __m512 acc1 = _mm512_setzero_ps();
+    size_t i = 0;
+
+    for (; i + 32 <= length; i += 32) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc0);
+        acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i + 16), _mm512_loadu_ps(b + i + 16), acc1);
+    }
+
+    for (; i + 16 <= length; i += 16) {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i), acc0);
+    }
+
+    // Reduce through memory; GCC's _mm512_reduce_add_ps trips -Wuninitialized
+    alignas(64) float lanes[16];
+    _mm512_store_ps(lanes, _mm512_add_ps(acc0, acc1));
+
+    float sum = 0.0f;
+    for (float lane : lanes) {
+        sum += lane;
+    }
+
+    for (; i < length; i++) {
+        sum += a[i] * b[i];
+    }
+
+    return sum;
+}
+
+#endif // DENSE_KERNELS_X86
+
+#ifdef DENSE_KERNELS_NEON
+
+/*
+-------------------------------------------------
+Function Name : dotNEON()
+
+Objective:
+    Dot product with 128-bit NEON fused multiply-add.
+
+Input:
+    a, b   → Input arrays.
+    length → Number of elements.
+
+Output:
+    Dot product.
+
+Side Effect:
+    None.
+
+Approach:
+    Two 4-float accumulators, horizontal add, scalar tail.
+*/
+float dotNEON(const float* a, const float* b, size_t length) {
+    float32x4_t acc0 = vdupq_n_f32(0.0f);
+    float32x4_t acc1 = vdupq_n_f32(0.0f);
+    size_t i = 0;
+
+    for (; i + 8 <= length; i += 8) {
+        acc0 = vfmaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+        acc1 = vfmaq_f32(acc1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+    }
+
+    float sum = vaddvq_f32(vaddq_f32(acc0, acc1));
+
+    for (; i < length; i++) {
+        sum += a[i] * b[i];
+    }
+
+    return sum;
+}
+
+#endif // DENSE_KERNELS_NEON
+
+// Selected kernel and its name
+struct Kernel {
+    DotFunction function;
+    const char* name;
+};
+
+/*
+-------------------------------------------------
+Function Name : selectKernel()
+
+Objective:
+    Pick the fastest kernel the CPU supports.
+
+Input:
+    None.
+
+Output:
+    Reference to the selected kernel.
+
+Side Effect:
+    Queries CPU features once (thread-safe static init).
+
+Approach:
+    Prefer AVX-512F, then AVX2 + FMA on x86; NEON is part of the
+    AArch64 baseline; fall back to the scalar loop.
+*/
+const Kernel& selectKernel() {
+    static const Kernel kernel = []() -> Kernel {
+#if defined(DENSE_KERNELS_X86)
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx512f")) {
+            return {dotAVX512, "avx512"};
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return {dotAVX2, "avx2"};
+        }
+#elif defined(DENSE_KERNELS_NEON)
+        return {dotNEON, "neon"};
+#endif
+        return {dotScalar, "scalar"};
+    }();
+
+    return kernel;
+}
+
+} // namespace
+
+/*
+-------------------------------------------------
+Function Name : denseDot()
+
+Objective:
+    Dot product through the dispatched kernel.
+
+Input:
+    a, b   → Input arrays.
+    length → Number of elements.
+
+Output:
+    Dot product.
+
+Side Effect:
+    None.
+
+Approach:
+    Call the kernel chosen by selectKernel().
+
+    // call selectKernel()
+*/
+float denseDot(const float* a, const float* b, size_t length) {
+    // call selectKernel()
+    return selectKernel().function(a, b, length);
+}
+
+/*
+-------------------------------------------------
+Function Name : denseKernelName()
+
+Objective:
+    Report the dispatched kernel.
+
+Input:
+    None.
+
+Output:
+    Kernel name.
+
+Side Effect:
+    None.
+
+Approach:
+    Return the name stored with the selected kernel.
+
+    // call selectKernel()
+*/
+const char* denseKernelName() {
+    // call selectKernel()
+    return selectKernel().name;
+}
@@ -0,0 +1,68 @@
+#ifndef DENSEKERNELS_H
+#define DENSEKERNELS_H
+
+#include <cstddef>
+
+/*
+    ========================================================================
+                          MODULE : DenseKernels
+    ========================================================================
+
+    Objective:
+        Provide the float32 dot product used by the dense similarity
+        backend, vectorized for the CPU the program runs on:
+            - AVX-512F     (x86, 16 floats per instruction)
+            - AVX2 + FMA   (x86, 8 floats per instruction)
+            - NEON         (AArch64, 4 floats per instruction)
+            - Portable scalar loop otherwise
+
+    Input:
+        - Two float arrays of the same length.
+
+    Output:
+        - Their dot product, accumulated in float32.
+
+    Side Effects:
+        - The kernel is chosen once, on first use, from the CPU features
+          reported at run time (__builtin_cpu_supports on GCC/Clang), so
+          one binary runs on any x86-64 machine.
+
+    Notes:
+        - Every kernel handles any length; arrays padded to a multiple of
+          16 floats avoid the scalar tail loop.
+        - Kernels sum in different orders, so results may differ in the
+          last bits between machines, but are deterministic on a given one.
+*/
+
+/*
+    Objective:
+        Compute the dot product of two float arrays.
+
+    Input:
+        a, b   → arrays of at least 'length' floats.
+        length → number of elements.
+
+    Output:
+        Sum of a[i] * b[i].
+
+    Side Effects:
+        Selects the kernel on the first call.
+*/
+float denseDot(const float* a, const float* b, size_t length);
+
+/*
+    Objective:
+        Name the kernel denseDot() dispatches to.
+
+    Input:
+        None.
+
+    Output:
+        "avx512", "avx2", "neon" or "scalar".
+
+    Side Effects:
+        Selects the kernel if not done yet.
+*/
+const char* denseKernelName();
+
+#endif // DENSEKERNELS_H
@@ -1,7 +1,64 @@
 #include "FeatureExtractor.h"
+#include "FeatureHasher.h"
+#include "ThreadPool.h"
 #include <algorithm>
+#include <bitset>
+#include <climits>
 #include <cmath>
-#include <set>
+#include <utility>
+
+namespace {
+
+/*
+    Visit the (docId, count) postings of weight column 'column'. For
+    signed features a column is a hash bucket: the postings of its
+    positive and negative feature IDs are merged by document and the
+    count is their difference; documents whose tokens cancel out are
+    skipped.
+*/
+template <typename Visit>
+void forEachPosting(const std::pmr::vector<PostingList>& postings, bool signedFeatures,
+                    size_t column, Visit visit) {
+
+    if (!signedFeatures) {
+        for (const auto& posting : postings[column]) {
+            visit(posting.docId, posting.count);
+        }
+        return;
+    }
+
+    static const PostingList none;
+
+    size_t positiveId = column << 1;
+    size_t negativeId = positiveId | 1;
+
+    const PostingList& positive = positiveId < postings.size() ? postings[positiveId] : none;
+    const PostingList& negative = negativeId < postings.size() ? postings[negativeId] : none;
+
+    size_t p = 0;
+    size_t n = 0;
+
+    while (p < positive.size() || n < negative.size()) {
+        int positiveDoc = p < positive.size() ? positive[p].docId : INT_MAX;
+        int negativeDoc = n < negative.size() ? negative[n].docId : INT_MAX;
+        int docId = std::min(positiveDoc, negativeDoc);
+        int count = 0;
+
+        if (positiveDoc == docId) count += positive[p++].count;
+        if (negativeDoc == docId) count -= negative[n++].count;
+
+        if (count != 0) {
+            visit(docId, count);
+        }
+    }
+}
+
+// Number of weight columns: terms, or hash buckets for signed features
+size_t columnCount(const std::pmr::vector<PostingList>& postings, bool signedFeatures) {
+    return signedFeatures ? (postings.size() + 1) / 2 : postings.size();
+}
+
+} // namespace
 
 /*
 -------------------------------------------------
@@ -11,24 +68,54 @@ Objective:
     Initialize the FeatureExtractor with preprocessed documents and prepare vocabulary.
 
 Input:
-    docs → Vector containing tokenized words of all documents.
+    docs        → Vector containing tokenized words (term IDs) of all documents.
+    dictionary  → Term dictionary that produced the IDs.
+    threadCount → Threads building the index.
 
 Output:
-    Object of FeatureExtractor with documents loaded.
+    Object of FeatureExtractor with documents indexed.
 
 Side Effect:
-    Builds vocabulary immediately after object creation.
+    Builds inverted index immediately after object creation.
 
 
 Approach:
-    Assign input documents and immediately call buildVocabulary().
+    Index input documents straight away with buildVocabulary();
+    the index holds everything later stages need, so the token
+    lists are not copied.
 
     // call that function
 */
-FeatureExtractor::FeatureExtractor(const std::vector<std::vector<std::string>>& docs) 
-    : documents(docs) {
+FeatureExtractor::FeatureExtractor(const std::vector<std::vector<uint32_t>>& docs,
+                                   const TermDictionary& dictionary, int threadCount)
+    : dictionary(dictionary) {
     // call buildVocabulary()
-    buildVocabulary();
+    buildVocabulary(docs, threadCount);
+}
+
+/*
+-------------------------------------------------
+Function Name : FeatureExtractor (Constructor)
+
+Objective:
+    Initialize an empty FeatureExtractor.
+
+Input:
+    dictionary → Term dictionary of the documents to be added.
+
+Output:
+    Object of FeatureExtractor with no documents.
+
+Side Effect:
+    None.
+
+
+Approach:
+    Documents are added later with addDocument() or
+    addDocumentCounts().
+*/
+FeatureExtractor::FeatureExtractor(const TermDictionary& dictionary)
+    : dictionary(dictionary) {
 }
 
 /*
@@ -36,77 +123,308 @@ FeatureExtractor::FeatureExtractor(const std::vector<std::vector<std::string>>&
 Function Name : buildVocabulary()
 
 Objective:
-    Create a unique list of all words across all documents.
+    Index all words across all documents.
 
 Input:
-    None (uses internal documents list).
+    docs        → Tokenized documents (term IDs).
+    threadCount → Worker threads.
 
 Output:
-    Updates the vocabulary vector with unique words.
+    Updates the inverted index.
 
 Side Effect:
-    Modifies internal vocabulary container.
+    Modifies internal index container.
 
 
 Approach:
-    Collect words in a set to avoid duplicates and convert into vector.
+    Append all documents to the inverted index with its parallel
+    build. Unique words are already interned in the dictionary;
+    signed features are first moved to dense columns.
+
+    // call compactFeatures()
+    // call InvertedIndex::addDocuments()
 */
-void FeatureExtractor::buildVocabulary() {
-    std::set<std::string> vocabSet;
+void FeatureExtractor::buildVocabulary(const std::vector<std::vector<uint32_t>>& docs,
+                                       int threadCount) {
 
-    // Collect all unique words
-    for (const auto& doc : documents) {
-        for (const auto& word : doc) {
-            vocabSet.insert(word);
-        }
+    if (signedFeatures) {
+        // call compactFeatures()
+        index.addDocuments(index.documentCount(), compactFeatures(docs, threadCount),
+                           threadCount);
+        return;
     }
 
-    // Convert set into vector
-    vocabulary.assign(vocabSet.begin(), vocabSet.end());
+    // call InvertedIndex::addDocuments()
+    index.addDocuments(index.documentCount(), docs, threadCount);
 }
 
 /*
 -------------------------------------------------
-Function Name : computeTF()
+Function Name : addDocumentCounts()
 
 Objective:
-    Calculate term frequency for a single document.
+    Append a document that was already counted.
 
 Input:
-    document → Tokenized single document.
+    counts → Sorted (termId, count) entries.
+    length → Document token count.
 
 Output:
-    Map of word → Term Frequency (TF) value.
+    Index of the new document.
 
 Side Effect:
-    None.
+    Modifies internal index container.
 
 
 Approach:
-    Count word occurrences and divide by total word count.
+    Assign the next document index and hand the counts to the
+    inverted index.
 */
-std::map<std::string, double> FeatureExtractor::computeTF(const std::vector<std::string>& document) const {
-    std::map<std::string, double> tf;
+int FeatureExtractor::addDocumentCounts(const std::vector<TermCount>& counts, int length) {
+    int docId = index.documentCount();
+    index.addDocumentCounts(docId, counts, length);
+    idfStale = true;
+    return docId;
+}
+
+/*
+-------------------------------------------------
+Function Name : addDocument()
+
+Objective:
+    Append a tokenized document.
+
+Input:
+    tokens → Tokenized document (term IDs).
+
+Output:
+    Index of the new document.
 
-    if (document.empty()) {
-        return tf;
+Side Effect:
+    Modifies internal index container.
+
+
+Approach:
+    Assign the next document index, index its tokens (signed
+    features moved to dense columns) and mark IDF stale; nothing
+    else is recomputed until weights are requested.
+
+    // call compactFeatures()
+*/
+int FeatureExtractor::addDocument(const std::vector<uint32_t>& tokens) {
+    int docId = index.documentCount();
+
+    if (signedFeatures) {
+        // call compactFeatures()
+        index.addDocument(docId, compactFeatures({tokens}, 1).front());
+    } else {
+        index.addDocument(docId, tokens);
     }
 
-    std::map<std::string, int> termCount;
+    idfStale = true;
+    return docId;
+}
 
-    // Count frequency of each term
-    for (const auto& term : document) {
-        termCount[term]++;
+/*
+-------------------------------------------------
+Function Name : addDocuments()
+
+Objective:
+    Append a batch of tokenized documents in parallel.
+
+Input:
+    docs        → Tokenized documents (term IDs).
+    threadCount → Worker threads.
+
+Output:
+    Index of the first new document.
+
+Side Effect:
+    Modifies internal index container.
+
+
+Approach:
+    Index the batch with buildVocabulary() and mark IDF stale.
+
+    // call buildVocabulary()
+*/
+int FeatureExtractor::addDocuments(const std::vector<std::vector<uint32_t>>& docs,
+                                   int threadCount) {
+    int firstDocId = index.documentCount();
+
+    // call buildVocabulary()
+    buildVocabulary(docs, threadCount);
+    idfStale = true;
+    return firstDocId;
+}
+
+/*
+-------------------------------------------------
+Function Name : compactFeatures()
+
+Objective:
+    Move signed feature IDs from hash buckets to dense columns.
+
+Input:
+    docs        → Tokenized documents (signed feature IDs).
+    threadCount → Worker threads.
+
+Output:
+    The documents with (column << 1) | negative IDs.
+
+Side Effect:
+    Gives every bucket seen for the first time the next column, in
+    increasing bucket order.
+
+Approach:
+    Mark the buckets in a bitmap, append the new ones to
+    columnBuckets, then rank each token's bucket among the marked
+    ones (a popcount over the bitmap words) and look the rank up in
+    a table of used-bucket size, one document per task.
+
+    // call ThreadPool::run()
+*/
+std::vector<std::vector<uint32_t>>
+FeatureExtractor::compactFeatures(const std::vector<std::vector<uint32_t>>& docs,
+                                  int threadCount) {
+
+    // Bitmap of the buckets seen before and in this batch
+    std::vector<uint64_t> seen = knownBuckets;
+
+    for (const auto& tokens : docs) {
+        for (uint32_t featureId : tokens) {
+            uint32_t bucket = FeatureHasher::bucketOf(featureId);
+
+            if (bucket / 64 >= seen.size()) {
+                seen.resize(bucket / 64 + 1, 0);
+            }
+
+            seen[bucket / 64] |= uint64_t{1} << (bucket % 64);
+        }
     }
 
-    double totalTerms = static_cast<double>(document.size());
+    knownBuckets.resize(seen.size(), 0);
+
+    // Buckets with a rank below rankBefore[w] lie in words before w
+    std::vector<uint32_t> rankBefore(seen.size() + 1, 0);
+
+    for (size_t w = 0; w < seen.size(); w++) {
+        uint64_t added = seen[w] & ~knownBuckets[w];
+
+        for (uint32_t bit = 0; added != 0; bit++, added >>= 1) {
+            if (added & 1) {
+                columnBuckets.push_back(static_cast<uint32_t>(w * 64) + bit);
+            }
+        }
+
+        rankBefore[w + 1] = rankBefore[w] + static_cast<uint32_t>(std::bitset<64>(seen[w]).count());
+    }
+
+    knownBuckets = std::move(seen);
+
+    auto rankOf = [&](uint32_t bucket) {
+        uint64_t below = knownBuckets[bucket / 64] & ((uint64_t{1} << (bucket % 64)) - 1);
+        return rankBefore[bucket / 64] + static_cast<uint32_t>(std::bitset<64>(below).count());
+    };
+
+    std::vector<uint32_t> columnOfRank(columnBuckets.size());
+
+    for (size_t column = 0; column < columnBuckets.size(); column++) {
+        columnOfRank[rankOf(columnBuckets[column])] = static_cast<uint32_t>(column);
+    }
+
+    std::vector<std::vector<uint32_t>> compacted(docs.size());
+
+    // call ThreadPool::run()
+    ThreadPool(threadCount).run(docs.size(), [&](size_t d, int) {
+        compacted[d].reserve(docs[d].size());
+
+        for (uint32_t featureId : docs[d]) {
+            uint32_t column = columnOfRank[rankOf(FeatureHasher::bucketOf(featureId))];
+            compacted[d].push_back((column << 1) | (featureId & 1));
+        }
+    });
+
+    return compacted;
+}
+
+/*
+-------------------------------------------------
+Function Name : getColumnBuckets()
+
+Objective:
+    Report which hash bucket each weight column stands for.
+
+Input:
+    None.
+
+Output:
+    Bucket of every column (empty without signed features).
+
+Side Effect:
+    None.
+
+Approach:
+    Return the table filled by compactFeatures().
+*/
+const std::vector<uint32_t>& FeatureExtractor::getColumnBuckets() const {
+    return columnBuckets;
+}
+
+/*
+-------------------------------------------------
+Function Name : setSignedFeatures()
+
+Objective:
+    Select signed feature folding.
+
+Input:
+    enabled → true for FeatureHasher IDs.
+
+Output:
+    None.
+
+Side Effect:
+    Modifies internal signedFeatures value; marks IDF stale.
+
+Approach:
+    Assign new value; weights are recomputed on the next request.
+*/
+void FeatureExtractor::setSignedFeatures(bool enabled) {
+    signedFeatures = enabled;
+    idfStale = true;
+}
 
-    // Convert counts to TF values
-    for (const auto& pair : termCount) {
-        tf[pair.first] = static_cast<double>(pair.second) / totalTerms;
+/*
+-------------------------------------------------
+Function Name : getIDF()
+
+Objective:
+    Provide IDF values, refreshing them only when needed.
+
+Input:
+    None.
+
+Output:
+    Reference to cached IDF values.
+
+Side Effect:
+    Updates the cache after documents were added.
+
+
+Approach:
+    Recompute from the index DF counts if stale, else reuse.
+
+    // call computeIDF()
+*/
+const std::vector<double>& FeatureExtractor::getIDF() {
+    if (idfStale) {
+        // call computeIDF()
+        idfCache = computeIDF();
+        idfStale = false;
     }
 
-    return tf;
+    return idfCache;
 }
 
 /*
@@ -117,42 +435,46 @@ Objective:
     Compute Inverse Document Frequency (IDF) for each vocabulary word.
 
 Input:
-    None (uses global vocabulary and documents).
+    None (uses the inverted index).
 
 Output:
-    Map of word → IDF value.
+    Vector of IDF values indexed by term ID.
 
 Side Effect:
     None.
 
 
 Approach:
-    Count how many documents contain each word and apply IDF formula.
+    Take each word's document frequency from its postings list
+    and apply IDF formula; for signed features, count the documents
+    with a nonzero net count in each bucket.
+
+    // call forEachPosting()
 */
-std::map<std::string, double> FeatureExtractor::computeIDF() const {
-    std::map<std::string, double> idf;
+std::vector<double> FeatureExtractor::computeIDF() const {
+    std::vector<double> idf;
 
-    if (documents.empty()) {
+    if (index.documentCount() == 0) {
         return idf;
     }
 
-    double totalDocs = static_cast<double>(documents.size());
+    double totalDocs = static_cast<double>(index.documentCount());
+
+    const auto& postings = index.getAllPostings();
+    idf.resize(columnCount(postings, signedFeatures), 0.0);
 
-    for (const auto& term : vocabulary) {
+    for (size_t termId = 0; termId < idf.size(); termId++) {
         int docCount = 0;
 
-        // Count documents that contain the term
-        for (const auto& doc : documents) {
-            if (std::find(doc.begin(), doc.end(), term) != doc.end()) {
-                docCount++;
-            }
+        if (signedFeatures) {
+            forEachPosting(postings, true, termId, [&](int, int) { docCount++; });
+        } else {
+            docCount = static_cast<int>(postings[termId].size());
         }
 
         // Apply IDF formula
         if (docCount > 0) {
-            idf[term] = std::log10(totalDocs / static_cast<double>(docCount));
-        } else {
-            idf[term] = 0.0;
+            idf[termId] = std::log10(totalDocs / static_cast<double>(docCount));
         }
     }
 
@@ -167,7 +489,7 @@ Objective:
     Generate TF-IDF vectors for all documents.
 
 Input:
-    None (uses stored documents).
+    None (uses the inverted index).
 
 Output:
     Stores TF-IDF vectors internally.
@@ -177,37 +499,129 @@ Side Effect:
 
 
 Approach:
-    Calculate TF and IDF, multiply them, and store per document.
-
-    // call computeIDF()
-    // call computeTF()
+    Refresh IDF if needed, then walk the index in term ID order and append
+    TF * IDF to the vector of each document in the term's postings.
+    Terms are visited in increasing ID order, so every document
+    vector comes out sorted by term ID; zero weights are skipped.
+    Signed features are walked by bucket with their net counts.
+
+    // call getIDF()
+    // call forEachPosting()
 */
 void FeatureExtractor::computeTFIDF() {
     tfidfVectors.clear();
+    activeTerms = 0;
+    nonZeroEntries = 0;
 
-    if (documents.empty()) {
+    if (index.documentCount() == 0) {
         return;
     }
 
-    // call computeIDF()
-    std::map<std::string, double> idf = computeIDF();
-
-    for (const auto& doc : documents) {
-        // call computeTF()
-        std::map<std::string, double> tf = computeTF(doc);
-        std::map<std::string, double> tfidf;
-
-        // Compute TF-IDF values
-        for (const auto& term : vocabulary) {
-            double tfValue = (tf.find(term) != tf.end()) ? tf.at(term) : 0.0;
-            double idfValue = idf.at(term);
-            tfidf[term] = tfValue * idfValue;
+    // call getIDF()
+    const std::vector<double>& idf = getIDF();
+
+    tfidfVectors.resize(index.documentCount());
+
+    const auto& postings = index.getAllPostings();
+
+    for (size_t termId = 0; termId < idf.size(); termId++) {
+        double idfValue = idf[termId];
+
+        if (idfValue == 0.0) {
+            continue;
         }
 
-        tfidfVectors.push_back(tfidf);
+        activeTerms++;
+
+        // Compute TF-IDF values for every document containing the term
+        // call forEachPosting()
+        forEachPosting(postings, signedFeatures, termId, [&](int docId, int count) {
+            double tfValue = static_cast<double>(count) /
+                             static_cast<double>(index.documentLength(docId));
+
+            tfidfVectors[docId].push_back({static_cast<uint32_t>(termId), tfValue * idfValue});
+            nonZeroEntries++;
+        });
     }
 }
 
+/*
+-------------------------------------------------
+Function Name : getActiveTermCount()
+
+Objective:
+    Retrieve number of terms with a nonzero weight.
+
+Input:
+    None.
+
+Output:
+    Active term count.
+
+Side Effect:
+    None.
+
+
+Approach:
+    Return the count taken by computeTFIDF().
+*/
+size_t FeatureExtractor::getActiveTermCount() const {
+    return activeTerms;
+}
+
+/*
+-------------------------------------------------
+Function Name : getNonZeroCount()
+
+Objective:
+    Retrieve number of nonzero TF-IDF weights.
+
+Input:
+    None.
+
+Output:
+    Nonzero entry count.
+
+Side Effect:
+    None.
+
+
+Approach:
+    Return the count taken by computeTFIDF().
+*/
+size_t FeatureExtractor::getNonZeroCount() const {
+    return nonZeroEntries;
+}
+
+/*
+-------------------------------------------------
+Function Name : getDensity()
+
+Objective:
+    Retrieve fill ratio of the TF-IDF matrix.
+
+Input:
+    None.
+
+Output:
+    Fraction of nonzero (document, active term) cells.
+
+Side Effect:
+    None.
+
+
+Approach:
+    Divide nonzero entries by documents x active terms.
+*/
+double FeatureExtractor::getDensity() const {
+    if (activeTerms == 0 || index.documentCount() == 0) {
+        return 0.0;
+    }
+
+    return static_cast<double>(nonZeroEntries) /
+           (static_cast<double>(index.documentCount()) * static_cast<double>(activeTerms));
+}
+
 /*
 -------------------------------------------------
 Function Name : getTFIDFVector()
@@ -219,20 +633,23 @@ Input:
     docIndex → Document index.
 
 Output:
-    Corresponding TF-IDF vector map.
+    Reference to the sparse TF-IDF vector.
 
 Side Effect:
     None.
 
 
 Approach:
-    Check bounds and return requested vector if valid.
+    Check bounds and return requested vector if valid, or a shared
+    empty vector.
 */
-std::map<std::string, double> FeatureExtractor::getTFIDFVector(int docIndex) const {
+const SparseVector& FeatureExtractor::getTFIDFVector(int docIndex) const {
+    static const SparseVector empty;
+
     if (docIndex >= 0 && docIndex < static_cast<int>(tfidfVectors.size())) {
         return tfidfVectors[docIndex];
     }
-    return {};
+    return empty;
 }
 
 /*
@@ -246,7 +663,7 @@ Input:
     None.
 
 Output:
-    Vector of TF-IDF maps.
+    Reference to the sparse TF-IDF vectors.
 
 Side Effect:
     None.
@@ -255,10 +672,36 @@ Side Effect:
 Approach:
     Return full TF-IDF container directly.
 */
-std::vector<std::map<std::string, double>> FeatureExtractor::getAllTFIDFVectors() const {
+const std::vector<SparseVector>& FeatureExtractor::getAllTFIDFVectors() const {
     return tfidfVectors;
 }
 
+/*
+-------------------------------------------------
+Function Name : takeTFIDFVectors()
+
+Objective:
+    Transfer the TF-IDF vectors to the caller.
+
+Input:
+    None.
+
+Output:
+    Vector of sparse TF-IDF vectors.
+
+Side Effect:
+    Empties tfidfVectors.
+
+
+Approach:
+    Move the container out and leave an empty one behind.
+*/
+std::vector<SparseVector> FeatureExtractor::takeTFIDFVectors() {
+    std::vector<SparseVector> vectors = std::move(tfidfVectors);
+    tfidfVectors.clear();
+    return vectors;
+}
+
 /*
 -------------------------------------------------
 Function Name : getVocabulary()
@@ -270,15 +713,47 @@ Input:
     None.
 
 Output:
-    Vector of unique words.
+    Vector of unique word views, indexed by term ID.
 
 Side Effect:
     None.
 
 
 Approach:
-    Return vocabulary container.
+    Collect views of the dictionary terms in ID order; no term
+    string is copied.
 */
-std::vector<std::string> FeatureExtractor::getVocabulary() const {
+std::vector<std::string_view> FeatureExtractor::getVocabulary() const {
+    std::vector<std::string_view> vocabulary;
+    vocabulary.reserve(dictionary.size());
+
+    for (size_t termId = 0; termId < dictionary.size(); termId++) {
+        vocabulary.emplace_back(dictionary.getTerm(static_cast<uint32_t>(termId)));
+    }
+
     return vocabulary;
 }
+
+/*
+-------------------------------------------------
+Function Name : getInvertedIndex()
+
+Objective:
+    Expose corpus inverted index to other stages.
+
+Input:
+    None.
+
+Output:
+    Reference to internal InvertedIndex.
+
+Side Effect:
+    None.
+
+
+Approach:
+    Return index container directly.
+*/
+const InvertedIndex& FeatureExtractor::getInvertedIndex() const {
+    return index;
+}
@@ -1,10 +1,14 @@
 #ifndef FEATUREEXTRACTOR_H
 #define FEATUREEXTRACTOR_H
 
+#include <cstdint>
 #include <vector>
 #include <string>
-#include <map>
-#include <unordered_map>
+#include <string_view>
+
+#include "SparseVector.h"
+#include "InvertedIndex.h"
+#include "TermDictionary.h"
 
 /*
     ===========================================
@@ -13,90 +17,132 @@
 
     Objective:
         Convert tokenized documents into TF-IDF vectors by:
-        - building a vocabulary
+        - indexing the vocabulary (term IDs from a TermDictionary)
         - computing term frequency (TF)
         - computing inverse document frequency (IDF)
         - combining TF and IDF into TF-IDF values
 
     Input:
-        docs : std::vector<std::vector<std::string>>
-               A list of tokenized documents.
+        docs       : std::vector<std::vector<uint32_t>>
+                     A list of tokenized documents (term IDs).
+        dictionary : TermDictionary that assigned those IDs.
 
     Output:
         - Vocabulary of unique terms.
-        - TF-IDF vector for a given document.
-        - TF-IDF vectors for all documents.
+        - Inverted index (term -> docId, count) of the corpus.
+        - Sparse TF-IDF vector for a given document.
+        - Sparse TF-IDF vectors for all documents.
 
     Side Effects:
-        - Stores computed vocabulary internally.
+        - Stores computed inverted index internally.
         - Stores TF-IDF vectors internally.
+
+    Notes:
+        Documents can be added after construction. Each addition only
+        updates the DF counts in the index; IDF is recomputed lazily,
+        once, the next time weights are needed.
+
+        With signed features (FeatureHasher IDs), the used hash buckets
+        are numbered as dense columns first, the index is kept per
+        (column, sign), and IDF and TF-IDF are computed per column from
+        the net count (+1 / -1 per token) of each document, so weights
+        can be negative. Vector term IDs are then columns;
+        getColumnBuckets() maps them back to buckets.
 */
 
 class FeatureExtractor {
 private:
-    // List of tokenized documents
-    std::vector<std::vector<std::string>> documents;
+    // Vocabulary of unique words: term ID <-> term string
+    const TermDictionary& dictionary;
+
+    // Sparse TF-IDF vectors: nonzero (termId, tfidf) entries for each doc
+    std::vector<SparseVector> tfidfVectors;
+
+    // Inverted index: termId -> (docId, count) postings, plus document lengths
+    InvertedIndex index;
 
-    // Vocabulary of unique words
-    std::vector<std::string> vocabulary;
+    // IDF values of the last refresh, indexed by term ID
+    std::vector<double> idfCache;
 
-    // TF-IDF vectors: term -> tfidf value for each doc
-    std::vector<std::map<std::string, double>> tfidfVectors;
+    // Set when documents were added since idfCache was computed
+    bool idfStale = true;
+
+    // Term IDs are FeatureHasher signed feature IDs
+    bool signedFeatures = false;
+
+    // Signed features: bitmap of the buckets given a column, and the
+    // bucket of every column
+    std::vector<uint64_t> knownBuckets;
+    std::vector<uint32_t> columnBuckets;
+
+    // Shape of the last computeTFIDF() result
+    size_t activeTerms = 0;
+    size_t nonZeroEntries = 0;
 
     /*
         Objective:
-            Build vocabulary using all unique terms across documents.
+            Build the inverted index over the vocabulary in one pass.
 
         Input:
-            None (uses internal 'documents').
+            docs        : tokenized documents (term IDs).
+            threadCount : worker threads (< 1 = all hardware threads).
 
         Output:
-            Populates the 'vocabulary' vector.
+            Populates 'index'.
 
         Side Effects:
-            Modifies the internal 'vocabulary' vector.
+            Modifies the internal 'index'.
 
         Approach:
-            Use a std::set for uniqueness, then convert to vector.
+            Hand the batch to InvertedIndex::addDocuments(), which
+            counts document frequencies and postings in term-ID shards
+            on all threads; the dictionary already holds the unique
+            terms, so term IDs do not depend on the thread count.
     */
-    void buildVocabulary();
+    void buildVocabulary(const std::vector<std::vector<uint32_t>>& docs, int threadCount);
 
     /*
         Objective:
-            Compute Term Frequency for one document.
+            Compute IDF for all terms across all documents.
 
         Input:
-            document : vector<string>
+            None (uses internal 'index').
 
         Output:
-            A map: term -> TF value (double)
+            Vector of IDF values indexed by term ID.
 
         Side Effects:
             None.
 
         Approach:
-            Count occurrences, divide by total words.
+            Read each term's document frequency from the inverted index.
+            Apply IDF formula: log10(totalDocs / docCount).
+            With signed features, docCount counts the documents whose
+            net count in the bucket is nonzero.
     */
-    std::map<std::string, double> computeTF(const std::vector<std::string>& document) const;
+    std::vector<double> computeIDF() const;
 
     /*
         Objective:
-            Compute IDF for all terms across all documents.
+            Replace the hash buckets of signed feature IDs by dense
+            column numbers, so every per-term table is sized by the
+            buckets in use instead of by 2^bits.
 
         Input:
-            None (uses internal 'documents' and 'vocabulary').
+            docs        : tokenized documents (signed feature IDs).
+            threadCount : worker threads (< 1 = all hardware threads).
 
         Output:
-            Map of term -> IDF value.
+            Copies of the documents with (column << 1) | negative IDs.
 
         Side Effects:
-            None.
-
-        Approach:
-            For each term, count number of documents containing it.
-            Apply IDF formula: log10(totalDocs / docCount).
+            Appends the buckets seen for the first time to
+            columnBuckets, in increasing bucket order, so within a
+            batch columns keep the order of their buckets and vectors
+            sum their products in the same order as by bucket.
     */
-    std::map<std::string, double> computeIDF() const;
+    std::vector<std::vector<uint32_t>> compactFeatures(const std::vector<std::vector<uint32_t>>& docs,
+                                                       int threadCount);
 
 public:
     /*
@@ -104,15 +150,120 @@ public:
             Initialize class with given documents.
 
         Input:
-            docs : list of tokenized documents.
+            docs        : list of tokenized documents (term IDs).
+            dictionary  : dictionary the IDs come from; must outlive
+                          the extractor.
+            threadCount : threads building the inverted index (< 1 =
+                          all hardware threads).
+
+        Output:
+            None.
+
+        Side Effects:
+            Builds the inverted index; the token lists are not kept.
+    */
+    FeatureExtractor(const std::vector<std::vector<uint32_t>>& docs,
+                     const TermDictionary& dictionary, int threadCount = 1);
+
+    /*
+        Objective:
+            Initialize an empty corpus to be filled incrementally.
+
+        Input:
+            dictionary : dictionary the documents' IDs come from; must
+                         outlive the extractor.
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    explicit FeatureExtractor(const TermDictionary& dictionary);
+
+    /*
+        Objective:
+            Append one tokenized document.
+
+        Input:
+            tokens : tokenized document (term IDs).
+
+        Output:
+            Index assigned to the new document.
+
+        Side Effects:
+            Adds the document to the inverted index (updating DF counts)
+            and marks IDF stale; call computeTFIDF() afterwards to
+            refresh the vectors.
+    */
+    int addDocument(const std::vector<uint32_t>& tokens);
+
+    /*
+        Objective:
+            Append a batch of tokenized documents using several threads.
+
+        Input:
+            docs        : tokenized documents (term IDs).
+            threadCount : worker threads (< 1 = all hardware threads).
+
+        Output:
+            Index assigned to the first document of the batch.
+
+        Side Effects:
+            Same as addDocument() on each document in order, with the
+            same resulting index.
+    */
+    int addDocuments(const std::vector<std::vector<uint32_t>>& docs, int threadCount);
+
+    /*
+        Objective:
+            Append a document given as precomputed term counts.
+
+        Input:
+            counts : (termId, count) entries sorted by termId, with IDs
+                     from the extractor's dictionary.
+            length : token count of the document.
+
+        Output:
+            Index assigned to the new document.
+
+        Side Effects:
+            Same as addDocument().
+    */
+    int addDocumentCounts(const std::vector<TermCount>& counts, int length);
+
+    /*
+        Objective:
+            Declare that term IDs are FeatureHasher signed feature IDs.
+
+        Input:
+            enabled : true to fold (bucket, sign) IDs into one signed
+                      weight per bucket.
 
         Output:
             None.
 
         Side Effects:
-            Stores documents and builds vocabulary.
+            Marks IDF stale. IDF values and vector entries are then
+            indexed by column; call before adding documents.
     */
-    FeatureExtractor(const std::vector<std::vector<std::string>>& docs);
+    void setSignedFeatures(bool enabled);
+
+    /*
+        Objective:
+            Map the columns of signed features back to hash buckets,
+            e.g. to store vectors in a run-independent ID space.
+
+        Input:
+            None.
+
+        Output:
+            Bucket of every column, indexed by column.
+
+        Side Effects:
+            None.
+    */
+    const std::vector<uint32_t>& getColumnBuckets() const;
 
     /*
         Objective:
@@ -128,11 +279,52 @@ public:
             Modifies tfidfVectors vector.
 
         Approach:
-            Compute IDF once, compute TF for each doc,
-            multiply TF * IDF for each term.
+            Refresh IDF if stale (getIDF()), then walk the inverted index term by term
+            and append TF * IDF to each posting's document vector,
+            where TF = count / document length.
+            Only nonzero weights are stored, so terms absent from a
+            document (or present in every document) take no space.
     */
     void computeTFIDF();
 
+    /*
+        Objective:
+            Retrieve current IDF values.
+
+        Input:
+            None.
+
+        Output:
+            Reference to IDF values indexed by term ID.
+
+        Side Effects:
+            Recomputes the values if documents were added since the
+            last refresh.
+    */
+    const std::vector<double>& getIDF();
+
+    /*
+        Objective:
+            Describe the shape of the TF-IDF matrix, so callers can pick
+            a sparse or dense similarity backend.
+
+        Input:
+            None.
+
+        Output:
+            getActiveTermCount() : terms with a nonzero weight in at
+                                   least one document.
+            getNonZeroCount()    : nonzero weights over all documents.
+            getDensity()         : nonzero weights / (documents x active
+                                   terms), in [0, 1].
+
+        Side Effects:
+            None. Values refer to the last computeTFIDF() call.
+    */
+    size_t getActiveTermCount() const;
+    size_t getNonZeroCount() const;
+    double getDensity() const;
+
     /*
         Objective:
             Retrieve TF-IDF vector for a specific document.
@@ -141,27 +333,44 @@ public:
             docIndex : int
 
         Output:
-            Map<string, double> representing TF-IDF values.
+            Reference to the SparseVector of nonzero TF-IDF values sorted
+            by term ID (an empty vector if out of range).
 
         Side Effects:
             None.
     */
-    std::map<std::string, double> getTFIDFVector(int docIndex) const;
+    const SparseVector& getTFIDFVector(int docIndex) const;
 
     /*
         Objective:
-            Retrieve TF-IDF vectors for all documents.
+            Give read access to the TF-IDF vectors of all documents.
 
         Input:
             None.
 
         Output:
-            Vector of maps.
+            Reference to the internal vectors, one per document.
 
         Side Effects:
             None.
     */
-    std::vector<std::map<std::string, double>> getAllTFIDFVectors() const;
+    const std::vector<SparseVector>& getAllTFIDFVectors() const;
+
+    /*
+        Objective:
+            Hand the TF-IDF vectors to the next stage without a copy.
+
+        Input:
+            None.
+
+        Output:
+            The vectors, moved out of the extractor.
+
+        Side Effects:
+            Leaves the extractor without vectors until computeTFIDF()
+            runs again; shape statistics and the index are kept.
+    */
+    std::vector<SparseVector> takeTFIDFVectors();
 
     /*
         Objective:
@@ -171,12 +380,28 @@ public:
             None.
 
         Output:
-            Vector<string> of unique terms.
+            Views of the unique terms, indexed by term ID; they point
+            into the dictionary and stay valid while it lives.
+
+        Side Effects:
+            None.
+    */
+    std::vector<std::string_view> getVocabulary() const;
+
+    /*
+        Objective:
+            Give read access to the corpus inverted index.
+
+        Input:
+            None.
+
+        Output:
+            Reference to the InvertedIndex built at construction.
 
         Side Effects:
             None.
     */
-    std::vector<std::string> getVocabulary() const;
+    const InvertedIndex& getInvertedIndex() const;
 };
 
 #endif // FEATUREEXTRACTOR_H
@@ -0,0 +1,149 @@
+#ifndef FEATUREHASHER_H
+#define FEATUREHASHER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "HashUtils.h"
+
+/*
+    ========================================================================
+                            CLASS : FeatureHasher
+    ========================================================================
+
+    Objective:
+        Map tokens straight into a fixed 2^bits-dimensional feature space
+        (the hashing trick), so no global vocabulary has to be built:
+            - Each token hashes to one of 2^bits buckets
+            - A second, independent hash bit gives the token a sign, so
+              colliding tokens cancel on average instead of adding up
+              and dot products stay unbiased
+
+    Input:
+        - bits : log2 of the number of buckets.
+
+    Output:
+        - Signed feature IDs, (bucket << 1) | negative, usable wherever
+          term IDs are expected. FeatureExtractor::setSignedFeatures()
+          folds them back into one weight per bucket.
+
+    Side Effects:
+        - None. The hasher is immutable, so any number of threads can
+          share it.
+
+    Notes:
+        Memory of the later stages is bounded by the bucket count, not
+        by the corpus: FeatureExtractor numbers the buckets in use as
+        dense columns, so per-term tables hold at most 2^(bits + 1)
+        entries and usually far fewer.
+*/
+
+class FeatureHasher {
+private:
+
+    // log2 of the bucket count
+    int bits;
+
+    // Bucket count - 1
+    uint32_t mask;
+
+public:
+
+    // Largest supported bits; term-indexed tables grow with 2^bits
+    static constexpr int maxBits = 24;
+
+    /*
+        Objective:
+            Fix the size of the feature space.
+
+        Input:
+            hashBits → log2 of the bucket count, clamped to
+                       [1, maxBits].
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    explicit FeatureHasher(int hashBits)
+        : bits(hashBits < 1 ? 1 : (hashBits > maxBits ? maxBits : hashBits)),
+          mask((1u << bits) - 1) {
+    }
+
+    /*
+        Objective:
+            Return the configured size of the feature space.
+
+        Input:
+            None.
+
+        Output:
+            getBits()    : log2 of the bucket count.
+            dimensions() : bucket count (2^bits).
+
+        Side Effects:
+            None.
+    */
+    int getBits() const {
+        return bits;
+    }
+
+    size_t dimensions() const {
+        return static_cast<size_t>(mask) + 1;
+    }
+
+    /*
+        Objective:
+            Hash a token into a signed feature.
+
+        Input:
+            token → cleaned token.
+
+        Output:
+            (bucket << 1) | negative.
+
+        Side Effects:
+            None.
+
+        Approach:
+            FNV-1a over the bytes, finished with mixHash() so the low
+            bits (bucket) and the top bit (sign) are independent.
+    */
+    uint32_t featureId(std::string_view token) const {
+        uint64_t hash = 0xCBF29CE484222325ULL;
+
+        for (char c : token) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001B3ULL;
+        }
+
+        hash = mixHash(hash);
+
+        return ((static_cast<uint32_t>(hash) & mask) << 1) | static_cast<uint32_t>(hash >> 63);
+    }
+
+    /*
+        Objective:
+            Split a signed feature ID.
+
+        Input:
+            featureId → value returned by featureId().
+
+        Output:
+            bucketOf()   : bucket index.
+            isNegative() : true if the token counts with sign -1.
+
+        Side Effects:
+            None.
+    */
+    static uint32_t bucketOf(uint32_t featureId) {
+        return featureId >> 1;
+    }
+
+    static bool isNegative(uint32_t featureId) {
+        return (featureId & 1) != 0;
+    }
+};
+
+#endif // FEATUREHASHER_H
@@ -1,6 +1,4 @@
 #include "FileReader.h"
-#include <fstream>
-#include <sstream>
 #include <algorithm>
 #include <iostream>
 
@@ -8,8 +6,105 @@
     #include <windows.h>
 #else
     #include <dirent.h>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
 #endif
 
+namespace {
+
+// True for the extensions the readers know (txt, pdf, docx)
+bool hasSupportedExtension(const std::string& fileName) {
+    std::string ext = fileName.substr(fileName.find_last_of(".") + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+    return ext == "txt" || ext == "pdf" || ext == "docx";
+}
+
+// Append the supported files of one directory (ending in a separator)
+// to 'files', names prefixed with 'prefix'; descend if recursive
+void scanDirectory(const std::string& directory, const std::string& prefix, bool recursive,
+                   std::vector<ScannedFile>& files) {
+#ifdef _WIN32
+    std::string searchPath = directory + "*.*";
+
+    WIN32_FIND_DATAA findData;
+    HANDLE hFind = FindFirstFileA(searchPath.c_str(), &findData);
+
+    if (hFind == INVALID_HANDLE_VALUE) {
+        return;
+    }
+
+    do {
+        std::string fileName = findData.cFileName;
+
+        if (fileName == "." || fileName == "..") continue;
+
+        if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            // Junctions and directory links are not followed
+            if (recursive && !(findData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)) {
+                scanDirectory(directory + fileName + "/", prefix + fileName + "/",
+                              recursive, files);
+            }
+        }
+        else if (hasSupportedExtension(fileName)) {
+            uint64_t size = (static_cast<uint64_t>(findData.nFileSizeHigh) << 32) |
+                            findData.nFileSizeLow;
+            files.push_back({prefix + fileName, size});
+        }
+    } while (FindNextFileA(hFind, &findData) != 0);
+
+    FindClose(hFind);
+
+#else
+    DIR* dir = opendir(directory.c_str());
+
+    if (dir == nullptr) {
+        return;
+    }
+
+    int dirFd = dirfd(dir);
+    struct dirent* entry;
+
+    while ((entry = readdir(dir)) != nullptr) {
+
+        std::string fileName = entry->d_name;
+
+        if (fileName == "." || fileName == "..") continue;
+
+        // Links are not directories here, so link cycles are never entered
+        bool isDirectory = (entry->d_type == DT_DIR);
+
+        if (entry->d_type == DT_UNKNOWN) {
+            struct stat info;
+            isDirectory = fstatat(dirFd, entry->d_name, &info, AT_SYMLINK_NOFOLLOW) == 0 &&
+                          S_ISDIR(info.st_mode);
+        }
+
+        if (isDirectory) {
+            if (recursive) {
+                scanDirectory(directory + fileName + "/", prefix + fileName + "/",
+                              recursive, files);
+            }
+            continue;
+        }
+
+        if (!hasSupportedExtension(fileName)) continue;
+
+        // Follow file links for the size of their target
+        struct stat info;
+
+        if (fstatat(dirFd, entry->d_name, &info, 0) == 0 && S_ISREG(info.st_mode)) {
+            files.push_back({prefix + fileName, static_cast<uint64_t>(info.st_size)});
+        }
+    }
+
+    closedir(dir);
+#endif
+}
+
+} // namespace
+
 /*
 -------------------------------------------------
 Function Name : FileReader (Constructor)
@@ -58,61 +153,49 @@ Side Effect:
 
 Inside Function:
 Approach:
-    Traverse directory and collect files ending with txt, pdf, docx.
+    Scan the folder without subdirectories and keep the names.
+
+    // call scanFiles()
 */
 std::vector<std::string> FileReader::getFileNames() const {
     std::vector<std::string> fileNames;
 
-#ifdef _WIN32
-    std::string searchPath = folderPath + "*.*";
-
-    WIN32_FIND_DATAA findData;
-    HANDLE hFind = FindFirstFileA(searchPath.c_str(), &findData);
-
-    if (hFind != INVALID_HANDLE_VALUE) {
-
-        do {
-            if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
-
-                std::string fileName = findData.cFileName;
-                std::string ext = fileName.substr(fileName.find_last_of(".") + 1);
-                std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-
-                if (ext == "txt" || ext == "pdf" || ext == "docx") {
-                    fileNames.push_back(fileName);
-                }
-            }
-        } while (FindNextFileA(hFind, &findData) != 0);
-
-        FindClose(hFind);
+    // call scanFiles()
+    for (auto& file : scanFiles(false)) {
+        fileNames.push_back(std::move(file.name));
     }
 
-#else
-    DIR* dir = opendir(folderPath.c_str());
+    return fileNames;
+}
 
-    if (dir != nullptr) {
-        struct dirent* entry;
+/*
+-------------------------------------------------
+Function Name : scanFiles()
 
-        while ((entry = readdir(dir)) != nullptr) {
+Objective:
+    Retrieve all valid assignment files and their sizes, optionally
+    from the whole directory tree.
 
-            std::string fileName = entry->d_name;
+Input:
+    recursive → Descend into subdirectories.
 
-            if (fileName != "." && fileName != "..") {
+Output:
+    vector<ScannedFile> → Relative names and sizes.
 
-                std::string ext = fileName.substr(fileName.find_last_of(".") + 1);
-                std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+Side Effect:
+    Accesses local file system.
 
-                if (ext == "txt" || ext == "pdf" || ext == "docx") {
-                    fileNames.push_back(fileName);
-                }
-            }
-        }
+Approach:
+    Traverse each directory once, collecting files ending with txt,
+    pdf, docx and their sizes, and descend into real subdirectories
+    where they are listed.
+*/
+std::vector<ScannedFile> FileReader::scanFiles(bool recursive) const {
+    std::vector<ScannedFile> files;
 
-        closedir(dir);
-    }
-#endif
+    scanDirectory(folderPath, "", recursive, files);
 
-    return fileNames;
+    return files;
 }
 
 /*
@@ -133,19 +216,11 @@ Side Effect:
 
 Inside Function:
 Approach:
-    Open file and read entire content into string.
+    Map or read the file once and copy its bytes into the result.
 */
 std::string FileReader::readTXT(const std::string& filename) const {
-    std::string filePath = folderPath + filename;
-    std::ifstream file(filePath);
-
-    if (!file.is_open()) {
-        return "";
-    }
-
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    return buffer.str();
+    MappedFile file(folderPath + filename);
+    return std::string(file.view());
 }
 
 /*
@@ -265,44 +340,136 @@ Side Effect:
 
 
 Approach:
-    Extract extension and open file directly if TXT.
+    Open the file through mapFileByPath() and copy its content once.
+
+    // call mapFileByPath()
 */
 std::string FileReader::readFileByPath(const std::string& filePath) {
+    // call mapFileByPath()
+    MappedFile file = mapFileByPath(filePath);
+    return std::string(file.view());
+}
+
+/*
+-------------------------------------------------
+Function Name : mapFileByPath()
+
+Objective:
+    Open file by full path without copying its content.
+
+Input:
+    filePath → Absolute or relative file path.
+
+Output:
+    MappedFile → Read-only view of the content (invalid if unsupported).
+
+Side Effect:
+    Maps or reads the file.
+
+
+Approach:
+    Extract extension and map file directly if TXT.
+*/
+MappedFile FileReader::mapFileByPath(const std::string& filePath) {
 
     size_t lastDot = filePath.find_last_of(".");
 
     if (lastDot == std::string::npos) {
         std::cerr << "Warning: File has no extension: " << filePath << std::endl;
-        return "";
+        return MappedFile();
     }
 
     std::string ext = filePath.substr(lastDot + 1);
     std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
 
     if (ext == "txt") {
-
-        std::ifstream file(filePath);
-
-        if (!file.is_open()) {
-            return "";
-        }
-
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        return buffer.str();
+        return MappedFile(filePath);
     }
     else if (ext == "pdf") {
         std::cerr << "Warning: PDF reading not implemented. File: "
                   << filePath << " cannot be read." << std::endl;
-        return "";
+        return MappedFile();
     }
     else if (ext == "docx") {
         std::cerr << "Warning: DOCX reading not implemented. File: "
                   << filePath << " cannot be read." << std::endl;
-        return "";
+        return MappedFile();
     }
     else {
         std::cerr << "Warning: Unsupported file type: " << ext << std::endl;
-        return "";
+        return MappedFile();
     }
 }
+
+/*
+-------------------------------------------------
+Function Name : fileSizeByPath()
+
+Objective:
+    Return the size of a file.
+
+Input:
+    filePath → Absolute or relative file path.
+
+Output:
+    Size in bytes, or 0.
+
+Side Effect:
+    None.
+
+Approach:
+    Query the file's attributes without opening it.
+*/
+uint64_t FileReader::fileSizeByPath(const std::string& filePath) {
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA data;
+
+    if (!GetFileAttributesExA(filePath.c_str(), GetFileExInfoStandard, &data)) {
+        return 0;
+    }
+
+    return (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+#else
+    struct stat info;
+
+    if (stat(filePath.c_str(), &info) != 0) {
+        return 0;
+    }
+
+    return static_cast<uint64_t>(info.st_size);
+#endif
+}
+
+/*
+-------------------------------------------------
+Function Name : prefetchByPath()
+
+Objective:
+    Start reading a file into the page cache ahead of use.
+
+Input:
+    filePath → Absolute or relative file path.
+
+Output:
+    None.
+
+Side Effect:
+    Schedules readahead of the whole file.
+
+Approach:
+    Open the file, advise POSIX_FADV_WILLNEED (the kernel reads the
+    file asynchronously) and close it again. The page cache outlives
+    the descriptor, so the later open finds the data in memory.
+*/
+void FileReader::prefetchByPath(const std::string& filePath) {
+#if !defined(_WIN32) && defined(POSIX_FADV_WILLNEED)
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+
+    if (fd >= 0) {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+        ::close(fd);
+    }
+#else
+    (void)filePath;
+#endif
+}
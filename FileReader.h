@@ -3,6 +3,33 @@
 
 #include <vector>
 #include <string>
+#include <cstdint>
+
+#include "MappedFile.h"
+
+/*
+    ===========================================
+                STRUCT : ScannedFile
+    ===========================================
+
+    Objective:
+        Describe one supported file found by FileReader::scanFiles().
+
+    Input:
+        - name : path relative to the scanned folder, with '/' between
+                 subdirectories ("week3/alice.txt").
+        - size : file size in bytes, read during the scan.
+
+    Output:
+        None (plain data holder).
+
+    Side Effects:
+        None.
+*/
+struct ScannedFile {
+    std::string name;
+    uint64_t size = 0;
+};
 
 /*
     ===========================================
@@ -12,7 +39,8 @@
     Objective:
         The FileReader class manages reading files from a given folder.
         It provides functionality to:
-            - Retrieve names of files in a directory
+            - Retrieve names and sizes of files in a directory, optionally
+              including all of its subdirectories
             - Read text content from supported file formats
             - (TXT fully supported; PDF/DOCX implemented as placeholders)
 
@@ -23,6 +51,7 @@
     Output:
         - A vector of file names from the folder.
         - The full textual content of a file as a string (when supported).
+        - A zero-copy, read-only MappedFile view of a file's content.
 
     Side Effects:
         - None on external systems.
@@ -78,6 +107,31 @@ public:
     */
     std::vector<std::string> getFileNames() const;
 
+    /*
+        Objective:
+            Find all supported files of the folder together with their
+            sizes, optionally descending into subdirectories.
+
+        Input:
+            recursive : bool — also scan every subdirectory.
+
+        Output:
+            vector<ScannedFile> — names relative to the folder and sizes,
+            in directory order; a subdirectory's files follow at the
+            position where the subdirectory was listed.
+
+        Side Effects:
+            Reads the directory tree from disk.
+
+        Approach:
+            - One directory listing per directory; the size comes from
+              the listing on Windows and from one fstatat() per
+              supported file elsewhere.
+            - Symbolic links to directories (and Windows junctions) are
+              not followed, so link cycles cannot loop the scan.
+    */
+    std::vector<ScannedFile> scanFiles(bool recursive) const;
+
     /*
         Objective:
             Read content of a plain text (.txt) file.
@@ -152,6 +206,56 @@ public:
             Prints warnings for unsupported file types.
     */
     static std::string readFileByPath(const std::string& filePath);
+
+    /*
+        Objective:
+            Open a file by full path for zero-copy reading.
+
+        Input:
+            filePath : full path including filename.
+
+        Output:
+            MappedFile whose view() holds the content (txt supported only;
+            invalid for other types or unreadable files).
+
+        Side Effects:
+            Memory-maps large files, reads small ones into a buffer.
+            Prints warnings for unsupported file types.
+    */
+    static MappedFile mapFileByPath(const std::string& filePath);
+
+    /*
+        Objective:
+            Return the size of a file by full path.
+
+        Input:
+            filePath : full path including filename.
+
+        Output:
+            Size in bytes; 0 if the file cannot be examined.
+
+        Side Effects:
+            None.
+    */
+    static uint64_t fileSizeByPath(const std::string& filePath);
+
+    /*
+        Objective:
+            Ask the operating system to start reading a file that will
+            be opened soon.
+
+        Input:
+            filePath : full path including filename.
+
+        Output:
+            None.
+
+        Side Effects:
+            Starts asynchronous readahead into the page cache
+            (posix_fadvise WILLNEED); does nothing where that is not
+            available. Never blocks on the file's content.
+    */
+    static void prefetchByPath(const std::string& filePath);
 };
 
 #endif // FILEREADER_H
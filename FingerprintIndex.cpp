@@ -0,0 +1,332 @@
+#include "FingerprintIndex.h"
+#include "HashUtils.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <deque>
+
+namespace {
+
+// Equal fingerprints of two documents
+struct Hit {
+    uint32_t doc1;
+    uint32_t doc2;
+    uint32_t offset1;
+    uint32_t offset2;
+};
+
+// Tokens covered by ranges sorted by their begin
+template <typename Begin, typename End>
+uint64_t coveredTokens(const std::vector<MatchSpan>& spans, Begin begin, End end) {
+    uint64_t covered = 0;
+    uint32_t reach = 0;
+
+    for (const auto& span : spans) {
+        uint32_t from = std::max(begin(span), reach);
+        if (end(span) > from) {
+            covered += end(span) - from;
+            reach = end(span);
+        }
+    }
+
+    return covered;
+}
+
+} // namespace
+
+/*
+-------------------------------------------------
+Function Name : FingerprintIndex (Constructor)
+
+Objective:
+    Store k-gram, window and boilerplate parameters.
+
+Input:
+    kgramSize    → Tokens per k-gram.
+    windowSize   → Hashes per winnowing window.
+    maxDocuments → Boilerplate cutoff.
+
+Output:
+    FingerprintIndex object initialized.
+
+Side Effect:
+    Clamps parameters to their minimum.
+
+Approach:
+    Assign parameters to member variables.
+*/
+FingerprintIndex::FingerprintIndex(int kgramSize, int windowSize, int maxDocuments)
+    : kgramSize(std::max(1, kgramSize)),
+      windowSize(std::max(1, windowSize)),
+      maxDocuments(std::max(2, maxDocuments)) {
+}
+
+/*
+-------------------------------------------------
+Function Name : fingerprint()
+
+Objective:
+    Winnow the k-gram hashes of a document.
+
+Input:
+    document → Term IDs of the document.
+
+Output:
+    Selected (hash, offset) fingerprints by increasing offset.
+
+Side Effect:
+    None.
+
+Approach:
+    Hash each window of kgramSize tokens (a shorter document forms a
+    single k-gram). The queue holds positions of increasing hash, so
+    its front is the minimum of the current window; popping equal
+    hashes from the back keeps the rightmost minimum, which lets
+    consecutive windows share one selection.
+*/
+std::vector<FingerprintIndex::Fingerprint>
+FingerprintIndex::fingerprint(const std::vector<uint32_t>& document) const {
+
+    std::vector<Fingerprint> selected;
+
+    if (document.empty()) {
+        return selected;
+    }
+
+    size_t gram = std::min(document.size(), static_cast<size_t>(kgramSize));
+    size_t gramCount = document.size() - gram + 1;
+
+    std::vector<uint64_t> hashes(gramCount);
+    for (size_t start = 0; start < gramCount; start++) {
+        uint64_t hash = 0;
+        for (size_t k = 0; k < gram; k++) {
+            hash = combineHash(hash, document[start + k]);
+        }
+        hashes[start] = hash;
+    }
+
+    size_t window = std::min(gramCount, static_cast<size_t>(windowSize));
+    std::deque<size_t> queue;
+    size_t last = gramCount;
+
+    for (size_t i = 0; i < gramCount; i++) {
+        while (!queue.empty() && hashes[queue.back()] >= hashes[i]) {
+            queue.pop_back();
+        }
+        queue.push_back(i);
+
+        if (queue.front() + window <= i) {
+            queue.pop_front();
+        }
+
+        if (i + 1 >= window && queue.front() != last) {
+            last = queue.front();
+            selected.push_back({hashes[last], static_cast<uint32_t>(last)});
+        }
+    }
+
+    return selected;
+}
+
+/*
+-------------------------------------------------
+Function Name : build()
+
+Objective:
+    Create the global fingerprint index.
+
+Input:
+    documents   → Tokenized documents.
+    threadCount → Worker threads.
+
+Output:
+    None.
+
+Side Effect:
+    Replaces postings and document lengths.
+
+Approach:
+    Fingerprint documents in parallel, concatenate them in document
+    order and sort by hash so equal fingerprints become adjacent.
+
+    // call fingerprint()
+*/
+void FingerprintIndex::build(const std::vector<std::vector<uint32_t>>& documents,
+                             int threadCount) {
+
+    size_t numDocs = documents.size();
+    std::vector<std::vector<Fingerprint>> selected(numDocs);
+
+    ThreadPool pool(threadCount);
+
+    // call fingerprint()
+    pool.run(numDocs, [&](size_t d, int) {
+        selected[d] = fingerprint(documents[d]);
+    });
+
+    size_t total = 0;
+    for (const auto& fingerprints : selected) {
+        total += fingerprints.size();
+    }
+
+    postings.clear();
+    postings.reserve(total);
+    documentLengths.assign(numDocs, 0);
+
+    for (size_t d = 0; d < numDocs; d++) {
+        documentLengths[d] = static_cast<uint32_t>(documents[d].size());
+
+        for (const auto& fingerprint : selected[d]) {
+            postings.push_back({fingerprint.hash, static_cast<uint32_t>(d), fingerprint.offset});
+        }
+
+        std::vector<Fingerprint>().swap(selected[d]);
+    }
+
+    std::sort(postings.begin(), postings.end(), [](const Posting& a, const Posting& b) {
+        if (a.hash != b.hash) return a.hash < b.hash;
+        if (a.document != b.document) return a.document < b.document;
+        return a.offset < b.offset;
+    });
+}
+
+/*
+-------------------------------------------------
+Function Name : fingerprintCount()
+
+Objective:
+    Report the index size.
+
+Input:
+    None.
+
+Output:
+    Number of postings.
+
+Side Effect:
+    None.
+
+Approach:
+    Return the posting list size.
+*/
+size_t FingerprintIndex::fingerprintCount() const {
+    return postings.size();
+}
+
+/*
+-------------------------------------------------
+Function Name : findMatches()
+
+Objective:
+    Find matching passages between all documents.
+
+Input:
+    None.
+
+Output:
+    Matches with spans and scores, sorted by (doc1, doc2).
+
+Side Effect:
+    None.
+
+Approach:
+    Pair every two postings of a hash from different documents,
+    skipping hashes of a single document or of more than maxDocuments
+    (boilerplate). Sort the hits by pair and diagonal (offset1 -
+    offset2); along a diagonal, hits at most (kgramSize + windowSize
+    - 1) tokens after the current span extend it, so a passage with
+    small edits stays one span. The score is the share of both
+    documents' tokens covered by spans.
+*/
+std::vector<FingerprintMatch> FingerprintIndex::findMatches() const {
+
+    std::vector<Hit> hits;
+
+    for (size_t group = 0; group < postings.size();) {
+        size_t end = group + 1;
+        int documents = 1;
+
+        while (end < postings.size() && postings[end].hash == postings[group].hash) {
+            documents += postings[end].document != postings[end - 1].document;
+            end++;
+        }
+
+        if (documents >= 2 && documents <= maxDocuments) {
+            // Postings are sorted by document, so a.document <= b.document
+            for (size_t a = group; a < end; a++) {
+                for (size_t b = a + 1; b < end; b++) {
+                    if (postings[a].document != postings[b].document) {
+                        hits.push_back({postings[a].document, postings[b].document,
+                                        postings[a].offset, postings[b].offset});
+                    }
+                }
+            }
+        }
+
+        group = end;
+    }
+
+    auto diagonal = [](const Hit& hit) {
+        return static_cast<int64_t>(hit.offset1) - static_cast<int64_t>(hit.offset2);
+    };
+
+    std::sort(hits.begin(), hits.end(), [&](const Hit& a, const Hit& b) {
+        if (a.doc1 != b.doc1) return a.doc1 < b.doc1;
+        if (a.doc2 != b.doc2) return a.doc2 < b.doc2;
+        if (diagonal(a) != diagonal(b)) return diagonal(a) < diagonal(b);
+        return a.offset1 < b.offset1;
+    });
+
+    // An edited token breaks the kgramSize k-grams covering it, and
+    // winnowing may pass over up to windowSize - 1 more on each side,
+    // so gaps shorter than that stay inside one passage
+    uint32_t slack = static_cast<uint32_t>(kgramSize + windowSize - 1);
+
+    std::vector<FingerprintMatch> matches;
+
+    for (size_t first = 0; first < hits.size();) {
+        uint32_t doc1 = hits[first].doc1;
+        uint32_t doc2 = hits[first].doc2;
+        uint32_t length1 = documentLengths[doc1];
+        uint32_t length2 = documentLengths[doc2];
+
+        FingerprintMatch match{static_cast<int>(doc1), static_cast<int>(doc2), 0.0, {}};
+
+        size_t h = first;
+        for (; h < hits.size() && hits[h].doc1 == doc1 && hits[h].doc2 == doc2; h++) {
+            const Hit& hit = hits[h];
+            uint32_t end1 = std::min(hit.offset1 + static_cast<uint32_t>(kgramSize), length1);
+            uint32_t end2 = std::min(hit.offset2 + static_cast<uint32_t>(kgramSize), length2);
+
+            if (h > first && diagonal(hits[h - 1]) == diagonal(hit) &&
+                hit.offset1 <= match.spans.back().end1 + slack) {
+                match.spans.back().end1 = std::max(match.spans.back().end1, end1);
+                match.spans.back().end2 = std::max(match.spans.back().end2, end2);
+            } else {
+                match.spans.push_back({hit.offset1, end1, hit.offset2, end2});
+            }
+        }
+
+        std::vector<MatchSpan>& spans = match.spans;
+
+        std::sort(spans.begin(), spans.end(), [](const MatchSpan& a, const MatchSpan& b) {
+            return a.begin2 < b.begin2;
+        });
+        uint64_t covered2 = coveredTokens(spans,
+            [](const MatchSpan& s) { return s.begin2; }, [](const MatchSpan& s) { return s.end2; });
+
+        std::sort(spans.begin(), spans.end(), [](const MatchSpan& a, const MatchSpan& b) {
+            return a.begin1 != b.begin1 ? a.begin1 < b.begin1 : a.begin2 < b.begin2;
+        });
+        uint64_t covered1 = coveredTokens(spans,
+            [](const MatchSpan& s) { return s.begin1; }, [](const MatchSpan& s) { return s.end1; });
+
+        match.score = static_cast<double>(covered1 + covered2) /
+                      static_cast<double>(length1 + length2);
+        match.score = std::min(1.0, match.score);
+
+        matches.push_back(std::move(match));
+        first = h;
+    }
+
+    return matches;
+}
@@ -0,0 +1,193 @@
+#ifndef FINGERPRINTINDEX_H
+#define FINGERPRINTINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "MatchSpan.h"
+
+/*
+    ========================================================================
+                        STRUCT : FingerprintMatch
+    ========================================================================
+
+    Objective:
+        Represent a document pair that shares fingerprinted passages.
+
+    Input:
+        - doc1, doc2 : document indices (doc1 < doc2).
+        - score      : share of both documents' tokens covered by the
+                       matched passages, between 0.0 and 1.0.
+        - spans      : matched passages, ordered by position in doc1.
+
+    Output:
+        None (plain data holder).
+
+    Side Effects:
+        None.
+*/
+struct FingerprintMatch {
+    int doc1;
+    int doc2;
+    double score;
+    std::vector<MatchSpan> spans;
+};
+
+/*
+    ========================================================================
+                          CLASS : FingerprintIndex
+    ========================================================================
+
+    Objective:
+        The FingerprintIndex class finds shared passages with winnowed
+        k-gram fingerprints (as in MOSS), which, unlike bag-of-words
+        cosine, respect word order:
+            - Every k consecutive tokens are hashed into a k-gram hash
+            - Winnowing keeps the minimum hash of every window of w
+              consecutive k-gram hashes as the document's fingerprints
+            - All fingerprints of all documents are sorted into one global
+              fingerprint -> (document, offset) index
+            - One pass over the index joins equal fingerprints of different
+              documents; nearby matches on the same diagonal are merged
+              into passages (spans), bridging small edits
+
+    Input:
+        - kgramSize   : tokens per k-gram.
+        - windowSize  : k-gram hashes per winnowing window.
+        - maxDocuments: fingerprints found in more documents than this
+                        are treated as boilerplate and ignored.
+
+    Output:
+        - Matching pairs with their spans and overlap scores.
+
+    Side Effects:
+        - None. All computations are performed in-memory.
+
+    Notes:
+        Any passage of at least (kgramSize + windowSize - 1) tokens
+        shared by two documents is guaranteed to produce a match; matches
+        shorter than kgramSize tokens are never reported.
+*/
+
+class FingerprintIndex {
+private:
+
+    // One selected fingerprint of a document
+    struct Posting {
+        uint64_t hash;
+        uint32_t document;
+        uint32_t offset;
+    };
+
+    // Tokens per k-gram
+    int kgramSize;
+
+    // k-gram hashes per winnowing window
+    int windowSize;
+
+    // Document frequency above which fingerprints are ignored
+    int maxDocuments;
+
+    // Fingerprints of all documents, sorted by (hash, document, offset)
+    std::vector<Posting> postings;
+
+    // Token count by document
+    std::vector<uint32_t> documentLengths;
+
+public:
+
+    // One fingerprint: k-gram hash and the token offset it starts at
+    struct Fingerprint {
+        uint64_t hash;
+        uint32_t offset;
+    };
+
+    /*
+        Objective:
+            Configure k-gram and window sizes.
+
+        Input:
+            kgramSize    → tokens per k-gram (>= 1).
+            windowSize   → hashes per window (>= 1).
+            maxDocuments → boilerplate cutoff (>= 2).
+
+        Output:
+            None.
+
+        Side Effects:
+            Values below their minimum are raised to it.
+    */
+    FingerprintIndex(int kgramSize = 5, int windowSize = 4, int maxDocuments = 64);
+
+    /*
+        Objective:
+            Select the fingerprints of one document.
+
+        Input:
+            document → tokenized document (term IDs).
+
+        Output:
+            Winnowed fingerprints in increasing offset order (empty for
+            empty documents).
+
+        Side Effects:
+            None.
+
+        Approach:
+            Hash every k-gram, then slide the window with a monotonic
+            queue and record its minimum (the rightmost one on ties)
+            whenever the selected position changes.
+    */
+    std::vector<Fingerprint> fingerprint(const std::vector<uint32_t>& document) const;
+
+    /*
+        Objective:
+            Index the fingerprints of a corpus, replacing earlier contents.
+
+        Input:
+            documents   → tokenized documents (term IDs).
+            threadCount → threads fingerprinting documents (0 = all
+                          cores).
+
+        Output:
+            None.
+
+        Side Effects:
+            Rebuilds the posting list.
+    */
+    void build(const std::vector<std::vector<uint32_t>>& documents, int threadCount = 1);
+
+    /*
+        Objective:
+            Return the number of indexed fingerprints.
+
+        Input:
+            None.
+
+        Output:
+            Postings over all documents.
+
+        Side Effects:
+            None.
+    */
+    size_t fingerprintCount() const;
+
+    /*
+        Objective:
+            Join the index with itself to find matching passages.
+
+        Input:
+            None.
+
+        Output:
+            Pairs sharing at least one fingerprint, sorted by
+            (doc1, doc2).
+
+        Side Effects:
+            None.
+    */
+    std::vector<FingerprintMatch> findMatches() const;
+};
+
+#endif // FINGERPRINTINDEX_H
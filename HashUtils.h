@@ -0,0 +1,155 @@
+#ifndef HASHUTILS_H
+#define HASHUTILS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/*
+    ========================================================================
+                            HEADER : HashUtils
+    ========================================================================
+
+    Objective:
+        Small, fast 64-bit hash helpers shared by the hashing-based stages
+        (MinHash signatures, LSH buckets, fingerprints) and the content
+        hash identifying unchanged files between runs.
+
+    Input:
+        - 64-bit values to mix or combine, or a byte range to hash.
+
+    Output:
+        - Well-distributed 64-bit hashes.
+
+    Side Effects:
+        - None. Functions are inline because they run once per token or
+          per shingle on hot paths; the mixers are constexpr so that
+          compile-time tables can use them too.
+*/
+
+/*
+    Objective:
+        Scramble a 64-bit value (SplitMix64 finalizer).
+
+    Input:
+        x → value to mix.
+
+    Output:
+        Hash with all input bits affecting all output bits.
+
+    Side Effects:
+        None.
+*/
+constexpr uint64_t mixHash(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/*
+    Objective:
+        Fold one more value into a running hash.
+
+    Input:
+        seed  → running hash.
+        value → value to add.
+
+    Output:
+        Combined hash (order-sensitive).
+
+    Side Effects:
+        None.
+*/
+constexpr uint64_t combineHash(uint64_t seed, uint64_t value) {
+    return mixHash(seed ^ (value + 0x9E3779B97F4A7C15ULL + (seed << 6) + (seed >> 2)));
+}
+
+/*
+    Objective:
+        Hash a byte range with XXH64.
+
+    Input:
+        data  → first byte.
+        bytes → number of bytes.
+        seed  → hash seed (0 for the reference value).
+
+    Output:
+        XXH64 of the range; equal to the reference implementation on
+        little-endian hosts.
+
+    Side Effects:
+        None.
+
+    Approach:
+        Four accumulators consume 32-byte stripes, then the tail is
+        folded in 8, 4 and 1 byte steps and the result avalanched.
+        Unaligned words are read with memcpy.
+*/
+inline uint64_t xxHash64(const void* data, size_t bytes, uint64_t seed = 0) {
+    const uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    const uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    const uint64_t prime3 = 0x165667B19E3779F9ULL;
+    const uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+    const uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+    auto rotate = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+    auto read64 = [](const unsigned char* p) { uint64_t v; std::memcpy(&v, p, 8); return v; };
+    auto read32 = [](const unsigned char* p) { uint32_t v; std::memcpy(&v, p, 4); return v; };
+    auto round = [&](uint64_t acc, uint64_t input) {
+        return rotate(acc + input * prime2, 31) * prime1;
+    };
+    auto merge = [&](uint64_t acc, uint64_t value) {
+        return (acc ^ round(0, value)) * prime1 + prime4;
+    };
+
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    const unsigned char* end = p + bytes;
+    uint64_t hash;
+
+    if (bytes >= 32) {
+        uint64_t v1 = seed + prime1 + prime2;
+        uint64_t v2 = seed + prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime1;
+
+        for (; p + 32 <= end; p += 32) {
+            v1 = round(v1, read64(p));
+            v2 = round(v2, read64(p + 8));
+            v3 = round(v3, read64(p + 16));
+            v4 = round(v4, read64(p + 24));
+        }
+
+        hash = rotate(v1, 1) + rotate(v2, 7) + rotate(v3, 12) + rotate(v4, 18);
+        hash = merge(hash, v1);
+        hash = merge(hash, v2);
+        hash = merge(hash, v3);
+        hash = merge(hash, v4);
+    } else {
+        hash = seed + prime5;
+    }
+
+    hash += static_cast<uint64_t>(bytes);
+
+    for (; p + 8 <= end; p += 8) {
+        hash = rotate(hash ^ round(0, read64(p)), 27) * prime1 + prime4;
+    }
+
+    if (p + 4 <= end) {
+        hash = rotate(hash ^ (read32(p) * prime1), 23) * prime2 + prime3;
+        p += 4;
+    }
+
+    for (; p < end; p++) {
+        hash = rotate(hash ^ (*p * prime5), 11) * prime1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+#endif // HASHUTILS_H
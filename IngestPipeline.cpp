@@ -0,0 +1,313 @@
+#include "IngestPipeline.h"
+#include "BoundedQueue.h"
+#include "FileReader.h"
+#include "HashUtils.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <utility>
+
+/*
+-------------------------------------------------
+Function Name : IngestPipeline (Constructor)
+
+Objective:
+    Store the shared cleaner and thread counts.
+
+Input:
+    textCleaner → Shared TextCleaner.
+    readers     → Reader thread count.
+    cleaners    → Cleaner thread count.
+
+Output:
+    IngestPipeline object initialized.
+
+Side Effect:
+    None.
+
+Approach:
+    Clamp readers to at least 1; resolve non-positive cleaner
+    counts to the number of hardware threads.
+*/
+IngestPipeline::IngestPipeline(const TextCleaner& textCleaner, int readers, int cleaners)
+    : cleaner(textCleaner), readerThreads(readers), cleanerThreads(cleaners) {
+
+    if (readerThreads < 1) {
+        readerThreads = 1;
+    }
+
+    if (cleanerThreads < 1) {
+        cleanerThreads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+
+    if (cleanerThreads < 1) {
+        cleanerThreads = 1;
+    }
+}
+
+/*
+-------------------------------------------------
+Function Name : run()
+
+Objective:
+    Ingest files with overlapping reading and cleaning.
+
+Input:
+    filePaths  → Files to read.
+    dictionary → Shared term dictionary.
+    fileSizes  → File sizes, or empty.
+
+Output:
+    Ingested documents in input order.
+
+Side Effect:
+    Reads files; fills dictionary; uses worker threads.
+
+Approach:
+    Run the pipeline with per-document dictionaries merged into the
+    shared one.
+
+    // call ingest()
+*/
+std::vector<IngestedDocument> IngestPipeline::run(const std::vector<std::string>& filePaths,
+                                                  TermDictionary& dictionary,
+                                                  const std::vector<uint64_t>& fileSizes) const {
+    // call ingest()
+    return ingest(filePaths, fileSizes, &dictionary, nullptr);
+}
+
+/*
+-------------------------------------------------
+Function Name : run() (feature hashing overload)
+
+Objective:
+    Ingest files into hashed features.
+
+Input:
+    filePaths → Files to read.
+    hasher    → Feature hasher.
+    fileSizes → File sizes, or empty.
+
+Output:
+    Ingested documents in input order.
+
+Side Effect:
+    Reads files; uses worker threads.
+
+Approach:
+    Same pipeline; cleaners produce final IDs, so nothing is merged.
+
+    // call ingest()
+*/
+std::vector<IngestedDocument> IngestPipeline::run(const std::vector<std::string>& filePaths,
+                                                  const FeatureHasher& hasher,
+                                                  const std::vector<uint64_t>& fileSizes) const {
+    // call ingest()
+    return ingest(filePaths, fileSizes, nullptr, &hasher);
+}
+
+/*
+-------------------------------------------------
+Function Name : readOrder()
+
+Objective:
+    Schedule the largest files first.
+
+Input:
+    fileCount → Number of files.
+    fileSizes → File sizes, or empty.
+
+Output:
+    File indices in read order.
+
+Side Effect:
+    None.
+
+Approach:
+    Stable sort of the indices by decreasing size, so equal sizes
+    (and a missing size list) keep input order.
+*/
+std::vector<size_t> IngestPipeline::readOrder(size_t fileCount,
+                                              const std::vector<uint64_t>& fileSizes) {
+    std::vector<size_t> order(fileCount);
+    std::iota(order.begin(), order.end(), size_t(0));
+
+    if (fileSizes.size() == fileCount) {
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return fileSizes[a] > fileSizes[b];
+        });
+    }
+
+    return order;
+}
+
+/*
+-------------------------------------------------
+Function Name : ingest()
+
+Objective:
+    Run the reader / cleaner pipeline.
+
+Input:
+    filePaths  → Files to read.
+    fileSizes  → File sizes, or empty.
+    dictionary → Shared term dictionary (nullptr when hashing).
+    hasher     → Feature hasher (nullptr for dictionary IDs).
+
+Output:
+    Ingested documents in input order.
+
+Side Effect:
+    Reads files; fills dictionary; uses worker threads.
+
+Approach:
+    Readers (largest file first, prefetching ahead) → bounded queue →
+    cleaners → per-file slots → in-order collection on the calling
+    thread, which remaps local term IDs into the shared dictionary.
+
+    // call readOrder()
+    // call FileReader::prefetchByPath()
+    // call FileReader::mapFileByPath()
+    // call xxHash64()
+    // call TextCleaner::preprocess()
+*/
+std::vector<IngestedDocument> IngestPipeline::ingest(const std::vector<std::string>& filePaths,
+                                                     const std::vector<uint64_t>& fileSizes,
+                                                     TermDictionary* dictionary,
+                                                     const FeatureHasher* hasher) const {
+
+    size_t fileCount = filePaths.size();
+    std::vector<IngestedDocument> documents(fileCount);
+
+    if (fileCount == 0) {
+        return documents;
+    }
+
+    // Output of a cleaner for one file, before merging. The local
+    // dictionary lives in a per-document arena that is released in
+    // one shot once its terms are merged.
+    struct LocalResult {
+        std::pmr::monotonic_buffer_resource arena{16 * 1024};
+        TermDictionary terms{&arena};
+        std::vector<uint32_t> termIds;
+        bool hasContent = false;
+        size_t bytesRead = 0;
+        uint64_t contentHash = 0;
+    };
+
+    // Filled slot = finished file; results move by pointer, so the
+    // dictionary never leaves its arena
+    std::vector<std::unique_ptr<LocalResult>> slots(fileCount);
+    std::mutex slotLock;
+    std::condition_variable slotReady;
+
+    size_t queueCapacity = 2 * static_cast<size_t>(cleanerThreads);
+    BoundedQueue<std::pair<size_t, MappedFile>> rawFiles(queueCapacity);
+
+    // call readOrder()
+    std::vector<size_t> order = readOrder(fileCount, fileSizes);
+    std::atomic<size_t> nextFile{0};
+    std::atomic<int> activeReaders{readerThreads};
+
+    // Files this far ahead of a reader are being read by the others or
+    // waiting in the queue, so their I/O can start now
+    size_t prefetchDistance = queueCapacity + static_cast<size_t>(readerThreads);
+
+    auto readerLoop = [&]() {
+        size_t position;
+        while ((position = nextFile.fetch_add(1)) < fileCount) {
+            if (position + prefetchDistance < fileCount) {
+                // call FileReader::prefetchByPath()
+                FileReader::prefetchByPath(filePaths[order[position + prefetchDistance]]);
+            }
+
+            size_t index = order[position];
+
+            // call FileReader::mapFileByPath()
+            rawFiles.push({index, FileReader::mapFileByPath(filePaths[index])});
+        }
+
+        // The last reader to finish ends the stream
+        if (activeReaders.fetch_sub(1) == 1) {
+            rawFiles.close();
+        }
+    };
+
+    auto cleanerLoop = [&]() {
+        std::pair<size_t, MappedFile> item;
+
+        while (rawFiles.pop(item)) {
+            auto local = std::make_unique<LocalResult>();
+            std::string_view content = item.second.view();
+            local->bytesRead = content.size();
+            local->contentHash = xxHash64(content.data(), content.size());
+
+            if (!content.empty()) {
+                // call TextCleaner::preprocess()
+                local->termIds = hasher ? cleaner.preprocess(content, *hasher)
+                                        : cleaner.preprocess(content, local->terms);
+                local->hasContent = true;
+            }
+
+            // Release the mapping before publishing the tokens
+            item.second = MappedFile();
+
+            std::lock_guard<std::mutex> guard(slotLock);
+            slots[item.first] = std::move(local);
+            slotReady.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int r = 0; r < readerThreads; r++) {
+        threads.emplace_back(readerLoop);
+    }
+    for (int c = 0; c < cleanerThreads; c++) {
+        threads.emplace_back(cleanerLoop);
+    }
+
+    // Collect in input order and merge local terms
+    for (size_t index = 0; index < fileCount; index++) {
+        std::unique_ptr<LocalResult> local;
+
+        {
+            std::unique_lock<std::mutex> guard(slotLock);
+            slotReady.wait(guard, [&] { return slots[index] != nullptr; });
+            local = std::move(slots[index]);
+        }
+
+        documents[index].bytesRead = local->bytesRead;
+        documents[index].contentHash = local->contentHash;
+
+        if (!local->hasContent) {
+            continue;
+        }
+
+        // Local IDs follow first appearance, so interning them in order
+        // reproduces the IDs of a serial run; hashed IDs are final
+        if (dictionary) {
+            std::vector<uint32_t> remap(local->terms.size());
+            for (size_t id = 0; id < remap.size(); id++) {
+                remap[id] = dictionary->intern(local->terms.getTerm(static_cast<uint32_t>(id)));
+            }
+
+            for (auto& termId : local->termIds) {
+                termId = remap[termId];
+            }
+        }
+
+        documents[index].hasContent = true;
+        documents[index].termIds = std::move(local->termIds);
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    return documents;
+}
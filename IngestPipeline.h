@@ -0,0 +1,210 @@
+#ifndef INGESTPIPELINE_H
+#define INGESTPIPELINE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "TextCleaner.h"
+#include "TermDictionary.h"
+
+/*
+    ========================================================================
+                          STRUCT : IngestedDocument
+    ========================================================================
+
+    Objective:
+        Hold the outcome of ingesting one file.
+
+    Input:
+        - hasContent : false if the file was unreadable, unsupported or
+                       empty.
+        - termIds    : cleaned tokens as shared-dictionary IDs (or
+                       signed feature IDs with feature hashing).
+        - bytesRead  : size of the raw file content that was read.
+        - contentHash: XXH64 of the raw file content, so unchanged
+                       files can be recognized between runs.
+
+    Output:
+        None (plain data holder).
+
+    Side Effects:
+        None.
+*/
+struct IngestedDocument {
+    bool hasContent = false;
+    std::vector<uint32_t> termIds;
+    size_t bytesRead = 0;
+    uint64_t contentHash = 0;
+};
+
+/*
+    ========================================================================
+                          CLASS : IngestPipeline
+    ========================================================================
+
+    Objective:
+        The IngestPipeline class overlaps file I/O with text cleaning:
+            - Reader threads open files (FileReader::mapFileByPath) and
+              push the raw buffers into a bounded queue, largest file
+              first when sizes are known, so no big file is left to
+              finish alone at the end
+            - Readers ask the OS to prefetch the files a queue length
+              ahead of them, so disk reads overlap cleaning
+            - A pool of cleaner threads tokenizes buffers with one shared
+              TextCleaner, each into a document-local TermDictionary
+            - The calling thread collects documents in input order and
+              merges their local terms into the shared dictionary
+
+    Input:
+        - A TextCleaner (read-only, shared by all cleaner threads).
+        - Reader and cleaner thread counts.
+        - A list of file paths (and optionally their sizes) and the
+          dictionary to fill.
+
+    Output:
+        - One IngestedDocument per input path, in input order.
+
+    Side Effects:
+        - Reads files from disk.
+        - Adds terms to the shared TermDictionary.
+
+    Notes:
+        Local terms are merged in document order and in first-seen order
+        within each document, so term IDs are exactly those of a serial
+        run regardless of thread scheduling or read order. Documents
+        cleaned ahead of their turn wait, tokenized, until every earlier
+        one is merged.
+        With a FeatureHasher, cleaners hash tokens directly and nothing
+        is merged, so no work is left on the collecting thread.
+*/
+
+class IngestPipeline {
+private:
+
+    // Shared, read-only text cleaner
+    const TextCleaner& cleaner;
+
+    // Number of file reading threads
+    int readerThreads;
+
+    // Number of tokenizing threads
+    int cleanerThreads;
+
+    /*
+        Objective:
+            Decide the order in which files are read.
+
+        Input:
+            fileCount → number of files.
+            fileSizes → sizes aligned with the files, or empty.
+
+        Output:
+            File indices, largest file first (ties and unknown sizes in
+            input order).
+
+        Side Effects:
+            None.
+    */
+    static std::vector<size_t> readOrder(size_t fileCount, const std::vector<uint64_t>& fileSizes);
+
+    /*
+        Objective:
+            Shared implementation of both run() overloads.
+
+        Input:
+            filePaths  → files to ingest.
+            fileSizes  → their sizes, or empty to read in input order.
+            dictionary → shared dictionary, or nullptr when hashing.
+            hasher     → feature hasher, or nullptr for term IDs.
+
+        Output:
+            Vector of IngestedDocument aligned with filePaths.
+
+        Side Effects:
+            Spawns and joins reader and cleaner threads.
+    */
+    std::vector<IngestedDocument> ingest(const std::vector<std::string>& filePaths,
+                                         const std::vector<uint64_t>& fileSizes,
+                                         TermDictionary* dictionary,
+                                         const FeatureHasher* hasher) const;
+
+public:
+
+    /*
+        Objective:
+            Configure the pipeline.
+
+        Input:
+            textCleaner → cleaner shared by all workers; must outlive run().
+            readers     → reader thread count (< 1 = 1).
+            cleaners    → cleaner thread count (< 1 = all hardware threads).
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    IngestPipeline(const TextCleaner& textCleaner, int readers, int cleaners);
+
+    /*
+        Objective:
+            Read and preprocess all files.
+
+        Input:
+            filePaths  → files to ingest.
+            dictionary → shared dictionary receiving all terms.
+            fileSizes  → sizes aligned with filePaths (e.g. from
+                         FileReader::scanFiles()); empty to read the
+                         files in input order.
+
+        Output:
+            Vector of IngestedDocument aligned with filePaths.
+
+        Side Effects:
+            Spawns and joins reader and cleaner threads.
+
+        Approach:
+            - Readers claim positions of the read order (largest first)
+              from a shared counter, prefetch the file one queue length
+              further on and push (index, MappedFile) into a queue of
+              2 x cleaners entries, so at most that many raw buffers are
+              open at once.
+            - Cleaners pop, tokenize into a local dictionary allocated in
+              a per-document arena, and publish the result in the file's
+              slot; the arena is freed in one shot after merging.
+            - The caller waits for slots in index order and remaps each
+              document's local IDs into the shared dictionary.
+    */
+    std::vector<IngestedDocument> run(const std::vector<std::string>& filePaths,
+                                      TermDictionary& dictionary,
+                                      const std::vector<uint64_t>& fileSizes = {}) const;
+
+    /*
+        Objective:
+            Read and preprocess all files into hashed features.
+
+        Input:
+            filePaths → files to ingest.
+            hasher    → feature hasher shared by all cleaners.
+            fileSizes → sizes aligned with filePaths, or empty.
+
+        Output:
+            Vector of IngestedDocument aligned with filePaths, holding
+            signed feature IDs.
+
+        Side Effects:
+            Spawns and joins reader and cleaner threads.
+
+        Approach:
+            - Same reader / cleaner / in-order collection as the
+              dictionary overload, without the per-document dictionary
+              and the merge.
+    */
+    std::vector<IngestedDocument> run(const std::vector<std::string>& filePaths,
+                                      const FeatureHasher& hasher,
+                                      const std::vector<uint64_t>& fileSizes = {}) const;
+};
+
+#endif // INGESTPIPELINE_H
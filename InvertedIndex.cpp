@@ -0,0 +1,492 @@
+#include "InvertedIndex.h"
+#include "ThreadPool.h"
+#include <algorithm>
+
+/*
+-------------------------------------------------
+Function Name : InvertedIndex (Constructor)
+
+Objective:
+    Create an empty index.
+
+Input:
+    None.
+
+Output:
+    InvertedIndex object initialized.
+
+Side Effect:
+    None.
+
+Approach:
+    Create the arena and bind the postings table to it; nested
+    lists inherit the arena through uses-allocator construction.
+*/
+InvertedIndex::InvertedIndex()
+    : arena(std::make_unique<std::pmr::monotonic_buffer_resource>()),
+      postingsByTerm(arena.get()) {
+}
+
+/*
+-------------------------------------------------
+Function Name : addDocument()
+
+Objective:
+    Index all terms of a single document.
+
+Input:
+    docId  → Document index.
+    tokens → Tokenized document (term IDs).
+
+Output:
+    None.
+
+Side Effect:
+    Appends postings and records document length.
+
+Approach:
+    Sort a copy of the term IDs, then append one posting per run
+    of equal IDs with the run length as count.
+*/
+void InvertedIndex::addDocument(int docId, const std::vector<uint32_t>& tokens) {
+
+    if (docId >= static_cast<int>(documentLengths.size())) {
+        documentLengths.resize(docId + 1, 0);
+    }
+    documentLengths[docId] = static_cast<int>(tokens.size());
+
+    std::vector<uint32_t> sorted(tokens);
+    std::sort(sorted.begin(), sorted.end());
+
+    if (!sorted.empty() && sorted.back() >= postingsByTerm.size()) {
+        postingsByTerm.resize(static_cast<size_t>(sorted.back()) + 1);
+    }
+
+    // Append one posting per distinct term
+    size_t i = 0;
+    while (i < sorted.size()) {
+        size_t runEnd = i;
+        while (runEnd < sorted.size() && sorted[runEnd] == sorted[i]) {
+            runEnd++;
+        }
+
+        postingsByTerm[sorted[i]].push_back({docId, static_cast<int>(runEnd - i)});
+        i = runEnd;
+    }
+}
+
+/*
+-------------------------------------------------
+Function Name : addDocuments()
+
+Objective:
+    Index a batch of documents in parallel.
+
+Input:
+    firstDocId  → Index of the first document.
+    docs        → Tokenized documents (term IDs).
+    threadCount → Worker threads.
+
+Output:
+    None.
+
+Side Effect:
+    Appends postings and records document lengths.
+
+Approach:
+    Split the documents into one contiguous range per worker; each
+    worker finds its lengths and largest term ID, then counts its
+    documents' terms in a worker-local table and files the
+    (termId, docId, count) entries by contiguous term-ID range. One
+    worker per term range then sums its document frequencies, the
+    calling thread reserves every list, and the range workers append
+    their entries worker by worker, i.e. in document order. One
+    worker counts its documents twice instead: once for the
+    frequencies, once to append straight into the lists.
+
+    // call ThreadPool::run()
+*/
+void InvertedIndex::addDocuments(int firstDocId, const std::vector<std::vector<uint32_t>>& docs,
+                                 int threadCount) {
+
+    if (docs.empty()) {
+        return;
+    }
+
+    size_t lastDoc = static_cast<size_t>(firstDocId) + docs.size();
+
+    if (lastDoc > documentLengths.size()) {
+        documentLengths.resize(lastDoc, 0);
+    }
+
+    ThreadPool pool(threadCount);
+    size_t workers = static_cast<size_t>(pool.size());
+
+    // Documents [docBegin(w), docBegin(w + 1)) belong to worker w
+    auto docBegin = [&](size_t w) { return docs.size() * w / workers; };
+
+    // Pass 1: lengths and largest term ID, per document range
+    std::vector<int64_t> largest(workers, -1);
+
+    // call ThreadPool::run()
+    pool.run(workers, [&](size_t w, int) {
+        int64_t top = -1;
+
+        for (size_t d = docBegin(w); d < docBegin(w + 1); d++) {
+            documentLengths[firstDocId + d] = static_cast<int>(docs[d].size());
+
+            for (uint32_t termId : docs[d]) {
+                top = std::max(top, static_cast<int64_t>(termId));
+            }
+        }
+
+        largest[w] = top;
+    });
+
+    int64_t maxTerm = *std::max_element(largest.begin(), largest.end());
+
+    if (maxTerm < 0) {
+        return;
+    }
+
+    size_t terms = static_cast<size_t>(maxTerm) + 1;
+
+    if (terms > postingsByTerm.size()) {
+        postingsByTerm.resize(terms);
+    }
+
+    // Count one document's terms in 'counts' (all zero again afterwards)
+    // and hand each distinct term with its count to emit()
+    auto countDocument = [&](size_t d, std::vector<int>& counts, std::vector<uint32_t>& touched,
+                             auto&& emit) {
+        for (uint32_t termId : docs[d]) {
+            if (counts[termId]++ == 0) {
+                touched.push_back(termId);
+            }
+        }
+
+        for (uint32_t termId : touched) {
+            emit(termId, counts[termId]);
+            counts[termId] = 0;
+        }
+
+        touched.clear();
+    };
+
+    // Grow each list once: the arena never reclaims outgrown buffers,
+    // and the parallel appends below must not allocate
+    auto reserveLists = [&](const std::vector<int>& batchFrequency) {
+        for (size_t termId = 0; termId < terms; termId++) {
+            if (batchFrequency[termId] > 0) {
+                PostingList& list = postingsByTerm[termId];
+                list.reserve(list.size() + static_cast<size_t>(batchFrequency[termId]));
+            }
+        }
+    };
+
+    if (workers == 1) {
+        std::vector<int> counts(terms, 0);
+        std::vector<uint32_t> touched;
+        std::vector<int> batchFrequency(terms, 0);
+
+        for (size_t d = 0; d < docs.size(); d++) {
+            countDocument(d, counts, touched,
+                          [&](uint32_t termId, int) { batchFrequency[termId]++; });
+        }
+
+        reserveLists(batchFrequency);
+
+        for (size_t d = 0; d < docs.size(); d++) {
+            int docId = firstDocId + static_cast<int>(d);
+
+            countDocument(d, counts, touched, [&](uint32_t termId, int count) {
+                postingsByTerm[termId].push_back({docId, count});
+            });
+        }
+
+        return;
+    }
+
+    // Terms [rangeSize * r, rangeSize * (r + 1)) belong to range r
+    size_t rangeSize = (terms + workers - 1) / workers;
+
+    struct Entry {
+        uint32_t termId;
+        int docId;
+        int count;
+    };
+
+    // entries[w][r]: worker w's entries of range r, in document order
+    std::vector<std::vector<std::vector<Entry>>> entries(
+        workers, std::vector<std::vector<Entry>>(workers));
+
+    // Pass 2: count terms per document, per document range
+    // call ThreadPool::run()
+    pool.run(workers, [&](size_t w, int) {
+        std::vector<int> counts(terms, 0);
+        std::vector<uint32_t> touched;
+
+        for (size_t d = docBegin(w); d < docBegin(w + 1); d++) {
+            int docId = firstDocId + static_cast<int>(d);
+
+            countDocument(d, counts, touched, [&](uint32_t termId, int count) {
+                entries[w][termId / rangeSize].push_back({termId, docId, count});
+            });
+        }
+    });
+
+    // Pass 3: document frequency of every term, per term range
+    std::vector<int> batchFrequency(terms, 0);
+
+    // call ThreadPool::run()
+    pool.run(workers, [&](size_t r, int) {
+        for (size_t w = 0; w < workers; w++) {
+            for (const Entry& entry : entries[w][r]) {
+                batchFrequency[entry.termId]++;
+            }
+        }
+    });
+
+    reserveLists(batchFrequency);
+
+    // Pass 4: append the postings, per term range
+    // call ThreadPool::run()
+    pool.run(workers, [&](size_t r, int) {
+        for (size_t w = 0; w < workers; w++) {
+            for (const Entry& entry : entries[w][r]) {
+                postingsByTerm[entry.termId].push_back({entry.docId, entry.count});
+            }
+
+            std::vector<Entry>().swap(entries[w][r]);
+        }
+    });
+}
+
+/*
+-------------------------------------------------
+Function Name : addDocumentCounts()
+
+Objective:
+    Index a document from its term counts.
+
+Input:
+    docId  → Document index.
+    counts → Sorted (termId, count) entries.
+    length → Document token count.
+
+Output:
+    None.
+
+Side Effect:
+    Appends postings and records document length.
+
+Approach:
+    Counts are already one per distinct term, so each entry becomes
+    a posting directly.
+*/
+void InvertedIndex::addDocumentCounts(int docId, const std::vector<TermCount>& counts,
+                                      int length) {
+
+    if (docId >= static_cast<int>(documentLengths.size())) {
+        documentLengths.resize(docId + 1, 0);
+    }
+    documentLengths[docId] = length;
+
+    // Size by the largest ID rather than trusting the order of 'counts'
+    uint32_t largest = 0;
+    for (const auto& entry : counts) {
+        largest = std::max(largest, entry.termId);
+    }
+
+    if (!counts.empty() && largest >= postingsByTerm.size()) {
+        postingsByTerm.resize(static_cast<size_t>(largest) + 1);
+    }
+
+    for (const auto& entry : counts) {
+        postingsByTerm[entry.termId].push_back({docId, static_cast<int>(entry.count)});
+    }
+}
+
+/*
+-------------------------------------------------
+Function Name : getDocumentCounts()
+
+Objective:
+    Rebuild per-document term counts from the postings.
+
+Input:
+    None.
+
+Output:
+    One sorted (termId, count) vector per document.
+
+Side Effect:
+    None.
+
+Approach:
+    Visit terms in increasing ID order and append each posting to
+    its document, so every vector comes out sorted by term ID.
+*/
+std::vector<std::vector<TermCount>> InvertedIndex::getDocumentCounts() const {
+    std::vector<std::vector<TermCount>> counts(documentLengths.size());
+
+    for (size_t termId = 0; termId < postingsByTerm.size(); termId++) {
+        for (const auto& posting : postingsByTerm[termId]) {
+            counts[posting.docId].push_back(
+                {static_cast<uint32_t>(termId), static_cast<uint32_t>(posting.count)});
+        }
+    }
+
+    return counts;
+}
+
+/*
+-------------------------------------------------
+Function Name : documentFrequency()
+
+Objective:
+    Count documents that contain a term.
+
+Input:
+    termId → Term to look up.
+
+Output:
+    Number of documents containing the term.
+
+Side Effect:
+    None.
+
+Approach:
+    Postings hold one entry per document, so DF is the list size.
+*/
+int InvertedIndex::documentFrequency(uint32_t termId) const {
+    if (termId >= postingsByTerm.size()) {
+        return 0;
+    }
+
+    return static_cast<int>(postingsByTerm[termId].size());
+}
+
+/*
+-------------------------------------------------
+Function Name : getPostings()
+
+Objective:
+    Retrieve postings list of a term.
+
+Input:
+    termId → Term to look up.
+
+Output:
+    Reference to postings list (empty if not found).
+
+Side Effect:
+    None.
+
+Approach:
+    Index by term ID and fall back to a shared empty list.
+*/
+const PostingList& InvertedIndex::getPostings(uint32_t termId) const {
+    static const PostingList empty;
+
+    if (termId >= postingsByTerm.size()) {
+        return empty;
+    }
+
+    return postingsByTerm[termId];
+}
+
+/*
+-------------------------------------------------
+Function Name : getAllPostings()
+
+Objective:
+    Expose all postings lists.
+
+Input:
+    None.
+
+Output:
+    Reference to internal postings table.
+
+Side Effect:
+    None.
+
+Approach:
+    Return internal container directly.
+*/
+const std::pmr::vector<PostingList>& InvertedIndex::getAllPostings() const {
+    return postingsByTerm;
+}
+
+/*
+-------------------------------------------------
+Function Name : documentLength()
+
+Objective:
+    Retrieve token count of a document.
+
+Input:
+    docId → Document index.
+
+Output:
+    Number of tokens, or 0 if out of range.
+
+Side Effect:
+    None.
+
+Approach:
+    Check bounds and return stored length.
+*/
+int InvertedIndex::documentLength(int docId) const {
+    if (docId >= 0 && docId < static_cast<int>(documentLengths.size())) {
+        return documentLengths[docId];
+    }
+    return 0;
+}
+
+/*
+-------------------------------------------------
+Function Name : documentCount()
+
+Objective:
+    Retrieve number of indexed documents.
+
+Input:
+    None.
+
+Output:
+    Document count.
+
+Side Effect:
+    None.
+
+Approach:
+    Return size of document length table.
+*/
+int InvertedIndex::documentCount() const {
+    return static_cast<int>(documentLengths.size());
+}
+
+/*
+-------------------------------------------------
+Function Name : termCount()
+
+Objective:
+    Retrieve size of the term table.
+
+Input:
+    None.
+
+Output:
+    One past the largest indexed term ID.
+
+Side Effect:
+    None.
+
+Approach:
+    Return size of postings table.
+*/
+size_t InvertedIndex::termCount() const {
+    return postingsByTerm.size();
+}
@@ -0,0 +1,339 @@
+#ifndef INVERTEDINDEX_H
+#define INVERTEDINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+/*
+    ========================================================================
+                          STRUCT : Posting
+    ========================================================================
+
+    Objective:
+        Record that a term occurs in a document, and how often.
+
+    Input:
+        - docId : index of the document in the corpus.
+        - count : number of occurrences of the term in that document.
+
+    Output:
+        None (plain data holder).
+
+    Side Effects:
+        None.
+*/
+struct Posting {
+    int docId;
+    int count;
+};
+
+// Postings list of one term, allocated from the index arena
+using PostingList = std::pmr::vector<Posting>;
+
+/*
+    ========================================================================
+                          STRUCT : TermCount
+    ========================================================================
+
+    Objective:
+        Record how often a term occurs in one document (one entry of a
+        document's sparse term-frequency vector).
+
+    Input:
+        - termId : TermDictionary ID of the term.
+        - count  : number of occurrences of the term in the document.
+
+    Output:
+        None (plain data holder).
+
+    Side Effects:
+        None.
+*/
+struct TermCount {
+    uint32_t termId;
+    uint32_t count;
+};
+
+/*
+    ========================================================================
+                          CLASS : InvertedIndex
+    ========================================================================
+
+    Objective:
+        Map every term ID of a corpus to the documents that contain it.
+        The index is filled in a single pass over the tokens of each
+        document and provides:
+            - Document frequency (DF) of a term
+            - Postings list (docId, count) of a term
+            - Token count (length) of each document
+
+    Input:
+        - Tokenized documents (TermDictionary IDs), added one at a time.
+
+    Output:
+        - Postings and DF values queried by term ID.
+
+    Side Effects:
+        - None externally.
+        - Postings lists are kept sorted by docId when documents are added
+          in increasing docId order.
+        - All postings lists are allocated from one monotonic arena owned
+          by the index: growing lists cost no malloc per term, and the
+          whole index is released in one shot. Storage abandoned by list
+          growth is only reclaimed then (at most about 2x the postings).
+*/
+
+class InvertedIndex {
+private:
+
+    // Arena backing every postings list (declared first: destroyed last)
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> arena;
+
+    /*
+        Objective:
+            Store postings lists, indexed by term ID.
+
+        Input:
+            Filled by addDocument().
+
+        Output:
+            None.
+
+        Side Effects:
+            Grows to one past the largest term ID seen.
+    */
+    std::pmr::vector<PostingList> postingsByTerm;
+
+    /*
+        Objective:
+            Store the number of tokens in each added document.
+
+        Input:
+            Filled by addDocument(), indexed by docId.
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    std::vector<int> documentLengths;
+
+public:
+
+    /*
+        Objective:
+            Create an empty index with its own arena.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Allocates the arena's first block lazily, on first use.
+    */
+    InvertedIndex();
+
+    // Lists are tied to the owned arena, so the index is not copied or reassigned
+    InvertedIndex(const InvertedIndex&) = delete;
+    InvertedIndex& operator=(const InvertedIndex&) = delete;
+    InvertedIndex(InvertedIndex&&) = default;
+    InvertedIndex& operator=(InvertedIndex&&) = delete;
+
+    /*
+        Objective:
+            Add one tokenized document to the index.
+
+        Input:
+            docId  → index of the document (expected to increase by one
+                     per call, starting at 0).
+            tokens → tokenized document as term IDs.
+
+        Output:
+            None.
+
+        Side Effects:
+            Appends one posting per distinct term of the document and
+            records the document length.
+
+        Approach:
+            Sort a copy of the IDs so equal terms are adjacent, then
+            append (docId, run length) to each term's postings list.
+    */
+    void addDocument(int docId, const std::vector<uint32_t>& tokens);
+
+    /*
+        Objective:
+            Add a batch of tokenized documents on several threads.
+
+        Input:
+            firstDocId  → index of the first document of the batch
+                          (documentCount() to append).
+            docs        → tokenized documents as term IDs; docs[i]
+                          becomes document firstDocId + i.
+            threadCount → worker threads (< 1 = all hardware threads).
+
+        Output:
+            None.
+
+        Side Effects:
+            Same as addDocument() on every document in order: postings
+            lists and document lengths are identical whatever the
+            thread count.
+
+        Approach:
+            - Split the documents into one contiguous range per worker.
+              Each worker counts its documents' terms in a private
+              table and files every (termId, docId, count) entry under
+              one of the contiguous term-ID ranges, one range per
+              worker, so no token is read by more than one worker.
+            - Each range worker sums the document frequencies of its
+              terms; the calling thread then reserves each list to its
+              final size, the only use of the (single-threaded) arena.
+            - Each range worker appends its entries worker by worker,
+              i.e. in document order, so lists stay sorted by docId,
+              every list has a single writer and no locks, atomics or
+              document sorts are needed. Contiguous ranges keep the
+              workers' writes on separate cache lines.
+    */
+    void addDocuments(int firstDocId, const std::vector<std::vector<uint32_t>>& docs,
+                      int threadCount);
+
+    /*
+        Objective:
+            Add one document given as precomputed term counts.
+
+        Input:
+            docId  → index of the document (same rules as addDocument()).
+            counts → (termId, count) entries, sorted by termId, one per
+                     distinct term.
+            length → token count of the document.
+
+        Output:
+            None.
+
+        Side Effects:
+            Appends one posting per entry and records the document length.
+
+        Approach:
+            Used for documents loaded from a CorpusIndex, whose tokens
+            were counted when the index was built.
+    */
+    void addDocumentCounts(int docId, const std::vector<TermCount>& counts, int length);
+
+    /*
+        Objective:
+            Rebuild the per-document term counts (the forward index).
+
+        Input:
+            None.
+
+        Output:
+            One (termId, count) vector per document, sorted by termId.
+
+        Side Effects:
+            None.
+
+        Approach:
+            Walk the postings in term ID order and scatter every posting
+            into its document's vector.
+    */
+    std::vector<std::vector<TermCount>> getDocumentCounts() const;
+
+    /*
+        Objective:
+            Return the number of documents containing a term.
+
+        Input:
+            termId → term to look up.
+
+        Output:
+            Document frequency (0 if the term is unknown).
+
+        Side Effects:
+            None.
+    */
+    int documentFrequency(uint32_t termId) const;
+
+    /*
+        Objective:
+            Return the postings list of a term.
+
+        Input:
+            termId → term to look up.
+
+        Output:
+            Reference to the (docId, count) list, empty if the term is unknown.
+
+        Side Effects:
+            None.
+    */
+    const PostingList& getPostings(uint32_t termId) const;
+
+    /*
+        Objective:
+            Give read access to the whole index, indexed by term ID.
+
+        Input:
+            None.
+
+        Output:
+            Reference to the per-term postings lists.
+
+        Side Effects:
+            None.
+    */
+    const std::pmr::vector<PostingList>& getAllPostings() const;
+
+    /*
+        Objective:
+            Return the number of tokens of a document.
+
+        Input:
+            docId → index of the document.
+
+        Output:
+            Token count (0 if docId is out of range).
+
+        Side Effects:
+            None.
+    */
+    int documentLength(int docId) const;
+
+    /*
+        Objective:
+            Return the number of documents added so far.
+
+        Input:
+            None.
+
+        Output:
+            Document count.
+
+        Side Effects:
+            None.
+    */
+    int documentCount() const;
+
+    /*
+        Objective:
+            Return the size of the term table.
+
+        Input:
+            None.
+
+        Output:
+            One past the largest indexed term ID.
+
+        Side Effects:
+            None.
+    */
+    size_t termCount() const;
+};
+
+#endif // INVERTEDINDEX_H
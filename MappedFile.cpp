@@ -0,0 +1,369 @@
+#include "MappedFile.h"
+#include <fstream>
+#include <utility>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+/*
+-------------------------------------------------
+Function Name : MappedFile (Constructor)
+
+Objective:
+    Open a file on construction.
+
+Input:
+    path → File to open.
+
+Output:
+    MappedFile object initialized.
+
+Side Effect:
+    Maps or reads the file.
+
+Approach:
+    Delegate to open().
+
+    // call open()
+*/
+MappedFile::MappedFile(const std::string& path) {
+    // call open()
+    open(path);
+}
+
+/*
+-------------------------------------------------
+Function Name : ~MappedFile (Destructor)
+
+Objective:
+    Release the mapping.
+
+Input:
+    None.
+
+Output:
+    None.
+
+Side Effect:
+    Unmaps memory and closes handles.
+
+Approach:
+    Delegate to release().
+
+    // call release()
+*/
+MappedFile::~MappedFile() {
+    // call release()
+    release();
+}
+
+/*
+-------------------------------------------------
+Function Name : MappedFile (Move Constructor)
+
+Objective:
+    Transfer ownership of a mapping.
+
+Input:
+    other → Source object.
+
+Output:
+    MappedFile object owning the source's content.
+
+Side Effect:
+    Leaves 'other' empty.
+
+Approach:
+    Steal pointers, handles and buffer, then reset the source.
+*/
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+/*
+-------------------------------------------------
+Function Name : operator= (Move Assignment)
+
+Objective:
+    Transfer ownership of a mapping.
+
+Input:
+    other → Source object.
+
+Output:
+    Reference to this object.
+
+Side Effect:
+    Releases the current content and leaves 'other' empty.
+
+Approach:
+    Release, steal fields, reset the source.
+*/
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+
+    if (this == &other) {
+        return *this;
+    }
+
+    release();
+
+    mappedData = other.mappedData;
+    mappedSize = other.mappedSize;
+#ifdef _WIN32
+    fileHandle = other.fileHandle;
+    mappingHandle = other.mappingHandle;
+    other.fileHandle = nullptr;
+    other.mappingHandle = nullptr;
+#endif
+    buffer = std::move(other.buffer);
+    valid = other.valid;
+
+    other.mappedData = nullptr;
+    other.mappedSize = 0;
+    other.buffer.clear();
+    other.valid = false;
+
+    return *this;
+}
+
+/*
+-------------------------------------------------
+Function Name : open()
+
+Objective:
+    Make a file's content available for reading.
+
+Input:
+    path → File to open.
+
+Output:
+    true on success.
+
+Side Effect:
+    Creates a read-only mapping or fills the buffer.
+
+Approach:
+    Map regular files of at least mapThreshold bytes; use a buffered
+    read for smaller files, non-regular files and failed mappings.
+
+    // call readBuffered()
+*/
+bool MappedFile::open(const std::string& path) {
+
+    release();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || GetFileType(file) != FILE_TYPE_DISK ||
+        static_cast<unsigned long long>(size.QuadPart) < mapThreshold) {
+        CloseHandle(file);
+        // call readBuffered()
+        return readBuffered(path);
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+    if (data == nullptr) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        // call readBuffered()
+        return readBuffered(path);
+    }
+
+    fileHandle = file;
+    mappingHandle = mapping;
+    mappedData = static_cast<const char*>(data);
+    mappedSize = static_cast<size_t>(size.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) ||
+        static_cast<size_t>(info.st_size) < mapThreshold) {
+        ::close(fd);
+        // call readBuffered()
+        return readBuffered(path);
+    }
+
+    void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (data == MAP_FAILED) {
+        // call readBuffered()
+        return readBuffered(path);
+    }
+
+    madvise(data, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+
+    mappedData = static_cast<const char*>(data);
+    mappedSize = static_cast<size_t>(info.st_size);
+#endif
+
+    valid = true;
+    return true;
+}
+
+/*
+-------------------------------------------------
+Function Name : readBuffered()
+
+Objective:
+    Fallback reader for files that are not mapped.
+
+Input:
+    path → File to read.
+
+Output:
+    true on success.
+
+Side Effect:
+    Fills internal buffer.
+
+Approach:
+    Read fixed-size chunks until end of file, which also works for
+    files whose size is unknown in advance.
+*/
+bool MappedFile::readBuffered(const std::string& path) {
+
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file.is_open()) {
+        return false;
+    }
+
+    char chunk[16 * 1024];
+
+    while (file.read(chunk, sizeof(chunk)) || file.gcount() > 0) {
+        buffer.append(chunk, static_cast<size_t>(file.gcount()));
+    }
+
+    valid = true;
+    return true;
+}
+
+/*
+-------------------------------------------------
+Function Name : release()
+
+Objective:
+    Free the current mapping or buffer.
+
+Input:
+    None.
+
+Output:
+    None.
+
+Side Effect:
+    Unmaps memory and closes handles.
+
+Approach:
+    Undo whichever of mapping or buffering open() performed.
+*/
+void MappedFile::release() {
+
+#ifdef _WIN32
+    if (mappedData) UnmapViewOfFile(mappedData);
+    if (mappingHandle) CloseHandle(mappingHandle);
+    if (fileHandle) CloseHandle(fileHandle);
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    if (mappedData) munmap(const_cast<char*>(mappedData), mappedSize);
+#endif
+
+    mappedData = nullptr;
+    mappedSize = 0;
+    buffer.clear();
+    valid = false;
+}
+
+/*
+-------------------------------------------------
+Function Name : view()
+
+Objective:
+    Expose file content.
+
+Input:
+    None.
+
+Output:
+    View of mapped or buffered bytes.
+
+Side Effect:
+    None.
+
+Approach:
+    Prefer the mapping, otherwise view the buffer.
+*/
+std::string_view MappedFile::view() const {
+    if (mappedData) {
+        return std::string_view(mappedData, mappedSize);
+    }
+    return std::string_view(buffer);
+}
+
+/*
+-------------------------------------------------
+Function Name : isMapped()
+
+Objective:
+    Tell whether content is memory-mapped.
+
+Input:
+    None.
+
+Output:
+    true if mapped.
+
+Side Effect:
+    None.
+
+Approach:
+    Check mapping pointer.
+*/
+bool MappedFile::isMapped() const {
+    return mappedData != nullptr;
+}
+
+/*
+-------------------------------------------------
+Function Name : isValid()
+
+Objective:
+    Tell whether a file was opened.
+
+Input:
+    None.
+
+Output:
+    true if content is available.
+
+Side Effect:
+    None.
+
+Approach:
+    Return stored flag.
+*/
+bool MappedFile::isValid() const {
+    return valid;
+}
@@ -0,0 +1,188 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/*
+    ========================================================================
+                            CLASS : MappedFile
+    ========================================================================
+
+    Objective:
+        The MappedFile class gives read-only access to the bytes of a file
+        without copying them into a std::string:
+            - Large regular files are memory-mapped (mmap on POSIX,
+              MapViewOfFile on Windows)
+            - Small files, and files that cannot be mapped (pipes, special
+              or virtual filesystems), are read into an owned buffer
+
+    Input:
+        - Path of the file to open.
+
+    Output:
+        - A std::string_view over the whole file content.
+
+    Side Effects:
+        - Holds the mapping (or buffer) open until destruction.
+        - The view is invalidated when the object is destroyed or moved from.
+*/
+
+class MappedFile {
+private:
+
+    // Files smaller than this are read into 'buffer' instead of mapped
+    static constexpr size_t mapThreshold = 64 * 1024;
+
+    // Start of the mapped region (nullptr when not mapped)
+    const char* mappedData = nullptr;
+
+    // Length of the mapped region in bytes
+    size_t mappedSize = 0;
+
+#ifdef _WIN32
+    // Windows file and file-mapping handles
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+
+    // Owned copy of the content for the buffered fallback
+    std::string buffer;
+
+    // Whether open() succeeded
+    bool valid = false;
+
+    /*
+        Objective:
+            Read a file into 'buffer' with plain buffered I/O.
+
+        Input:
+            path → file to read.
+
+        Output:
+            true on success.
+
+        Side Effects:
+            Fills 'buffer' and sets 'valid'.
+    */
+    bool readBuffered(const std::string& path);
+
+    /*
+        Objective:
+            Release the mapping and any handles.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Resets the object to the empty state.
+    */
+    void release();
+
+public:
+
+    /*
+        Objective:
+            Create an empty (invalid) MappedFile.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    MappedFile() = default;
+
+    /*
+        Objective:
+            Open a file for reading.
+
+        Input:
+            path → file to open.
+
+        Output:
+            None (check isValid()).
+
+        Side Effects:
+            Maps or reads the file.
+    */
+    explicit MappedFile(const std::string& path);
+
+    ~MappedFile();
+
+    // A mapping has a single owner
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /*
+        Objective:
+            Open a file, replacing any previously opened one.
+
+        Input:
+            path → file to open.
+
+        Output:
+            true if the content is available.
+
+        Side Effects:
+            Maps files of at least mapThreshold bytes; falls back to a
+            buffered read for small files or when mapping fails.
+    */
+    bool open(const std::string& path);
+
+    /*
+        Objective:
+            Return the file content.
+
+        Input:
+            None.
+
+        Output:
+            Read-only view of all bytes (empty if not valid).
+
+        Side Effects:
+            None.
+    */
+    std::string_view view() const;
+
+    /*
+        Objective:
+            Report whether the content is memory-mapped.
+
+        Input:
+            None.
+
+        Output:
+            true for a mapping, false for a buffered read or no file.
+
+        Side Effects:
+            None.
+    */
+    bool isMapped() const;
+
+    /*
+        Objective:
+            Report whether open() succeeded.
+
+        Input:
+            None.
+
+        Output:
+            true if the file could be read.
+
+        Side Effects:
+            None.
+    */
+    bool isValid() const;
+};
+
+#endif // MAPPEDFILE_H
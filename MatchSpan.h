@@ -0,0 +1,36 @@
+#ifndef MATCHSPAN_H
+#define MATCHSPAN_H
+
+#include <cstdint>
+
+/*
+    ========================================================================
+                            STRUCT : MatchSpan
+    ========================================================================
+
+    Objective:
+        Represent one passage shared by two documents, as token ranges
+        of their cleaned token streams.
+
+    Input:
+        - begin1, end1 : tokens [begin1, end1) of the first document.
+        - begin2, end2 : tokens [begin2, end2) of the second document.
+
+    Output:
+        None (plain data holder).
+
+    Side Effects:
+        None.
+
+    Notes:
+        Positions count the tokens returned by TextCleaner::preprocess(),
+        i.e. after stopword removal, not characters of the original file.
+*/
+struct MatchSpan {
+    uint32_t begin1;
+    uint32_t end1;
+    uint32_t begin2;
+    uint32_t end2;
+};
+
+#endif // MATCHSPAN_H
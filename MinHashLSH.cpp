@@ -0,0 +1,165 @@
+#include "MinHashLSH.h"
+#include "HashUtils.h"
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+/*
+-------------------------------------------------
+Function Name : MinHashLSH (Constructor)
+
+Objective:
+    Store banding and shingling parameters.
+
+Input:
+    bands       → Number of bands.
+    rows        → Rows per band.
+    shingleSize → Tokens per shingle.
+
+Output:
+    MinHashLSH object initialized.
+
+Side Effect:
+    Clamps parameters to at least 1.
+
+Approach:
+    Assign parameters to member variables.
+*/
+MinHashLSH::MinHashLSH(int bands, int rows, int shingleSize)
+    : bands(std::max(1, bands)),
+      rows(std::max(1, rows)),
+      shingleSize(std::max(1, shingleSize)) {
+}
+
+/*
+-------------------------------------------------
+Function Name : computeSignature()
+
+Objective:
+    Build MinHash signature of a document.
+
+Input:
+    document → Term IDs of the document.
+
+Output:
+    Vector of bands * rows minimum hashes.
+
+Side Effect:
+    None.
+
+Approach:
+    Hash each window of shingleSize tokens (a shorter document forms
+    a single shingle), then take per-slot minima of the remixed hashes.
+*/
+std::vector<uint64_t> MinHashLSH::computeSignature(const std::vector<uint32_t>& document) const {
+
+    std::vector<uint64_t> signature;
+
+    if (document.empty()) {
+        return signature;
+    }
+
+    size_t window = std::min(document.size(), static_cast<size_t>(shingleSize));
+    size_t shingleCount = document.size() - window + 1;
+
+    std::vector<uint64_t> shingles;
+    shingles.reserve(shingleCount);
+
+    for (size_t start = 0; start < shingleCount; start++) {
+        uint64_t hash = 0;
+        for (size_t k = 0; k < window; k++) {
+            hash = combineHash(hash, document[start + k]);
+        }
+        shingles.push_back(hash);
+    }
+
+    // Repeated shingles do not change the minima
+    std::sort(shingles.begin(), shingles.end());
+    shingles.erase(std::unique(shingles.begin(), shingles.end()), shingles.end());
+
+    size_t slots = static_cast<size_t>(bands) * rows;
+    signature.assign(slots, std::numeric_limits<uint64_t>::max());
+
+    for (size_t slot = 0; slot < slots; slot++) {
+        uint64_t seed = mixHash(slot + 1);
+        uint64_t minimum = std::numeric_limits<uint64_t>::max();
+
+        for (uint64_t shingle : shingles) {
+            minimum = std::min(minimum, mixHash(shingle ^ seed));
+        }
+
+        signature[slot] = minimum;
+    }
+
+    return signature;
+}
+
+/*
+-------------------------------------------------
+Function Name : generateCandidates()
+
+Objective:
+    Find document pairs sharing at least one LSH bucket.
+
+Input:
+    documents → Tokenized documents (term IDs).
+
+Output:
+    Sorted unique candidate pairs (doc1 < doc2).
+
+Side Effect:
+    None.
+
+Approach:
+    Compute all signatures, then for each band hash its rows into a
+    bucket key; every pair of documents in the same bucket is a
+    candidate.
+
+    // call computeSignature()
+*/
+std::vector<std::pair<int, int>>
+MinHashLSH::generateCandidates(const std::vector<std::vector<uint32_t>>& documents) const {
+
+    int numDocs = static_cast<int>(documents.size());
+
+    // call computeSignature()
+    std::vector<std::vector<uint64_t>> signatures(numDocs);
+    for (int d = 0; d < numDocs; d++) {
+        signatures[d] = computeSignature(documents[d]);
+    }
+
+    std::vector<std::pair<int, int>> candidates;
+
+    for (int band = 0; band < bands; band++) {
+        std::unordered_map<uint64_t, std::vector<int>> buckets;
+
+        for (int d = 0; d < numDocs; d++) {
+            if (signatures[d].empty()) {
+                continue;
+            }
+
+            uint64_t key = mixHash(static_cast<uint64_t>(band));
+            for (int r = 0; r < rows; r++) {
+                key = combineHash(key, signatures[d][static_cast<size_t>(band) * rows + r]);
+            }
+
+            buckets[key].push_back(d);
+        }
+
+        // Documents are added in increasing order, so a < b within a bucket
+        for (const auto& bucket : buckets) {
+            const std::vector<int>& members = bucket.second;
+
+            for (size_t a = 0; a < members.size(); a++) {
+                for (size_t b = a + 1; b < members.size(); b++) {
+                    candidates.push_back({members[a], members[b]});
+                }
+            }
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    return candidates;
+}
@@ -0,0 +1,110 @@
+#ifndef MINHASHLSH_H
+#define MINHASHLSH_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "CandidateGenerator.h"
+
+/*
+    ========================================================================
+                            CLASS : MinHashLSH
+    ========================================================================
+
+    Objective:
+        The MinHashLSH class is a CandidateGenerator that finds likely
+        near-duplicate documents in roughly linear time:
+            - Each document is turned into a set of token shingles
+              (k consecutive term IDs)
+            - A MinHash signature of (bands x rows) values estimates the
+              Jaccard similarity of two shingle sets
+            - Signatures are cut into bands; documents whose band values
+              all agree land in the same bucket and become candidates
+
+    Input:
+        - bands       : number of LSH bands (more bands = higher recall).
+        - rows        : signature values per band (more rows = fewer
+                        false candidates).
+        - shingleSize : tokens per shingle.
+
+    Output:
+        - Candidate pairs for SimilarityChecker::compareCandidates().
+
+    Side Effects:
+        - None. All computations are performed in-memory.
+
+    Notes:
+        A pair with shingle Jaccard similarity s becomes a candidate with
+        probability 1 - (1 - s^rows)^bands; the steepest point of that
+        curve is near (1 / bands)^(1 / rows).
+*/
+
+class MinHashLSH : public CandidateGenerator {
+private:
+
+    // Number of bands the signature is split into
+    int bands;
+
+    // Signature values per band
+    int rows;
+
+    // Tokens per shingle
+    int shingleSize;
+
+    /*
+        Objective:
+            Compute the MinHash signature of one document.
+
+        Input:
+            document → tokenized document (term IDs).
+
+        Output:
+            bands * rows minimum hash values (empty for empty documents).
+
+        Side Effects:
+            None.
+
+        Approach:
+            Hash every shingle once, then for each signature slot keep the
+            minimum of the shingle hash remixed with that slot's seed.
+    */
+    std::vector<uint64_t> computeSignature(const std::vector<uint32_t>& document) const;
+
+public:
+
+    /*
+        Objective:
+            Configure the LSH banding.
+
+        Input:
+            bands       → number of bands (>= 1).
+            rows        → rows per band (>= 1).
+            shingleSize → tokens per shingle (>= 1).
+
+        Output:
+            None.
+
+        Side Effects:
+            Values below 1 are raised to 1.
+    */
+    MinHashLSH(int bands = 20, int rows = 5, int shingleSize = 3);
+
+    /*
+        Objective:
+            Propose near-duplicate pairs through banded LSH buckets.
+
+        Input:
+            documents → tokenized documents (term IDs).
+
+        Output:
+            Sorted, unique (doc1, doc2) pairs with doc1 < doc2.
+
+        Side Effects:
+            None.
+    */
+    std::vector<std::pair<int, int>>
+    generateCandidates(const std::vector<std::vector<uint32_t>>& documents) const override;
+};
+
+#endif // MINHASHLSH_H
@@ -0,0 +1,538 @@
+#include "NetChannel.h"
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+#else
+    #include <netdb.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <sys/time.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+
+#ifdef _WIN32
+// Winsock must be started once before the first socket call
+bool startSockets() {
+    static bool started = [] {
+        WSADATA data;
+        return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }();
+    return started;
+}
+
+void closeSocket(NetChannel::Handle handle) {
+    closesocket(static_cast<SOCKET>(handle));
+}
+#else
+bool startSockets() {
+    return true;
+}
+
+void closeSocket(NetChannel::Handle handle) {
+    ::close(handle);
+}
+#endif
+
+// Disable Nagle, so small control messages leave at once
+void setNoDelay(NetChannel::Handle handle) {
+    int enabled = 1;
+    setsockopt(handle, IPPROTO_TCP, TCP_NODELAY,
+               reinterpret_cast<const char*>(&enabled), sizeof(enabled));
+}
+
+} // namespace
+
+#ifdef _WIN32
+const NetChannel::Handle NetChannel::invalidHandle = static_cast<NetChannel::Handle>(INVALID_SOCKET);
+#else
+const NetChannel::Handle NetChannel::invalidHandle = -1;
+#endif
+
+/*
+-------------------------------------------------
+Function Name : NetChannel (Constructors)
+
+Objective:
+    Create a closed channel or adopt a connected socket.
+
+Input:
+    handle → Connected socket (optional).
+
+Output:
+    NetChannel object initialized.
+
+Side Effect:
+    None.
+
+Approach:
+    Store the handle.
+*/
+NetChannel::NetChannel() : socketHandle(invalidHandle) {
+}
+
+NetChannel::NetChannel(Handle handle) : socketHandle(handle) {
+}
+
+/*
+-------------------------------------------------
+Function Name : ~NetChannel (Destructor)
+
+Objective:
+    Release the socket.
+
+Input:
+    None.
+
+Output:
+    None.
+
+Side Effect:
+    Closes the connection.
+
+Approach:
+    // call close()
+*/
+NetChannel::~NetChannel() {
+    // call close()
+    close();
+}
+
+/*
+-------------------------------------------------
+Function Name : NetChannel (Move operations)
+
+Objective:
+    Transfer socket ownership.
+
+Input:
+    other → Channel to take the socket from.
+
+Output:
+    This channel, owning the socket.
+
+Side Effect:
+    Leaves other closed; closes this channel's previous socket.
+
+Approach:
+    Swap handles after closing our own.
+*/
+NetChannel::NetChannel(NetChannel&& other) noexcept
+    : socketHandle(std::exchange(other.socketHandle, invalidHandle)) {
+}
+
+NetChannel& NetChannel::operator=(NetChannel&& other) noexcept {
+    if (this != &other) {
+        close();
+        socketHandle = std::exchange(other.socketHandle, invalidHandle);
+    }
+    return *this;
+}
+
+/*
+-------------------------------------------------
+Function Name : connectTo()
+
+Objective:
+    Open a client connection.
+
+Input:
+    host → Host name or address.
+    port → TCP port.
+
+Output:
+    Connected channel, or a closed one.
+
+Side Effect:
+    Resolves the host; opens a socket.
+
+Approach:
+    Try every address getaddrinfo() returns until one connects.
+*/
+NetChannel NetChannel::connectTo(const std::string& host, int port) {
+    if (!startSockets()) {
+        return NetChannel();
+    }
+
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo* addresses = nullptr;
+    if (getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &addresses) != 0) {
+        return NetChannel();
+    }
+
+    Handle connected = invalidHandle;
+
+    for (addrinfo* address = addresses; address; address = address->ai_next) {
+        Handle handle = static_cast<Handle>(
+            socket(address->ai_family, address->ai_socktype, address->ai_protocol));
+
+        if (handle == invalidHandle) {
+            continue;
+        }
+
+        if (::connect(handle, address->ai_addr, static_cast<int>(address->ai_addrlen)) == 0) {
+            connected = handle;
+            break;
+        }
+
+        closeSocket(handle);
+    }
+
+    freeaddrinfo(addresses);
+
+    if (connected != invalidHandle) {
+        setNoDelay(connected);
+    }
+
+    return NetChannel(connected);
+}
+
+/*
+-------------------------------------------------
+Function Name : isOpen() / handle() / close()
+
+Objective:
+    Inspect or end the connection.
+
+Input:
+    None.
+
+Output:
+    Open state / native handle.
+
+Side Effect:
+    close() closes the socket.
+
+Approach:
+    Compare with, or reset to, invalidHandle.
+*/
+bool NetChannel::isOpen() const {
+    return socketHandle != invalidHandle;
+}
+
+NetChannel::Handle NetChannel::handle() const {
+    return socketHandle;
+}
+
+void NetChannel::close() {
+    if (socketHandle != invalidHandle) {
+        closeSocket(socketHandle);
+        socketHandle = invalidHandle;
+    }
+}
+
+/*
+-------------------------------------------------
+Function Name : setReceiveTimeout()
+
+Objective:
+    Bound blocking receives.
+
+Input:
+    seconds → Timeout, 0 for none.
+
+Output:
+    None.
+
+Side Effect:
+    Sets SO_RCVTIMEO.
+
+Approach:
+    Winsock takes milliseconds, BSD sockets a timeval.
+*/
+void NetChannel::setReceiveTimeout(int seconds) {
+    if (!isOpen()) {
+        return;
+    }
+
+#ifdef _WIN32
+    DWORD timeout = static_cast<DWORD>(seconds) * 1000;
+#else
+    timeval timeout;
+    timeout.tv_sec = seconds;
+    timeout.tv_usec = 0;
+#endif
+
+    setsockopt(socketHandle, SOL_SOCKET, SO_RCVTIMEO,
+               reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+}
+
+/*
+-------------------------------------------------
+Function Name : sendAll()
+
+Objective:
+    Send an exact number of bytes.
+
+Input:
+    data  → Bytes to send.
+    bytes → Byte count.
+
+Output:
+    true if everything was sent.
+
+Side Effect:
+    Closes the channel on failure.
+
+Approach:
+    Loop over partial sends; never raise SIGPIPE on a dead peer.
+*/
+bool NetChannel::sendAll(const void* data, size_t bytes) {
+    const char* cursor = static_cast<const char*>(data);
+
+#ifdef MSG_NOSIGNAL
+    const int flags = MSG_NOSIGNAL;
+#else
+    const int flags = 0;
+#endif
+
+    while (bytes > 0 && isOpen()) {
+        int chunk = static_cast<int>(bytes < (1u << 30) ? bytes : (1u << 30));
+        auto sent = ::send(socketHandle, cursor, chunk, flags);
+
+        if (sent <= 0) {
+            close();
+            return false;
+        }
+
+        cursor += sent;
+        bytes -= static_cast<size_t>(sent);
+    }
+
+    return isOpen();
+}
+
+/*
+-------------------------------------------------
+Function Name : receiveAll()
+
+Objective:
+    Receive an exact number of bytes.
+
+Input:
+    data  → Destination buffer.
+    bytes → Byte count.
+
+Output:
+    true if everything arrived.
+
+Side Effect:
+    Closes the channel on error, timeout or end of stream.
+
+Approach:
+    Loop over partial receives.
+*/
+bool NetChannel::receiveAll(void* data, size_t bytes) {
+    char* cursor = static_cast<char*>(data);
+
+    while (bytes > 0 && isOpen()) {
+        int chunk = static_cast<int>(bytes < (1u << 30) ? bytes : (1u << 30));
+        auto received = ::recv(socketHandle, cursor, chunk, 0);
+
+        if (received <= 0) {
+            close();
+            return false;
+        }
+
+        cursor += received;
+        bytes -= static_cast<size_t>(received);
+    }
+
+    return isOpen();
+}
+
+/*
+-------------------------------------------------
+Function Name : NetListener (Constructor / Destructor)
+
+Objective:
+    Manage the listening socket.
+
+Input:
+    None.
+
+Output:
+    NetListener object initialized / released.
+
+Side Effect:
+    The destructor closes the socket.
+
+Approach:
+    Start closed; close if open.
+*/
+NetListener::NetListener() : socketHandle(NetChannel::invalidHandle) {
+}
+
+NetListener::~NetListener() {
+    if (socketHandle != NetChannel::invalidHandle) {
+        closeSocket(socketHandle);
+    }
+}
+
+/*
+-------------------------------------------------
+Function Name : listen()
+
+Objective:
+    Listen on a port of all interfaces.
+
+Input:
+    port → TCP port.
+
+Output:
+    true on success.
+
+Side Effect:
+    Binds the port.
+
+Approach:
+    IPv4 any-address socket with SO_REUSEADDR, so a restarted
+    coordinator can rebind at once.
+*/
+bool NetListener::listen(int port) {
+    if (!startSockets()) {
+        return false;
+    }
+
+    socketHandle = static_cast<NetChannel::Handle>(socket(AF_INET, SOCK_STREAM, 0));
+
+    if (socketHandle == NetChannel::invalidHandle) {
+        return false;
+    }
+
+    int enabled = 1;
+    setsockopt(socketHandle, SOL_SOCKET, SO_REUSEADDR,
+               reinterpret_cast<const char*>(&enabled), sizeof(enabled));
+
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(static_cast<uint16_t>(port));
+
+    if (bind(socketHandle, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(socketHandle, 64) != 0) {
+        closeSocket(socketHandle);
+        socketHandle = NetChannel::invalidHandle;
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-------------------------------------------------
+Function Name : accept()
+
+Objective:
+    Accept one connection.
+
+Input:
+    None.
+
+Output:
+    Connected channel, or a closed one.
+
+Side Effect:
+    Blocks until a peer connects.
+
+Approach:
+    Wrap the accepted socket.
+*/
+NetChannel NetListener::accept() {
+    NetChannel::Handle handle = static_cast<NetChannel::Handle>(
+        ::accept(socketHandle, nullptr, nullptr));
+
+    if (handle == NetChannel::invalidHandle) {
+        return NetChannel();
+    }
+
+    setNoDelay(handle);
+    return NetChannel(handle);
+}
+
+/*
+-------------------------------------------------
+Function Name : handle()
+
+Objective:
+    Expose the listening socket.
+
+Input:
+    None.
+
+Output:
+    Native handle.
+
+Side Effect:
+    None.
+
+Approach:
+    Return the handle.
+*/
+NetChannel::Handle NetListener::handle() const {
+    return socketHandle;
+}
+
+/*
+-------------------------------------------------
+Function Name : waitReadable()
+
+Objective:
+    Wait for readable sockets.
+
+Input:
+    handles   → Sockets to watch.
+    timeoutMs → Longest wait.
+
+Output:
+    One readiness flag per handle.
+
+Side Effect:
+    Blocks up to timeoutMs.
+
+Approach:
+    poll() (WSAPoll() on Windows); hang-ups and errors count as
+    readable so the caller's next receive sees them.
+*/
+std::vector<bool> waitReadable(const std::vector<NetChannel::Handle>& handles, int timeoutMs) {
+    std::vector<bool> ready(handles.size(), false);
+
+#ifdef _WIN32
+    std::vector<WSAPOLLFD> watched(handles.size());
+#else
+    std::vector<pollfd> watched(handles.size());
+#endif
+
+    for (size_t i = 0; i < handles.size(); i++) {
+        watched[i].fd = handles[i];
+        watched[i].events = POLLIN;
+        watched[i].revents = 0;
+    }
+
+#ifdef _WIN32
+    int count = WSAPoll(watched.data(), static_cast<ULONG>(watched.size()), timeoutMs);
+#else
+    int count = poll(watched.data(), static_cast<nfds_t>(watched.size()), timeoutMs);
+#endif
+
+    if (count <= 0) {
+        return ready;
+    }
+
+    for (size_t i = 0; i < handles.size(); i++) {
+        ready[i] = (watched[i].revents & (POLLIN | POLLHUP | POLLERR)) != 0;
+    }
+
+    return ready;
+}
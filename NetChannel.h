@@ -0,0 +1,256 @@
+#ifndef NETCHANNEL_H
+#define NETCHANNEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+    ========================================================================
+                            CLASS : NetChannel
+    ========================================================================
+
+    Objective:
+        Own one connected TCP stream and move raw bytes over it:
+            - connectTo() opens a client connection
+            - NetListener::accept() returns server-side connections
+            - sendAll() / receiveAll() transfer exactly the requested
+              number of bytes or fail
+
+    Input:
+        - Host name and port, or an accepted socket.
+
+    Output:
+        - A connection usable by the tile protocol (TileProtocol.h).
+
+    Side Effects:
+        - Opens and closes sockets.
+
+    Notes:
+        Uses BSD sockets, or Winsock on Windows. The channel is
+        move-only and closes its socket when destroyed.
+*/
+
+class NetChannel {
+public:
+
+    // Native socket handle (SOCKET on Windows, file descriptor elsewhere)
+#ifdef _WIN32
+    using Handle = uintptr_t;
+#else
+    using Handle = int;
+#endif
+
+    // Value of a closed or missing socket
+    static const Handle invalidHandle;
+
+private:
+
+    // Connected socket, or invalidHandle
+    Handle socketHandle;
+
+public:
+
+    /*
+        Objective:
+            Create a closed channel, or wrap a connected socket.
+
+        Input:
+            handle → connected socket to own (optional).
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    NetChannel();
+    explicit NetChannel(Handle handle);
+
+    /*
+        Objective:
+            Close the socket.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Closes the connection if open.
+    */
+    ~NetChannel();
+
+    NetChannel(const NetChannel&) = delete;
+    NetChannel& operator=(const NetChannel&) = delete;
+    NetChannel(NetChannel&& other) noexcept;
+    NetChannel& operator=(NetChannel&& other) noexcept;
+
+    /*
+        Objective:
+            Connect to a listening peer.
+
+        Input:
+            host → host name or address.
+            port → TCP port.
+
+        Output:
+            Connected channel, or a closed one on failure.
+
+        Side Effects:
+            Resolves the host name; opens a socket.
+    */
+    static NetChannel connectTo(const std::string& host, int port);
+
+    /*
+        Objective:
+            Inspect or end the connection.
+
+        Input:
+            None.
+
+        Output:
+            isOpen() : true while the socket is open.
+            handle() : native socket handle.
+
+        Side Effects:
+            close() closes the socket.
+    */
+    bool isOpen() const;
+    Handle handle() const;
+    void close();
+
+    /*
+        Objective:
+            Bound the time a receiveAll() may block.
+
+        Input:
+            seconds → timeout (0 = wait forever).
+
+        Output:
+            None.
+
+        Side Effects:
+            Sets the socket receive timeout.
+    */
+    void setReceiveTimeout(int seconds);
+
+    /*
+        Objective:
+            Transfer an exact number of bytes.
+
+        Input:
+            data  → source / destination buffer.
+            bytes → number of bytes.
+
+        Output:
+            true if all bytes were transferred; false on error, timeout
+            or (for receiveAll()) the peer closing the connection.
+
+        Side Effects:
+            Closes the channel on failure.
+    */
+    bool sendAll(const void* data, size_t bytes);
+    bool receiveAll(void* data, size_t bytes);
+};
+
+/*
+    ========================================================================
+                            CLASS : NetListener
+    ========================================================================
+
+    Objective:
+        Own a listening TCP socket and accept connections from it.
+
+    Input:
+        - Port to listen on (all interfaces).
+
+    Output:
+        - One NetChannel per accepted connection.
+
+    Side Effects:
+        - Binds and closes a socket.
+*/
+
+class NetListener {
+private:
+
+    // Listening socket, or NetChannel::invalidHandle
+    NetChannel::Handle socketHandle;
+
+public:
+
+    NetListener();
+    ~NetListener();
+
+    NetListener(const NetListener&) = delete;
+    NetListener& operator=(const NetListener&) = delete;
+
+    /*
+        Objective:
+            Start listening.
+
+        Input:
+            port → TCP port.
+
+        Output:
+            true on success.
+
+        Side Effects:
+            Binds the port with address reuse enabled.
+    */
+    bool listen(int port);
+
+    /*
+        Objective:
+            Accept one pending connection.
+
+        Input:
+            None.
+
+        Output:
+            Connected channel, or a closed one on failure.
+
+        Side Effects:
+            Blocks until a peer connects; call after waitReadable()
+            reported the listener.
+    */
+    NetChannel accept();
+
+    /*
+        Objective:
+            Return the native socket handle.
+
+        Input:
+            None.
+
+        Output:
+            Handle usable with waitReadable().
+
+        Side Effects:
+            None.
+    */
+    NetChannel::Handle handle() const;
+};
+
+/*
+    Objective:
+        Wait until at least one socket can be read (or accepted) without
+        blocking.
+
+    Input:
+        handles   → sockets to watch.
+        timeoutMs → longest wait in milliseconds.
+
+    Output:
+        One flag per handle, true if it is readable, closed or in error;
+        all false after a timeout.
+
+    Side Effects:
+        Blocks for up to timeoutMs.
+*/
+std::vector<bool> waitReadable(const std::vector<NetChannel::Handle>& handles, int timeoutMs);
+
+#endif // NETCHANNEL_H
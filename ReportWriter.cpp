@@ -1,8 +1,45 @@
 #include "ReportWriter.h"
+#include "BinaryFormat.h"
 #include <fstream>
-#include <iomanip>
 #include <algorithm>
 #include <iostream>
+#include <charconv>
+#include <cstring>
+#include <cstddef>
+
+namespace {
+
+// Marks a binary report; the trailing bytes keep the header 8-byte aligned
+const char resultMagic[8] = {'P', 'L', 'A', 'G', 'R', 'E', 'S', '\0'};
+
+const uint32_t resultFormatVersion = 1;
+
+// Header flag: only pairs above the threshold were written
+const uint32_t flaggedOnlyFlag = 1;
+
+// Fixed-size file header; every offset is in bytes from the file start
+struct ResultHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t documentCount;
+    uint64_t rowCount;
+    uint64_t batchCount;
+    uint64_t nameOffsetsAt;
+    uint64_t nameCharsAt;
+    uint64_t batchesAt;
+    double threshold;
+    uint32_t flags;
+    uint32_t batchRows;
+};
+
+// Leading fields of every batch
+struct BatchHeader {
+    uint32_t rows;
+    uint32_t reserved;
+};
+
+} // namespace
 
 /*
 -------------------------------------------------
@@ -53,6 +90,127 @@ void ReportWriter::setThreshold(double thresh) {
     threshold = thresh;
 }
 
+/*
+-------------------------------------------------
+Function Name : setFlaggedOnly()
+
+Objective:
+    Enable or disable flagged-only reports.
+
+Input:
+    enabled → true to keep only pairs above the threshold.
+
+Output:
+    None.
+
+Side Effect:
+    Modifies internal flag.
+
+Inside Function:
+Approach:
+    Assign new value to flaggedOnly variable.
+*/
+void ReportWriter::setFlaggedOnly(bool enabled) {
+    flaggedOnly = enabled;
+}
+
+/*
+-------------------------------------------------
+Function Name : openSink()
+
+Objective:
+    Create a streaming report in the selected format.
+
+Input:
+    names → Document names by index.
+
+Output:
+    Open sink, or nullptr on failure.
+
+Side Effect:
+    Creates output file; prints an error on failure.
+
+Inside Function:
+Approach:
+    Construct the sink of the selected format with the writer's
+    settings and check that its file opened.
+
+    // call BinaryResultSink() / CsvResultSink()
+*/
+std::unique_ptr<ResultSink> ReportWriter::openSink(const std::vector<std::string>& names) const {
+
+    bool opened = false;
+    std::unique_ptr<ResultSink> sink;
+
+    if (format == ReportFormat::Binary) {
+        // call BinaryResultSink()
+        auto binary = std::make_unique<BinaryResultSink>(outputPath, names, threshold, flaggedOnly);
+        opened = binary->isOpen();
+        sink = std::move(binary);
+    } else {
+        // call CsvResultSink()
+        auto csv = std::make_unique<CsvResultSink>(outputPath, names, threshold, flaggedOnly,
+                                                   matchedSpans);
+        opened = csv->isOpen();
+        sink = std::move(csv);
+    }
+
+    if (!opened) {
+        std::cerr << "Error: Cannot open output file: " << outputPath << std::endl;
+        return nullptr;
+    }
+
+    return sink;
+}
+
+/*
+-------------------------------------------------
+Function Name : setFormat()
+
+Objective:
+    Select the streaming report format.
+
+Input:
+    reportFormat → CSV or binary.
+
+Output:
+    None.
+
+Side Effect:
+    Modifies internal format value.
+
+Inside Function:
+Approach:
+    Assign new value to format variable.
+*/
+void ReportWriter::setFormat(ReportFormat reportFormat) {
+    format = reportFormat;
+}
+
+/*
+-------------------------------------------------
+Function Name : setMatchedSpans()
+
+Objective:
+    Enable or disable the matched span column.
+
+Input:
+    enabled → true to list matched passages.
+
+Output:
+    None.
+
+Side Effect:
+    Modifies internal matchedSpans value.
+
+Inside Function:
+Approach:
+    Assign new value to matchedSpans variable.
+*/
+void ReportWriter::setMatchedSpans(bool enabled) {
+    matchedSpans = enabled;
+}
+
 /*
 -------------------------------------------------
 Function Name : writeCSV()
@@ -72,38 +230,623 @@ Side Effect:
 
 Inside Function:
 Approach:
-    Open file, write header, write each result row, and close file.
+    Open a CSV sink, write each result row, and finish it.
+
+    // call CsvResultSink()
 */
 void ReportWriter::writeCSV(
         const std::vector<std::tuple<std::string, std::string, double>>& results) const {
 
-    std::ofstream file(outputPath);
+    // Rows carry their own names
+    const std::vector<std::string> noNames;
 
-    if (!file.is_open()) {
+    // call CsvResultSink()
+    CsvResultSink sink(outputPath, noNames, threshold, flaggedOnly);
+
+    if (!sink.isOpen()) {
         std::cerr << "Error: Cannot open output file: " << outputPath << std::endl;
         return;
     }
 
-    file << "Student Pair,Similarity Percentage,Plagiarized\n";
-
     for (const auto& result : results) {
+        sink.writeRow(std::get<0>(result), std::get<1>(result), std::get<2>(result));
+    }
+
+    sink.finish();
+}
+
+/*
+-------------------------------------------------
+Function Name : writeCSV() (index overload)
+
+Objective:
+    Generate plagiarism report from index-based results.
 
-        std::string student1 = std::get<0>(result);
-        std::string student2 = std::get<1>(result);
-        double similarity = std::get<2>(result);
+Input:
+    pairs → Vector of (doc1, doc2, score) results.
+    names → Document names by index.
 
-        std::string pair = student1 + " vs " + student2;
+Output:
+    A CSV file written to disk.
 
-        double percentage = similarity * 100.0;
+Side Effect:
+    Writes output file and prints to console.
 
-        std::string plagiarized = (similarity > threshold) ? "Yes" : "No";
+Inside Function:
+Approach:
+    Open a CSV sink, push every pair, and finish it.
 
-        file << std::fixed << std::setprecision(2);
+    // call openSink()
+*/
+void ReportWriter::writeCSV(const std::vector<SimilarityPair>& pairs,
+                            const std::vector<std::string>& names) const {
+
+    // call openSink()
+    std::unique_ptr<ResultSink> sink = openSink(names);
+
+    if (!sink) {
+        return;
+    }
 
-        file << "\"" << pair << "\"," << percentage << "%," << plagiarized << "\n";
+    for (const auto& pair : pairs) {
+        sink->accept(pair.doc1, pair.doc2, pair.score);
     }
 
+    sink->finish();
+}
+
+/*
+-------------------------------------------------
+Function Name : CsvResultSink (Constructor)
+
+Objective:
+    Open a streaming CSV report.
+
+Input:
+    path        → Output CSV file path.
+    docNames    → Document names by index.
+    thresh      → Similarity threshold.
+    flagged     → Keep only flagged rows.
+    spans       → Add the matched span column.
+
+Output:
+    CsvResultSink object initialized.
+
+Side Effect:
+    Creates output file and buffers its header.
+
+Inside Function:
+Approach:
+    Open the file and allocate the row buffer; the header is the
+    first buffered row.
+*/
+CsvResultSink::CsvResultSink(const std::string& path,
+                             const std::vector<std::string>& docNames,
+                             double thresh, bool flagged, bool spans)
+    : outputPath(path), file(path), names(docNames),
+      threshold(thresh), flaggedOnly(flagged), spanColumn(spans), buffer(1 << 20) {
+
+    std::string_view header = spanColumn
+        ? "Student Pair,Similarity Percentage,Plagiarized,Matched Spans\n"
+        : "Student Pair,Similarity Percentage,Plagiarized\n";
+
+    std::memcpy(buffer.data(), header.data(), header.size());
+    used = header.size();
+}
+
+/*
+-------------------------------------------------
+Function Name : ~CsvResultSink (Destructor)
+
+Objective:
+    Complete an unfinished report.
+
+Input:
+    None.
+
+Output:
+    None.
+
+Side Effect:
+    Flushes and closes the file.
+
+Inside Function:
+Approach:
+    Delegate to finish(), which ignores repeated calls.
+
+    // call finish()
+*/
+CsvResultSink::~CsvResultSink() {
+    // call finish()
+    finish();
+}
+
+/*
+-------------------------------------------------
+Function Name : isOpen()
+
+Objective:
+    Check whether the report file is writable.
+
+Input:
+    None.
+
+Output:
+    true if the file is open.
+
+Side Effect:
+    None.
+
+Inside Function:
+Approach:
+    Query the stream.
+*/
+bool CsvResultSink::isOpen() const {
+    return file.is_open();
+}
+
+/*
+-------------------------------------------------
+Function Name : accept()
+
+Objective:
+    Write the row of an index-based pair.
+
+Input:
+    doc1, doc2 → Document indices.
+    score      → Similarity score.
+
+Output:
+    None.
+
+Side Effect:
+    Buffers one CSV line.
+
+Inside Function:
+Approach:
+    Delegate with no passages (an empty span column, if enabled).
+
+    // call acceptMatch()
+*/
+void CsvResultSink::accept(int doc1, int doc2, double score) {
+    // call acceptMatch()
+    acceptMatch(doc1, doc2, score, {});
+}
+
+/*
+-------------------------------------------------
+Function Name : acceptMatch()
+
+Objective:
+    Write the row of an index-based pair with its passages.
+
+Input:
+    doc1, doc2 → Document indices.
+    score      → Similarity score.
+    spans      → Matched passages.
+
+Output:
+    None.
+
+Side Effect:
+    Buffers one CSV line.
+
+Inside Function:
+Approach:
+    Resolve stored names by reference; only missing names build a
+    "Document<index>" placeholder.
+
+    // call writeRow()
+*/
+void CsvResultSink::acceptMatch(int doc1, int doc2, double score,
+                                const std::vector<MatchSpan>& spans) {
+
+    auto hasName = [&](int index) {
+        return index >= 0 && index < static_cast<int>(names.size());
+    };
+
+    if (hasName(doc1) && hasName(doc2)) {
+        // call writeRow()
+        writeRow(names[doc1], names[doc2], score, &spans);
+        return;
+    }
+
+    std::string name1 = hasName(doc1) ? names[doc1] : "Document" + std::to_string(doc1);
+    std::string name2 = hasName(doc2) ? names[doc2] : "Document" + std::to_string(doc2);
+
+    // call writeRow()
+    writeRow(name1, name2, score, &spans);
+}
+
+/*
+-------------------------------------------------
+Function Name : writeRow()
+
+Objective:
+    Format one result as a CSV line.
+
+Input:
+    student1   → First document name.
+    student2   → Second document name.
+    similarity → Similarity score.
+    spans      → Matched passages (optional).
+
+Output:
+    None.
+
+Side Effect:
+    Appends a line to the buffer, flushing it first when full.
+
+Inside Function:
+Approach:
+    Copy the quoted "a vs b" label straight into the buffer, format
+    the percentage with std::to_chars (fixed, two decimals) and
+    append the threshold flag, then the span column if enabled.
+
+    // call flush()
+*/
+void CsvResultSink::writeRow(std::string_view student1, std::string_view student2,
+                             double similarity, const std::vector<MatchSpan>* spans) {
+
+    bool plagiarized = similarity > threshold;
+
+    if (flaggedOnly && !plagiarized) {
+        return;
+    }
+
+    // Label, separators and a percentage of at most a few digits,
+    // plus four 10-digit positions per span
+    size_t spanCount = (spanColumn && spans) ? spans->size() : 0;
+    size_t needed = student1.size() + student2.size() + 64 + spanCount * 48;
+
+    if (buffer.size() - used < needed) {
+        // call flush()
+        flush();
+
+        if (buffer.size() < needed) {
+            buffer.resize(needed);
+        }
+    }
+
+    char* out = buffer.data() + used;
+    char* end = buffer.data() + buffer.size();
+
+    auto append = [&](std::string_view text) {
+        std::memcpy(out, text.data(), text.size());
+        out += text.size();
+    };
+
+    append("\"");
+    append(student1);
+    append(" vs ");
+    append(student2);
+    append("\",");
+
+    out = std::to_chars(out, end, similarity * 100.0, std::chars_format::fixed, 2).ptr;
+
+    append(plagiarized ? "%,Yes" : "%,No");
+
+    if (spanColumn) {
+        append(",");
+
+        for (size_t s = 0; s < spanCount; s++) {
+            const MatchSpan& span = (*spans)[s];
+
+            if (s > 0) append(" ");
+            out = std::to_chars(out, end, span.begin1).ptr;
+            append("-");
+            out = std::to_chars(out, end, span.end1 - 1).ptr;
+            append(":");
+            out = std::to_chars(out, end, span.begin2).ptr;
+            append("-");
+            out = std::to_chars(out, end, span.end2 - 1).ptr;
+        }
+    }
+
+    append("\n");
+
+    used = static_cast<size_t>(out - buffer.data());
+}
+
+/*
+-------------------------------------------------
+Function Name : flush()
+
+Objective:
+    Write buffered rows to disk.
+
+Input:
+    None.
+
+Output:
+    None.
+
+Side Effect:
+    Writes to file; empties the buffer.
+
+Inside Function:
+Approach:
+    One unformatted write of the used part of the buffer.
+*/
+void CsvResultSink::flush() {
+    if (used > 0 && file.is_open()) {
+        file.write(buffer.data(), static_cast<std::streamsize>(used));
+    }
+    used = 0;
+}
+
+/*
+-------------------------------------------------
+Function Name : finish()
+
+Objective:
+    Complete the report.
+
+Input:
+    None.
+
+Output:
+    None.
+
+Side Effect:
+    Closes file and prints to console.
+
+Inside Function:
+Approach:
+    Flush remaining rows and close the file once.
+
+    // call flush()
+*/
+void CsvResultSink::finish() {
+    if (!file.is_open()) {
+        return;
+    }
+
+    // call flush()
+    flush();
+    file.close();
+
+    std::cout << "Report written to: " << outputPath << std::endl;
+}
+
+/*
+-------------------------------------------------
+Function Name : BinaryResultSink (Constructor)
+
+Objective:
+    Open a streaming binary report.
+
+Input:
+    path     → Output file path.
+    docNames → Document names by index.
+    thresh   → Similarity threshold.
+    flagged  → Keep only flagged rows.
+
+Output:
+    BinaryResultSink object initialized.
+
+Side Effect:
+    Creates output file; writes header and name table.
+
+Inside Function:
+Approach:
+    Lay out the header and name sections, write them with zero row
+    and batch counts, and reserve one batch of column storage.
+*/
+BinaryResultSink::BinaryResultSink(const std::string& path,
+                                   const std::vector<std::string>& docNames,
+                                   double thresh, bool flagged)
+    : outputPath(path), file(path, std::ios::binary | std::ios::trunc),
+      threshold(thresh), flaggedOnly(flagged) {
+
+    if (!file.is_open()) {
+        return;
+    }
+
+    std::vector<uint64_t> nameOffsets(docNames.size() + 1, 0);
+    std::string nameChars;
+
+    for (size_t d = 0; d < docNames.size(); d++) {
+        nameChars += docNames[d];
+        nameOffsets[d + 1] = nameChars.size();
+    }
+
+    ResultHeader header = {};
+    std::memcpy(header.magic, resultMagic, sizeof(resultMagic));
+    header.version = resultFormatVersion;
+    header.byteOrder = binaryByteOrderMark;
+    header.documentCount = docNames.size();
+    header.threshold = threshold;
+    header.flags = flaggedOnly ? flaggedOnlyFlag : 0;
+    header.batchRows = static_cast<uint32_t>(batchRows);
+
+    uint64_t at = alignUp(sizeof(ResultHeader));
+    header.nameOffsetsAt = at;  at += alignUp(nameOffsets.size() * sizeof(uint64_t));
+    header.nameCharsAt = at;    at += alignUp(nameChars.size());
+    header.batchesAt = at;
+
+    writeSection(file, &header, sizeof(header));
+    writeSection(file, nameOffsets.data(), nameOffsets.size() * sizeof(uint64_t));
+    writeSection(file, nameChars.data(), nameChars.size());
+
+    doc1Column.reserve(batchRows);
+    doc2Column.reserve(batchRows);
+    scoreColumn.reserve(batchRows);
+}
+
+/*
+-------------------------------------------------
+Function Name : ~BinaryResultSink (Destructor)
+
+Objective:
+    Complete an unfinished report.
+
+Input:
+    None.
+
+Output:
+    None.
+
+Side Effect:
+    Writes pending rows and closes the file.
+
+Inside Function:
+Approach:
+    Delegate to finish(), which ignores repeated calls.
+
+    // call finish()
+*/
+BinaryResultSink::~BinaryResultSink() {
+    // call finish()
+    finish();
+}
+
+/*
+-------------------------------------------------
+Function Name : isOpen()
+
+Objective:
+    Check whether the report file is writable.
+
+Input:
+    None.
+
+Output:
+    true if the file is open.
+
+Side Effect:
+    None.
+
+Inside Function:
+Approach:
+    Query the stream.
+*/
+bool BinaryResultSink::isOpen() const {
+    return file.is_open();
+}
+
+/*
+-------------------------------------------------
+Function Name : accept()
+
+Objective:
+    Buffer one pair as a columnar row.
+
+Input:
+    doc1, doc2 → Document indices.
+    score      → Similarity score.
+
+Output:
+    None.
+
+Side Effect:
+    Writes a batch when the columns are full.
+
+Inside Function:
+Approach:
+    Apply the flagged-only filter, append to the three columns and
+    flush them once batchRows rows are buffered.
+
+    // call writeBatch()
+*/
+void BinaryResultSink::accept(int doc1, int doc2, double score) {
+
+    if (flaggedOnly && !(score > threshold)) {
+        return;
+    }
+
+    doc1Column.push_back(static_cast<uint32_t>(doc1));
+    doc2Column.push_back(static_cast<uint32_t>(doc2));
+    scoreColumn.push_back(static_cast<float>(score));
+
+    if (doc1Column.size() == batchRows) {
+        // call writeBatch()
+        writeBatch();
+    }
+}
+
+/*
+-------------------------------------------------
+Function Name : writeBatch()
+
+Objective:
+    Write buffered columns as one batch.
+
+Input:
+    None.
+
+Output:
+    None.
+
+Side Effect:
+    Writes to file; empties the columns.
+
+Inside Function:
+Approach:
+    Batch header followed by each column as its own aligned section.
+*/
+void BinaryResultSink::writeBatch() {
+
+    if (doc1Column.empty() || !file.is_open()) {
+        return;
+    }
+
+    BatchHeader batch = {static_cast<uint32_t>(doc1Column.size()), 0};
+
+    writeSection(file, &batch, sizeof(batch));
+    writeSection(file, doc1Column.data(), doc1Column.size() * sizeof(uint32_t));
+    writeSection(file, doc2Column.data(), doc2Column.size() * sizeof(uint32_t));
+    writeSection(file, scoreColumn.data(), scoreColumn.size() * sizeof(float));
+
+    rowCount += doc1Column.size();
+    batchCount++;
+
+    doc1Column.clear();
+    doc2Column.clear();
+    scoreColumn.clear();
+}
+
+/*
+-------------------------------------------------
+Function Name : finish()
+
+Objective:
+    Complete the report.
+
+Input:
+    None.
+
+Output:
+    None.
+
+Side Effect:
+    Patches header, closes file and prints to console.
+
+Inside Function:
+Approach:
+    Write the last partial batch, then seek back and overwrite the
+    row and batch counts of the header.
+
+    // call writeBatch()
+*/
+void BinaryResultSink::finish() {
+    if (!file.is_open()) {
+        return;
+    }
+
+    // call writeBatch()
+    writeBatch();
+
+    file.seekp(offsetof(ResultHeader, rowCount));
+    file.write(reinterpret_cast<const char*>(&rowCount), sizeof(rowCount));
+    file.seekp(offsetof(ResultHeader, batchCount));
+    file.write(reinterpret_cast<const char*>(&batchCount), sizeof(batchCount));
     file.close();
 
+    if (!file) {
+        std::cerr << "Error: Cannot write output file: " << outputPath << std::endl;
+        return;
+    }
+
     std::cout << "Report written to: " << outputPath << std::endl;
 }
@@ -1,9 +1,401 @@
 #ifndef REPORTWRITER_H
 #define REPORTWRITER_H
 
+#include <cstdint>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <fstream>
+#include <memory>
+
+#include "SimilarityPair.h"
+#include "ResultSink.h"
+
+/*
+    ========================================================================
+                            CLASS : CsvResultSink
+    ========================================================================
+
+    Objective:
+        Stream scored pairs into a CSV report as they are produced, in
+        the format written by ReportWriter.
+
+    Input:
+        - Output path, document names, plagiarism threshold and whether
+          to keep only flagged pairs.
+        - Pairs pushed through the ResultSink interface.
+
+    Output:
+        - CSV file with one row per accepted pair.
+
+    Side Effects:
+        - Creates or overwrites the file on construction.
+        - Prints the report path once finished.
+
+    Notes:
+        With matched spans enabled, a fourth column lists the passages
+        shared by each pair as "begin1-end1:begin2-end2" token ranges
+        (inclusive), separated by spaces.
+
+        Rows are formatted with std::to_chars into a 1 MB buffer that
+        is written out whenever it fills, so memory stays constant no
+        matter how many pairs are reported.
+*/
+
+class CsvResultSink : public ResultSink {
+private:
+
+    // Destination path, reported once finished
+    std::string outputPath;
+
+    // Output file, open until finish()
+    std::ofstream file;
+
+    // Names by document index (may be empty for name-based rows)
+    const std::vector<std::string>& names;
+
+    // Pairs scoring above the threshold are flagged "Yes"
+    double threshold;
+
+    // Drop pairs that are not flagged
+    bool flaggedOnly;
+
+    // Write the "Matched Spans" column
+    bool spanColumn;
+
+    // Formatted rows not yet written, and the used prefix of it
+    std::vector<char> buffer;
+    size_t used = 0;
+
+    /*
+        Objective:
+            Write buffered rows to the file.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Empties the buffer.
+    */
+    void flush();
+
+public:
+
+    /*
+        Objective:
+            Open the report and write its header.
+
+        Input:
+            path        → output CSV file location.
+            docNames    → names by document index; must outlive the sink.
+            thresh      → plagiarism threshold.
+            flagged     → keep only pairs scoring above thresh.
+            spans       → add the "Matched Spans" column.
+
+        Output:
+            None.
+
+        Side Effects:
+            Creates or overwrites the file; check isOpen().
+    */
+    CsvResultSink(const std::string& path, const std::vector<std::string>& docNames,
+                  double thresh, bool flagged = false, bool spans = false);
+
+    /*
+        Objective:
+            Finish the report if finish() was not called.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Flushes and closes the file.
+    */
+    ~CsvResultSink() override;
+
+    CsvResultSink(const CsvResultSink&) = delete;
+    CsvResultSink& operator=(const CsvResultSink&) = delete;
+
+    /*
+        Objective:
+            Report whether the output file could be opened.
+
+        Input:
+            None.
+
+        Output:
+            true if rows are being written.
+
+        Side Effects:
+            None.
+    */
+    bool isOpen() const;
+
+    /*
+        Objective:
+            Append the row of an index-based pair.
+
+        Input:
+            doc1, doc2 → document indices; missing names are written
+                         as "Document<index>".
+            score      → similarity from 0.0 to 1.0.
+
+        Output:
+            None.
+
+        Side Effects:
+            Buffers one row (unless filtered out).
+    */
+    void accept(int doc1, int doc2, double score) override;
+
+    /*
+        Objective:
+            Append the row of an index-based pair with its passages.
+
+        Input:
+            doc1, doc2 → document indices.
+            score      → similarity from 0.0 to 1.0.
+            spans      → matched passages (written only with the span
+                         column enabled).
+
+        Output:
+            None.
+
+        Side Effects:
+            Buffers one row (unless filtered out).
+    */
+    void acceptMatch(int doc1, int doc2, double score,
+                     const std::vector<MatchSpan>& spans) override;
+
+    /*
+        Objective:
+            Append the row of a named pair.
+
+        Input:
+            student1, student2 → document names.
+            similarity         → score from 0.0 to 1.0.
+            spans              → matched passages, or nullptr for an
+                                 empty span column.
+
+        Output:
+            None.
+
+        Side Effects:
+            Buffers one row (unless filtered out).
+    */
+    void writeRow(std::string_view student1, std::string_view student2, double similarity,
+                  const std::vector<MatchSpan>* spans = nullptr);
+
+    /*
+        Objective:
+            Complete the report.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Flushes, closes the file and prints its path; later calls
+            do nothing.
+    */
+    void finish() override;
+};
+
+/*
+    ========================================================================
+                          CLASS : BinaryResultSink
+    ========================================================================
+
+    Objective:
+        Stream scored pairs into a compact columnar binary report that
+        downstream tools can map into memory instead of parsing text.
+
+    Input:
+        - Output path, document names, plagiarism threshold and whether
+          to keep only flagged pairs.
+        - Pairs pushed through the ResultSink interface.
+
+    Output:
+        - Binary report file (format below).
+
+    Side Effects:
+        - Creates or overwrites the file on construction.
+        - Prints the report path once finished.
+
+    File Format (version 1, native byte order, every section 8-byte aligned):
+        header        magic "PLAGRES", version, byte-order mark, document,
+                      row and batch counts, section offsets, threshold,
+                      flags (bit 0: flagged only) and rows per batch
+        nameOffsets   uint64[docs + 1]    name d = nameChars[off[d], off[d+1])
+        nameChars     concatenated document names
+        batches       repeated until batchCount:
+                          uint32 rows, uint32 reserved (0)
+                          uint32 doc1[rows]   (doc1 < doc2)
+                          uint32 doc2[rows]
+                          float  score[rows]  (0.0 to 1.0)
+                      each column padded to 8 bytes
+
+    Notes:
+        - Rows are 12 bytes instead of ~40 for CSV, and names are stored
+          once. Each batch column is a contiguous, aligned array, the
+          buffer layout of an Arrow record batch: numpy.memmap or
+          arrow::Buffer can wrap it without copying.
+        - Row and batch counts are written when the report is finished;
+          a file with batchCount 0 and data after the names was cut short.
+        - Flags are derived as score > threshold, as in the CSV report.
+*/
+
+class BinaryResultSink : public ResultSink {
+private:
+
+    // Destination path, reported once finished
+    std::string outputPath;
+
+    // Output file, open until finish()
+    std::ofstream file;
+
+    // Rows buffered per batch before they are written
+    static constexpr size_t batchRows = 65536;
+
+    // Pairs scoring above the threshold are flagged
+    double threshold;
+
+    // Drop pairs that are not flagged
+    bool flaggedOnly;
+
+    // Columns of the batch being filled
+    std::vector<uint32_t> doc1Column;
+    std::vector<uint32_t> doc2Column;
+    std::vector<float> scoreColumn;
+
+    // Totals, patched into the header by finish()
+    uint64_t rowCount = 0;
+    uint64_t batchCount = 0;
+
+    /*
+        Objective:
+            Write the buffered columns as one batch.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Empties the columns.
+    */
+    void writeBatch();
+
+public:
+
+    /*
+        Objective:
+            Open the report and write its header and name table.
+
+        Input:
+            path     → output file location.
+            docNames → names by document index.
+            thresh   → plagiarism threshold.
+            flagged  → keep only pairs scoring above thresh.
+
+        Output:
+            None.
+
+        Side Effects:
+            Creates or overwrites the file; check isOpen().
+    */
+    BinaryResultSink(const std::string& path, const std::vector<std::string>& docNames,
+                     double thresh, bool flagged = false);
+
+    /*
+        Objective:
+            Finish the report if finish() was not called.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Writes the last batch and the counts, closes the file.
+    */
+    ~BinaryResultSink() override;
+
+    BinaryResultSink(const BinaryResultSink&) = delete;
+    BinaryResultSink& operator=(const BinaryResultSink&) = delete;
+
+    /*
+        Objective:
+            Report whether the output file could be opened.
+
+        Input:
+            None.
+
+        Output:
+            true if rows are being written.
+
+        Side Effects:
+            None.
+    */
+    bool isOpen() const;
+
+    /*
+        Objective:
+            Append one pair.
+
+        Input:
+            doc1, doc2 → document indices.
+            score      → similarity from 0.0 to 1.0, stored as float.
+
+        Output:
+            None.
+
+        Side Effects:
+            Buffers the row (unless filtered out); writes a batch when
+            the buffer is full.
+    */
+    void accept(int doc1, int doc2, double score) override;
+
+    /*
+        Objective:
+            Complete the report.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Writes the last batch, patches the header counts, closes
+            the file and prints its path; later calls do nothing.
+    */
+    void finish() override;
+};
+
+/*
+    Objective:
+        Select the file format produced by ReportWriter::openSink().
+
+    Values:
+        CSV    → text rows (CsvResultSink), the default.
+        Binary → columnar binary batches (BinaryResultSink).
+*/
+enum class ReportFormat {
+    CSV,
+    Binary
+};
 
 /*
     ========================================================================
@@ -25,6 +417,9 @@
         - A CSV file stored at 'outputPath'.
         - Each row includes:
               Student Pair, Similarity %, "Plagiarized" flag.
+        - Streaming sinks (CsvResultSink) that write the same rows while
+          results are still being computed, or columnar binary reports
+          (BinaryResultSink) selected with setFormat().
 
     Side Effects:
         - Creates or overwrites a CSV file on disk.
@@ -67,6 +462,51 @@ private:
     */
     double threshold;
 
+    /*
+        Objective:
+            Keep only pairs above the threshold in reports.
+
+        Input:
+            Set via setFlaggedOnly().
+
+        Output:
+            None.
+
+        Side Effects:
+            Affects writeCSV() and openSink().
+    */
+    bool flaggedOnly = false;
+
+    /*
+        Objective:
+            Select the file format of streaming reports.
+
+        Input:
+            Set via setFormat().
+
+        Output:
+            None.
+
+        Side Effects:
+            Affects openSink(); writeCSV() always writes CSV.
+    */
+    ReportFormat format = ReportFormat::CSV;
+
+    /*
+        Objective:
+            Add the matched passages of each pair to CSV reports.
+
+        Input:
+            Set via setMatchedSpans().
+
+        Output:
+            None.
+
+        Side Effects:
+            Affects openSink().
+    */
+    bool matchedSpans = false;
+
 public:
 
     /*
@@ -106,6 +546,91 @@ public:
     */
     void writeCSV(const std::vector<std::tuple<std::string, std::string, double>>& results) const;
 
+    /*
+        Objective:
+            Write index-based similarity results into a CSV file.
+
+        Input:
+            pairs : (doc1, doc2, score) results, e.g. from a pruned search.
+            names : document names indexed by document number.
+
+        Output:
+            Creates a formatted CSV file at outputPath, in the same
+            format as the tuple overload.
+
+        Side Effects:
+            - Writes to file system.
+            - Overwrites existing file with same name.
+            - Prints success or error messages to console.
+    */
+    void writeCSV(const std::vector<SimilarityPair>& pairs,
+                  const std::vector<std::string>& names) const;
+
+    /*
+        Objective:
+            Open a streaming report for results pushed by
+            SimilarityChecker.
+
+        Input:
+            names : document names indexed by document number; must
+                    outlive the returned sink.
+
+        Output:
+            Sink writing the selected format (CSV rows as written by
+            writeCSV(), or binary batches), or nullptr if the output
+            file cannot be opened.
+
+        Side Effects:
+            - Creates or overwrites the output file.
+            - Prints an error message on failure.
+    */
+    std::unique_ptr<ResultSink> openSink(const std::vector<std::string>& names) const;
+
+    /*
+        Objective:
+            Choose whether reports keep only flagged pairs.
+
+        Input:
+            enabled : true to drop pairs at or below the threshold.
+
+        Output:
+            None.
+
+        Side Effects:
+            Modifies internal state.
+    */
+    void setFlaggedOnly(bool enabled);
+
+    /*
+        Objective:
+            Choose the file format of streaming reports.
+
+        Input:
+            reportFormat : ReportFormat::CSV or ReportFormat::Binary.
+
+        Output:
+            None.
+
+        Side Effects:
+            Modifies internal state.
+    */
+    void setFormat(ReportFormat reportFormat);
+
+    /*
+        Objective:
+            Choose whether CSV reports list matched passages.
+
+        Input:
+            enabled : true to add the "Matched Spans" column.
+
+        Output:
+            None.
+
+        Side Effects:
+            Modifies internal state.
+    */
+    void setMatchedSpans(bool enabled);
+
     /*
         Objective:
             Update the plagiarism threshold used during report writing.
@@ -0,0 +1,684 @@
+#include "ResultCache.h"
+#include "SimilarityChecker.h"
+#include "HashUtils.h"
+#include "BinaryFormat.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+namespace {
+
+// Marks a cache file; the trailing bytes keep the header 8-byte aligned
+const char cacheMagic[8] = {'P', 'L', 'A', 'G', 'R', 'C', '\0', '\0'};
+
+// Fixed-size file header; every offset is in bytes from the file start
+struct CacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t config;
+    uint64_t documentCount;
+    uint64_t termCount;
+    uint64_t vectorEntryCount;
+    uint64_t scoreCount;
+    uint64_t termOffsetsAt;
+    uint64_t termCharsAt;
+    uint64_t hashesAt;
+    uint64_t vectorOffsetsAt;
+    uint64_t vectorsAt;
+    uint64_t driftAt;
+    uint64_t scoresAt;
+    uint64_t rowOffsetsAt;
+    uint64_t fileSize;
+};
+
+} // namespace
+
+/*
+-------------------------------------------------
+Function Name : ResultCache (Constructor)
+
+Objective:
+    Store the configuration hash.
+
+Input:
+    configHash → Hash of the current settings.
+
+Output:
+    Empty ResultCache object.
+
+Side Effect:
+    None.
+
+Approach:
+    Assign parameter to member variable.
+*/
+ResultCache::ResultCache(uint64_t configHash) : config(configHash) {
+}
+
+/*
+-------------------------------------------------
+Function Name : configurationHash()
+
+Objective:
+    Hash the settings that cached scores depend on.
+
+Input:
+    hashBits       → Feature hashing bits.
+    stopWordDigest → Digest of the stopword list.
+
+Output:
+    Configuration hash.
+
+Side Effect:
+    None.
+
+Approach:
+    Combine the format version with the feature settings.
+
+    // call combineHash()
+*/
+uint64_t ResultCache::configurationHash(int hashBits, uint64_t stopWordDigest) {
+    // call combineHash()
+    return combineHash(combineHash(formatVersion, static_cast<uint64_t>(hashBits)),
+                       stopWordDigest);
+}
+
+/*
+-------------------------------------------------
+Function Name : load()
+
+Objective:
+    Open and validate a cache file.
+
+Input:
+    path → Cache file.
+
+Output:
+    true if the cache is usable.
+
+Side Effect:
+    Maps the file; sets section views.
+
+Approach:
+    Validate the header and section bounds, point the views into
+    the mapping, then check offset tables, term IDs, drifts and
+    score rows so that no lookup can read outside the file.
+
+    // call MappedFile::open()
+*/
+bool ResultCache::load(const std::string& path) {
+
+    reset();
+
+    // call MappedFile::open()
+    if (!file.open(path)) {
+        return false;
+    }
+
+    std::string_view bytes = file.view();
+
+    if (bytes.size() < sizeof(CacheHeader)) {
+        reset();
+        return false;
+    }
+
+    CacheHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, cacheMagic, sizeof(cacheMagic)) != 0 ||
+        header.version != formatVersion ||
+        header.byteOrder != binaryByteOrderMark ||
+        header.config != config ||
+        header.fileSize != bytes.size()) {
+        reset();
+        return false;
+    }
+
+    uint64_t size = header.fileSize;
+    uint64_t docs = header.documentCount;
+    uint64_t termTotal = header.termCount;
+
+    // Reject counts large enough to overflow the size arithmetic below
+    if (docs >= size || termTotal >= size || header.vectorEntryCount >= size ||
+        header.scoreCount >= size) {
+        reset();
+        return false;
+    }
+
+    bool fits =
+        sectionFits(header.termOffsetsAt, (termTotal + 1) * sizeof(uint64_t), size) &&
+        sectionFits(header.termCharsAt, 0, size) &&
+        sectionFits(header.hashesAt, docs * sizeof(uint64_t), size) &&
+        sectionFits(header.vectorOffsetsAt, (docs + 1) * sizeof(uint64_t), size) &&
+        sectionFits(header.vectorsAt, header.vectorEntryCount * sizeof(SparseEntry), size) &&
+        sectionFits(header.driftAt, docs * sizeof(double), size) &&
+        sectionFits(header.scoresAt, header.scoreCount * sizeof(CachedScore), size) &&
+        sectionFits(header.rowOffsetsAt, (docs + 1) * sizeof(uint64_t), size);
+
+    if (!fits) {
+        reset();
+        return false;
+    }
+
+    const char* base = bytes.data();
+    termOffsets = reinterpret_cast<const uint64_t*>(base + header.termOffsetsAt);
+    termChars = base + header.termCharsAt;
+    hashes = reinterpret_cast<const uint64_t*>(base + header.hashesAt);
+    vectorOffsets = reinterpret_cast<const uint64_t*>(base + header.vectorOffsetsAt);
+    vectors = reinterpret_cast<const SparseEntry*>(base + header.vectorsAt);
+    drifts = reinterpret_cast<const double*>(base + header.driftAt);
+    scores = reinterpret_cast<const CachedScore*>(base + header.scoresAt);
+    rowOffsets = reinterpret_cast<const uint64_t*>(base + header.rowOffsetsAt);
+
+    terms = static_cast<size_t>(termTotal);
+    docCount = static_cast<size_t>(docs);
+
+    bool consistent =
+        offsetsValid(termOffsets, terms, termOffsets[terms]) &&
+        sectionFits(header.termCharsAt, termOffsets[terms], size) &&
+        offsetsValid(vectorOffsets, docCount, header.vectorEntryCount) &&
+        offsetsValid(rowOffsets, docCount, header.scoreCount);
+
+    // Without stored terms the IDs are feature IDs and need no check
+    for (uint64_t e = 0; consistent && terms > 0 && e < header.vectorEntryCount; e++) {
+        consistent = vectors[e].termId < terms;
+    }
+
+    for (size_t d = 0; consistent && d < docCount; d++) {
+        consistent = std::isfinite(drifts[d]) && drifts[d] >= 0.0;
+    }
+
+    // Columns of a row lie above it and ascend, for cachedScore()
+    for (size_t i = 0; consistent && i < docCount; i++) {
+        uint64_t previous = i;
+
+        for (uint64_t s = rowOffsets[i]; consistent && s < rowOffsets[i + 1]; s++) {
+            consistent = scores[s].doc > previous && scores[s].doc < docCount;
+            previous = scores[s].doc;
+        }
+    }
+
+    if (!consistent) {
+        reset();
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-------------------------------------------------
+Function Name : reset()
+
+Objective:
+    Return to the empty state.
+
+Input:
+    None.
+
+Output:
+    None.
+
+Side Effect:
+    Releases the file and clears views.
+
+Approach:
+    Replace the mapping with an empty one and null every pointer.
+*/
+void ResultCache::reset() {
+    file = MappedFile();
+    docCount = 0;
+    terms = 0;
+    termOffsets = nullptr;
+    termChars = nullptr;
+    hashes = nullptr;
+    vectorOffsets = nullptr;
+    vectors = nullptr;
+    drifts = nullptr;
+    rowOffsets = nullptr;
+    scores = nullptr;
+}
+
+/*
+-------------------------------------------------
+Function Name : documentCount()
+
+Objective:
+    Retrieve number of cached documents.
+
+Input:
+    None.
+
+Output:
+    Document count.
+
+Side Effect:
+    None.
+
+Approach:
+    Return count read from the header.
+*/
+size_t ResultCache::documentCount() const {
+    return docCount;
+}
+
+/*
+-------------------------------------------------
+Function Name : cachedScore()
+
+Objective:
+    Find one cached pair score.
+
+Input:
+    row → Cached document.
+    col → Cached document above row.
+
+Output:
+    Stored score, or 0.0.
+
+Side Effect:
+    None.
+
+Approach:
+    Binary search the row's columns.
+*/
+double ResultCache::cachedScore(size_t row, size_t col) const {
+    const CachedScore* first = scores + rowOffsets[row];
+    const CachedScore* last = scores + rowOffsets[row + 1];
+
+    const CachedScore* found = std::lower_bound(
+        first, last, col, [](const CachedScore& s, size_t doc) { return s.doc < doc; });
+
+    return (found != last && found->doc == col) ? found->score : 0.0;
+}
+
+/*
+-------------------------------------------------
+Function Name : compareAll()
+
+Objective:
+    Report all pairs, rescoring only what changed, and save the new
+    cache.
+
+Input:
+    checker       → Checker of the current run.
+    contentHashes → Content hash per document.
+    dictionary    → Term dictionary (nullptr with hashed features).
+    buckets       → Hash bucket of every column (nullptr without).
+    threshold     → Reporting threshold.
+    tolerance     → Bound on the error of a reused score.
+    threadCount   → Number of worker threads.
+    sink          → Result consumer.
+    path          → Destination of the new cache.
+
+Output:
+    true if the new cache was written.
+
+Side Effect:
+    Uses worker threads; calls the sink; replaces the cache file.
+
+Approach:
+    Match documents by content hash (each cached document at most
+    once) and map cached term IDs to current ones by term, or by hash
+    bucket, as vectors are cached by bucket. A matched
+    document's drift is the drift its cached scores already carry
+    plus the distance its unit vector moved; it is clean if that is
+    at most tolerance / 2, so a reused score is off by at most the
+    tolerance. Clean documents keep their drift in the new cache,
+    rescored ones start again at 0. Rows of the other documents are scored against all
+    documents up front; if they are too many, every row is scored
+    while streaming instead. Rows are then emitted in order: a score
+    comes from a fresh row (either document's), or from the cache,
+    rescored when it lies within its bound of the threshold. Every
+    row also goes to the new cache file, written after the vectors.
+
+    // call SimilarityChecker::compareRows()
+    // call SimilarityChecker::compareBlock()
+    // call cachedScore()
+*/
+bool ResultCache::compareAll(const SimilarityChecker& checker,
+                             const std::vector<uint64_t>& contentHashes,
+                             const TermDictionary* dictionary,
+                             const std::vector<uint32_t>* buckets, double threshold,
+                             double tolerance, int threadCount, ResultSink& sink,
+                             const std::string& path) {
+
+    int n = checker.documentCount();
+
+    reusedDocuments = 0;
+    reusedPairs = 0;
+    rescoredPairs = 0;
+
+    // Match documents to cached ones by content
+    std::unordered_map<uint64_t, size_t> cachedByHash;
+    for (size_t c = docCount; c-- > 0;) {
+        cachedByHash[hashes[c]] = c;
+    }
+
+    std::vector<long> cachedOf(n, -1);
+    std::vector<int> currentOf(docCount, -1);
+
+    for (int i = 0; i < n; i++) {
+        auto found = cachedByHash.find(contentHashes[i]);
+
+        if (found != cachedByHash.end() && currentOf[found->second] < 0) {
+            cachedOf[i] = static_cast<long>(found->second);
+            currentOf[found->second] = i;
+        }
+    }
+
+    // Cached term IDs in the current ID space
+    size_t space = 0;
+    for (int i = 0; i < n; i++) {
+        const SparseVector& vector = checker.getVector(i);
+        if (!vector.empty()) {
+            space = std::max(space, static_cast<size_t>(vector.back().termId) + 1);
+        }
+    }
+
+    std::vector<uint32_t> termMap;
+    if (dictionary) {
+        termMap.resize(terms);
+        for (size_t t = 0; t < terms; t++) {
+            termMap[t] = dictionary->find(std::string_view(
+                termChars + termOffsets[t], termOffsets[t + 1] - termOffsets[t]));
+        }
+    }
+
+    std::unordered_map<uint32_t, uint32_t> columnOfBucket;
+    if (buckets) {
+        for (size_t column = 0; column < buckets->size(); column++) {
+            columnOfBucket[(*buckets)[column]] = static_cast<uint32_t>(column);
+        }
+    }
+
+    auto currentTerm = [&](uint32_t cachedTerm) {
+        if (dictionary) {
+            return termMap[cachedTerm];
+        }
+
+        if (buckets) {
+            auto found = columnOfBucket.find(cachedTerm);
+            return found != columnOfBucket.end() ? found->second
+                                                 : static_cast<uint32_t>(space);
+        }
+
+        return cachedTerm;
+    };
+
+    // Bound on how far each matched vector is from the vectors its
+    // cached scores were computed from; the rest are dirty
+    std::vector<double> drift(n, 0.0);
+    std::vector<double> scatter(space, 0.0);
+    std::vector<int> dirtyRows;
+
+    for (int i = 0; i < n; i++) {
+        if (cachedOf[i] < 0) {
+            dirtyRows.push_back(i);
+            continue;
+        }
+
+        const SparseVector& current = checker.getVector(i);
+        for (const auto& entry : current) {
+            scatter[entry.termId] = entry.weight;
+        }
+
+        double sum = 0.0;
+        size_t c = static_cast<size_t>(cachedOf[i]);
+
+        for (uint64_t e = vectorOffsets[c]; e < vectorOffsets[c + 1]; e++) {
+            uint32_t term = currentTerm(vectors[e].termId);
+
+            if (term < space) {
+                double difference = scatter[term] - vectors[e].weight;
+                sum += difference * difference;
+                scatter[term] = 0.0;
+            } else {
+                sum += vectors[e].weight * vectors[e].weight;
+            }
+        }
+
+        for (const auto& entry : current) {
+            sum += scatter[entry.termId] * scatter[entry.termId];
+            scatter[entry.termId] = 0.0;
+        }
+
+        drift[i] = drifts[c] + std::sqrt(sum);
+
+        if (drift[i] > tolerance / 2) {
+            dirtyRows.push_back(i);
+        }
+    }
+
+    std::sort(dirtyRows.begin(), dirtyRows.end());
+
+    bool scoreEverything = dirtyRows.size() * 2 > static_cast<size_t>(n) ||
+                           dirtyRows.size() * static_cast<size_t>(n) > maxFreshCells;
+
+    if (scoreEverything) {
+        dirtyRows.clear();
+    } else {
+        reusedDocuments = static_cast<size_t>(n) - dirtyRows.size();
+    }
+
+    // Rows of the dirty documents, against every document
+    std::vector<long> freshOf(n, -1);
+    std::vector<double> fresh;
+
+    for (size_t k = 0; k < dirtyRows.size(); k++) {
+        freshOf[dirtyRows[k]] = static_cast<long>(k);
+    }
+
+    if (!dirtyRows.empty()) {
+        fresh.resize(dirtyRows.size() * static_cast<size_t>(n));
+
+        // call SimilarityChecker::compareRows()
+        checker.compareRows(dirtyRows, threadCount,
+                            [&](int bandBegin, int bandEnd, const double* band) {
+            std::copy(band, band + static_cast<size_t>(bandEnd - bandBegin) * n,
+                      fresh.begin() + static_cast<size_t>(bandBegin) * n);
+        });
+    }
+
+    // New cache: everything but the scores is known up front
+    std::vector<uint64_t> termOffsetTable{0};
+    std::string termBytes;
+
+    if (dictionary) {
+        for (size_t t = 0; t < dictionary->size(); t++) {
+            termBytes += dictionary->getTerm(static_cast<uint32_t>(t));
+            termOffsetTable.push_back(termBytes.size());
+        }
+    }
+
+    std::vector<uint64_t> vectorOffsetTable(n + 1, 0);
+    std::vector<SparseEntry> vectorTable;
+
+    for (int i = 0; i < n; i++) {
+        for (const auto& entry : checker.getVector(i)) {
+            vectorTable.push_back({buckets ? (*buckets)[entry.termId] : entry.termId,
+                                   entry.weight});
+        }
+
+        vectorOffsetTable[i + 1] = vectorTable.size();
+    }
+
+    CacheHeader header = {};
+    std::memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+    header.version = formatVersion;
+    header.byteOrder = binaryByteOrderMark;
+    header.config = config;
+    header.documentCount = static_cast<uint64_t>(n);
+    header.termCount = termOffsetTable.size() - 1;
+    header.vectorEntryCount = vectorTable.size();
+
+    uint64_t at = alignUp(sizeof(CacheHeader));
+    header.termOffsetsAt = at;    at += alignUp(termOffsetTable.size() * sizeof(uint64_t));
+    header.termCharsAt = at;      at += alignUp(termBytes.size());
+    header.hashesAt = at;         at += alignUp(static_cast<size_t>(n) * sizeof(uint64_t));
+    header.vectorOffsetsAt = at;  at += alignUp(vectorOffsetTable.size() * sizeof(uint64_t));
+    header.vectorsAt = at;        at += alignUp(vectorTable.size() * sizeof(SparseEntry));
+    header.driftAt = at;          at += alignUp(static_cast<size_t>(n) * sizeof(double));
+    header.scoresAt = at;
+
+    std::string tempPath = path + ".tmp";
+    std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+
+    writeSection(out, &header, sizeof(header));
+    writeSection(out, termOffsetTable.data(), termOffsetTable.size() * sizeof(uint64_t));
+    writeSection(out, termBytes.data(), termBytes.size());
+    writeSection(out, contentHashes.data(), static_cast<size_t>(n) * sizeof(uint64_t));
+    writeSection(out, vectorOffsetTable.data(), vectorOffsetTable.size() * sizeof(uint64_t));
+    writeSection(out, vectorTable.data(), vectorTable.size() * sizeof(SparseEntry));
+
+    std::vector<SparseEntry>().swap(vectorTable);
+
+    // Every score of a fresh row was computed from the current vectors
+    std::vector<double> driftTable(n, 0.0);
+
+    for (int i = 0; i < n; i++) {
+        if (!scoreEverything && freshOf[i] < 0) {
+            driftTable[i] = drift[i];
+        }
+    }
+
+    writeSection(out, driftTable.data(), static_cast<size_t>(n) * sizeof(double));
+
+    std::vector<uint64_t> rowOffsetTable(n + 1, 0);
+    std::vector<CachedScore> rowScores;
+    std::vector<double> cachedRow(n, 0.0);
+
+    // Report row i and append it to the new cache. freshRow holds its
+    // scores against all documents, or nullptr for a clean document.
+    auto emitRow = [&](int i, const double* freshRow) {
+        rowScores.clear();
+
+        auto put = [&](int j, double score) {
+            sink.accept(i, j, score);
+
+            if (score != 0.0) {
+                rowScores.push_back({static_cast<uint32_t>(j), 0, score});
+            }
+        };
+
+        if (freshRow) {
+            for (int j = i + 1; j < n; j++) {
+                put(j, freshRow[j]);
+            }
+            rescoredPairs += static_cast<size_t>(n - i - 1);
+        } else {
+            size_t c = static_cast<size_t>(cachedOf[i]);
+
+            for (uint64_t s = rowOffsets[c]; s < rowOffsets[c + 1]; s++) {
+                int j = currentOf[scores[s].doc];
+                if (j > i && freshOf[j] < 0) cachedRow[j] = scores[s].score;
+            }
+
+            for (int j = i + 1; j < n; j++) {
+                double score;
+
+                if (freshOf[j] >= 0) {
+                    score = fresh[static_cast<size_t>(freshOf[j]) * n + i];
+                    rescoredPairs++;
+                } else {
+                    // call cachedScore()
+                    score = (cachedOf[j] < cachedOf[i])
+                                ? cachedScore(static_cast<size_t>(cachedOf[j]), c)
+                                : cachedRow[j];
+                    cachedRow[j] = 0.0;
+
+                    // Keep the Plagiarized flag exact
+                    double bound = drift[i] + drift[j];
+                    if (bound > 0.0 && std::fabs(score - threshold) <= bound) {
+                        score = checker.cosineSimilarity(i, j);
+                        rescoredPairs++;
+                    } else {
+                        reusedPairs++;
+                    }
+                }
+
+                put(j, score);
+            }
+        }
+
+        out.write(reinterpret_cast<const char*>(rowScores.data()),
+                  static_cast<std::streamsize>(rowScores.size() * sizeof(CachedScore)));
+        rowOffsetTable[i + 1] = rowOffsetTable[i] + rowScores.size();
+    };
+
+    if (scoreEverything) {
+        // call SimilarityChecker::compareBlock()
+        checker.compareBlock(0, n, checker, 0, n, threadCount,
+                             [&](int bandBegin, int bandEnd, const double* band) {
+            for (int i = bandBegin; i < bandEnd; i++) {
+                emitRow(i, band + static_cast<size_t>(i - bandBegin) * n);
+            }
+        });
+    } else {
+        for (int i = 0; i < n; i++) {
+            emitRow(i, freshOf[i] >= 0 ? fresh.data() + static_cast<size_t>(freshOf[i]) * n
+                                       : nullptr);
+        }
+    }
+
+    // Scores are 16-byte records, so the section needs no padding
+    header.scoreCount = rowOffsetTable[n];
+    at += header.scoreCount * sizeof(CachedScore);
+    header.rowOffsetsAt = at;   at += alignUp(rowOffsetTable.size() * sizeof(uint64_t));
+    header.fileSize = at;
+
+    writeSection(out, rowOffsetTable.data(), rowOffsetTable.size() * sizeof(uint64_t));
+    out.seekp(0);
+    writeSection(out, &header, sizeof(header));
+    out.close();
+
+    // The old cache stays mapped until here
+    reset();
+
+    if (!out) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    // rename() replaces the old file atomically on POSIX, so readers
+    // always find one; on Windows it fails if the target exists
+#ifdef _WIN32
+    std::remove(path.c_str());
+#endif
+    return std::rename(tempPath.c_str(), path.c_str()) == 0;
+}
+
+/*
+-------------------------------------------------
+Function Name : reusedDocumentCount() / reusedPairCount() / scoredPairCount()
+
+Objective:
+    Report the last compareAll().
+
+Input:
+    None.
+
+Output:
+    Reused documents, reused pairs and scored pairs.
+
+Side Effect:
+    None.
+
+Approach:
+    Return the counters.
+*/
+size_t ResultCache::reusedDocumentCount() const {
+    return reusedDocuments;
+}
+
+size_t ResultCache::reusedPairCount() const {
+    return reusedPairs;
+}
+
+size_t ResultCache::scoredPairCount() const {
+    return rescoredPairs;
+}
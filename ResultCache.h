@@ -0,0 +1,289 @@
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "MappedFile.h"
+#include "ResultSink.h"
+#include "SparseVector.h"
+#include "TermDictionary.h"
+
+class SimilarityChecker;
+
+/*
+    ========================================================================
+                            CLASS : ResultCache
+    ========================================================================
+
+    Objective:
+        The ResultCache class keeps the outcome of an all-pairs run on
+        disk so that a rerun only rescores what changed:
+            - Documents are identified by the XXH64 hash of their file
+              content, so renamed or reordered files still match
+            - The cache stores every document's normalized TF-IDF vector
+              and every nonzero pair score of the last run
+            - On the next run, a document whose content is unchanged and
+              whose vector moved by at most half the tolerance (IDF
+              drift caused by other documents) is clean; pairs of two
+              clean documents reuse their cached score
+            - Reused scores are reused again by later runs, so each
+              document's drift is kept and adds up over runs until the
+              document is rescored
+            - Pairs involving a changed, new or drifted document are
+              rescored
+
+    Input:
+        - For load(): the path of a cache written by an earlier run.
+        - For compareAll(): the checker of the current run, the content
+          hash of each of its documents and the reporting threshold.
+
+    Output:
+        - Every pair (i < j) streamed into a ResultSink in i-major
+          order, as the all-pairs engines do.
+        - A new cache file for the next run.
+
+    Side Effects:
+        - load() keeps the file mapped until compareAll() replaces it.
+        - compareAll() writes path + ".tmp", then renames it to path.
+
+    File Format (version 2, native byte order, every section 8-byte aligned):
+        header        magic "PLAGRC", version, byte-order mark, config
+                      hash, counts and the byte offset of every section
+        termOffsets   uint64[terms + 1]   term i = termChars[off[i], off[i+1])
+        termChars     concatenated term bytes (no terms with hashed
+                      features: IDs are hash buckets)
+        hashes        uint64[docs]        content hash per document
+        vectorOffsets uint64[docs + 1]    document d = vectors[off[d], off[d+1])
+        vectors       SparseEntry[nnz]    normalized TF-IDF vector
+        drift         double[docs]        bound on the distance between the
+                                          vector and those its reused scores
+                                          were computed from
+        scores        CachedScore[pairs]  (j, score) with j > i, row by row,
+                                          zero scores omitted
+        rowOffsets    uint64[docs + 1]    row i = scores[off[i], off[i+1])
+
+    Notes:
+        Scores of two unit vectors change by at most the sum of the
+        distances the vectors moved (Cauchy-Schwarz), so a reused score
+        is within the tolerance of a fresh one. Reused scores that close
+        to the threshold are rescored, so the Plagiarized flag is always
+        exact.
+*/
+
+class ResultCache {
+private:
+
+    // One cached pair score of a row
+    struct CachedScore {
+        uint32_t doc;
+        uint32_t reserved;
+        double score;
+    };
+
+    // Rescoring more rows than this many cells at once falls back to a
+    // full, streaming recomputation
+    static constexpr size_t maxFreshCells = size_t(1) << 24;
+
+    // Hash of the settings that produced the cached scores
+    uint64_t config;
+
+    // Backing file (mapped, or buffered when small)
+    MappedFile file;
+
+    // Table sizes
+    size_t docCount = 0;
+    size_t terms = 0;
+
+    // Section views into 'file'
+    const uint64_t* termOffsets = nullptr;
+    const char* termChars = nullptr;
+    const uint64_t* hashes = nullptr;
+    const uint64_t* vectorOffsets = nullptr;
+    const SparseEntry* vectors = nullptr;
+    const double* drifts = nullptr;
+    const uint64_t* rowOffsets = nullptr;
+    const CachedScore* scores = nullptr;
+
+    // Counters of the last compareAll()
+    size_t reusedDocuments = 0;
+    size_t reusedPairs = 0;
+    size_t rescoredPairs = 0;
+
+    /*
+        Objective:
+            Forget any loaded file.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Unmaps the file and clears every view.
+    */
+    void reset();
+
+    /*
+        Objective:
+            Look up one cached score.
+
+        Input:
+            row → cached document.
+            col → cached document above row.
+
+        Output:
+            Cached score of (row, col); 0.0 if none was stored.
+
+        Side Effects:
+            None.
+
+        Approach:
+            Binary search of the row's ascending column list.
+    */
+    double cachedScore(size_t row, size_t col) const;
+
+public:
+
+    // Format version written and accepted by this class
+    static constexpr uint32_t formatVersion = 2;
+
+    // Default bound on |reused score - fresh score|
+    static constexpr double defaultTolerance = 0.005;
+
+    /*
+        Objective:
+            Create an empty cache for one configuration.
+
+        Input:
+            configHash → configurationHash() of the current run.
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    explicit ResultCache(uint64_t configHash);
+
+    // Views point into the owned mapping, so the object stays in place
+    ResultCache(const ResultCache&) = delete;
+    ResultCache& operator=(const ResultCache&) = delete;
+
+    /*
+        Objective:
+            Identify the settings that affect vectors and scores.
+
+        Input:
+            hashBits       → feature hashing bits (0 = vocabulary).
+            stopWordDigest → StopWordSet::digest() of the stopword list.
+
+        Output:
+            Hash of the format version, feature settings and stopwords.
+
+        Side Effects:
+            None.
+    */
+    static uint64_t configurationHash(int hashBits, uint64_t stopWordDigest);
+
+    /*
+        Objective:
+            Open and validate a cache file.
+
+        Input:
+            path → cache file.
+
+        Output:
+            true if the cache is usable; false if it is missing, damaged
+            or from another configuration, in which case the cache stays
+            empty and compareAll() scores every pair.
+
+        Side Effects:
+            Maps the file.
+    */
+    bool load(const std::string& path);
+
+    /*
+        Objective:
+            Report the loaded cache.
+
+        Input:
+            None.
+
+        Output:
+            Number of cached documents.
+
+        Side Effects:
+            None.
+    */
+    size_t documentCount() const;
+
+    /*
+        Objective:
+            Report all pairs of the current corpus, reusing cached scores,
+            and save the new cache.
+
+        Input:
+            checker       → checker of the current run.
+            contentHashes → content hash of each of its documents.
+            dictionary    → dictionary the vectors' term IDs refer to;
+                            nullptr with hashed features.
+            buckets       → with hashed features, the hash bucket of
+                            each column the vectors' term IDs refer to
+                            (FeatureExtractor::getColumnBuckets());
+                            nullptr otherwise. Vectors are cached by
+                            bucket, which does not depend on the corpus.
+            threshold     → reporting threshold.
+            tolerance     → bound on the error of a reused score.
+            threadCount   → number of worker threads.
+            sink          → receives every pair (i < j) in i-major order.
+            path          → destination of the new cache.
+
+        Output:
+            true if the new cache was written (the report is complete
+            either way).
+
+        Side Effects:
+            Spawns worker threads; replaces the cache file and releases
+            the loaded one.
+
+        Approach:
+            - Match documents to cached ones by content hash and measure
+              how far each matched vector moved.
+            - Score the rows of the other documents against all
+              documents with SimilarityChecker::compareRows(), or
+              everything with compareBlock() when they are too many.
+            - Walk the rows in order, taking each score from the fresh
+              rows or the cache, and stream it into the sink and the
+              new cache file.
+    */
+    bool compareAll(const SimilarityChecker& checker, const std::vector<uint64_t>& contentHashes,
+                    const TermDictionary* dictionary, const std::vector<uint32_t>* buckets,
+                    double threshold, double tolerance,
+                    int threadCount, ResultSink& sink, const std::string& path);
+
+    /*
+        Objective:
+            Report the last compareAll().
+
+        Input:
+            None.
+
+        Output:
+            reusedDocumentCount() : documents whose cached scores were
+                                    reused.
+            reusedPairCount()     : pairs reported from the cache.
+            scoredPairCount()     : pairs scored in this run.
+
+        Side Effects:
+            None.
+    */
+    size_t reusedDocumentCount() const;
+    size_t reusedPairCount() const;
+    size_t scoredPairCount() const;
+};
+
+#endif // RESULTCACHE_H
@@ -0,0 +1,150 @@
+#ifndef RESULTSINK_H
+#define RESULTSINK_H
+
+#include <cstdint>
+#include <vector>
+
+#include "MatchSpan.h"
+
+/*
+    ========================================================================
+                            CLASS : ResultSink
+    ========================================================================
+
+    Objective:
+        Interface for consumers of scored document pairs. SimilarityChecker
+        pushes every pair into a sink as soon as it is final, so a report
+        can be written while the remaining pairs are still being computed
+        and no stage has to hold the full O(N^2) result list.
+
+    Input:
+        - Scored pairs (doc1, doc2, score) by document index.
+
+    Output:
+        - Defined by each implementation (e.g. CSV rows on disk).
+
+    Side Effects:
+        - Defined by each implementation.
+
+    Notes:
+        - Calls never overlap: a producer delivers pairs one at a time,
+          possibly from different threads, but each call happens after
+          the previous one has returned.
+        - All-pairs producers deliver pairs in the serial i-major order
+          of SimilarityChecker::compareAll().
+*/
+
+class ResultSink {
+public:
+
+    virtual ~ResultSink() = default;
+
+    /*
+        Objective:
+            Receive one scored pair.
+
+        Input:
+            doc1  → index of the first document (doc1 < doc2).
+            doc2  → index of the second document.
+            score → cosine similarity between 0.0 and 1.0.
+
+        Output:
+            None.
+
+        Side Effects:
+            Defined by the implementation.
+    */
+    virtual void accept(int doc1, int doc2, double score) = 0;
+
+    /*
+        Objective:
+            Receive one scored pair with the passages it shares.
+
+        Input:
+            doc1, doc2 → document indices (doc1 < doc2).
+            score      → similarity between 0.0 and 1.0.
+            spans      → matched passages.
+
+        Output:
+            None.
+
+        Side Effects:
+            By default the spans are dropped and the pair goes to
+            accept(); sinks that report passages override this.
+    */
+    virtual void acceptMatch(int doc1, int doc2, double score,
+                             const std::vector<MatchSpan>& spans) {
+        (void)spans;
+        accept(doc1, doc2, score);
+    }
+
+    /*
+        Objective:
+            Signal that no more pairs will arrive.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Implementations flush and release their output here.
+    */
+    virtual void finish() {}
+};
+
+/*
+    ========================================================================
+                            CLASS : CountingSink
+    ========================================================================
+
+    Objective:
+        Forward pairs to another sink while counting them, e.g. for run
+        statistics.
+
+    Input:
+        - The sink that receives the pairs.
+
+    Output:
+        - Number of pairs forwarded.
+
+    Side Effects:
+        - Those of the wrapped sink.
+*/
+
+class CountingSink : public ResultSink {
+private:
+
+    // Receives every pair
+    ResultSink& target;
+
+    // Pairs forwarded so far
+    uint64_t pairs = 0;
+
+public:
+
+    explicit CountingSink(ResultSink& sink) : target(sink) {}
+
+    void accept(int doc1, int doc2, double score) override {
+        pairs++;
+        target.accept(doc1, doc2, score);
+    }
+
+    void acceptMatch(int doc1, int doc2, double score,
+                     const std::vector<MatchSpan>& spans) override {
+        pairs++;
+        target.acceptMatch(doc1, doc2, score, spans);
+    }
+
+    void finish() override {
+        target.finish();
+    }
+
+    // Number of pairs accepted
+    uint64_t count() const {
+        return pairs;
+    }
+};
+
+#endif // RESULTSINK_H
@@ -0,0 +1,382 @@
+#include "RunStats.h"
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #define PSAPI_VERSION 2
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+namespace {
+
+// Seconds elapsed between two steady clock readings
+double secondsBetween(std::chrono::steady_clock::time_point from,
+                      std::chrono::steady_clock::time_point to) {
+    return std::chrono::duration<double>(to - from).count();
+}
+
+// Quote a string for JSON (identifiers only need quotes and backslashes)
+std::string jsonString(const std::string& text) {
+    std::string quoted = "\"";
+
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            quoted += '\\';
+        }
+        quoted += c;
+    }
+
+    return quoted + "\"";
+}
+
+} // namespace
+
+/*
+-------------------------------------------------
+Function Name : RunStats (Constructor)
+
+Objective:
+    Start measuring a run.
+
+Input:
+    None.
+
+Output:
+    RunStats object initialized.
+
+Side Effect:
+    Reads the clock and process CPU time.
+
+Approach:
+    Remember both as the run origin.
+
+    // call processCpuSeconds()
+*/
+RunStats::RunStats()
+    : runStart(std::chrono::steady_clock::now()), stageStart(runStart) {
+    // call processCpuSeconds()
+    runCpuStart = processCpuSeconds();
+    stageCpuStart = runCpuStart;
+}
+
+/*
+-------------------------------------------------
+Function Name : processCpuSeconds()
+
+Objective:
+    Measure process CPU time.
+
+Input:
+    None.
+
+Output:
+    User + system seconds.
+
+Side Effect:
+    None.
+
+Approach:
+    getrusage(RUSAGE_SELF) on POSIX, GetProcessTimes() on Windows
+    (100 ns units).
+*/
+double RunStats::processCpuSeconds() {
+#ifdef _WIN32
+    FILETIME created, exited, kernel, user;
+
+    if (!GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user)) {
+        return 0.0;
+    }
+
+    auto ticks = [](const FILETIME& time) {
+        return (static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+    };
+
+    return static_cast<double>(ticks(kernel) + ticks(user)) * 1e-7;
+#else
+    rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+
+    return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1e-6;
+#endif
+}
+
+/*
+-------------------------------------------------
+Function Name : processPeakRssBytes()
+
+Objective:
+    Measure the peak resident set size.
+
+Input:
+    None.
+
+Output:
+    Bytes.
+
+Side Effect:
+    None.
+
+Approach:
+    ru_maxrss is reported in kilobytes on Linux and in bytes on
+    macOS; Windows reports PeakWorkingSetSize in bytes.
+*/
+uint64_t RunStats::processPeakRssBytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters = {};
+
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+
+    return static_cast<uint64_t>(counters.PeakWorkingSetSize);
+#else
+    rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+
+    #ifdef __APPLE__
+        return static_cast<uint64_t>(usage.ru_maxrss);
+    #else
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+    #endif
+#endif
+}
+
+/*
+-------------------------------------------------
+Function Name : beginStage()
+
+Objective:
+    Open a new stage.
+
+Input:
+    name → Stage identifier.
+
+Output:
+    None.
+
+Side Effect:
+    Ends the open stage; records start time and CPU time.
+
+Approach:
+    Append an empty stage and remember where it started.
+
+    // call endStage()
+    // call processCpuSeconds()
+*/
+void RunStats::beginStage(const std::string& name) {
+    // call endStage()
+    endStage();
+
+    Stage stage;
+    stage.name = name;
+    stages.push_back(std::move(stage));
+
+    stageOpen = true;
+    stageStart = std::chrono::steady_clock::now();
+
+    // call processCpuSeconds()
+    stageCpuStart = processCpuSeconds();
+}
+
+/*
+-------------------------------------------------
+Function Name : endStage()
+
+Objective:
+    Close the open stage.
+
+Input:
+    None.
+
+Output:
+    None.
+
+Side Effect:
+    Stores the stage measurements.
+
+Approach:
+    Subtract the start readings from the current ones.
+
+    // call processCpuSeconds()
+    // call processPeakRssBytes()
+*/
+void RunStats::endStage() {
+    if (!stageOpen) {
+        return;
+    }
+
+    Stage& stage = stages.back();
+    stage.wallSeconds = secondsBetween(stageStart, std::chrono::steady_clock::now());
+
+    // call processCpuSeconds()
+    stage.cpuSeconds = processCpuSeconds() - stageCpuStart;
+
+    // call processPeakRssBytes()
+    stage.peakRssBytes = processPeakRssBytes();
+
+    stageOpen = false;
+}
+
+/*
+-------------------------------------------------
+Function Name : count()
+
+Objective:
+    Accumulate a counter.
+
+Input:
+    name  → Counter identifier.
+    value → Amount to add.
+
+Output:
+    None.
+
+Side Effect:
+    Modifies the last stage.
+
+Approach:
+    Linear search of the stage's few counters, appending a new one
+    on first use so counters keep their insertion order.
+*/
+void RunStats::count(const std::string& name, uint64_t value) {
+    if (stages.empty()) {
+        return;
+    }
+
+    for (auto& counter : stages.back().counters) {
+        if (counter.name == name) {
+            counter.value += value;
+            return;
+        }
+    }
+
+    stages.back().counters.push_back({name, value});
+}
+
+/*
+-------------------------------------------------
+Function Name : printSummary()
+
+Objective:
+    Print statistics as a table.
+
+Input:
+    out → Output stream.
+
+Output:
+    None.
+
+Side Effect:
+    Writes to the stream.
+
+Approach:
+    One fixed-width row per stage followed by its counters, then the
+    run totals.
+
+    // call processCpuSeconds()
+    // call processPeakRssBytes()
+*/
+void RunStats::printSummary(std::ostream& out) const {
+
+    std::ostringstream table;
+    table << std::fixed;
+
+    table << "=== Run Statistics ===\n";
+    table << std::left << std::setw(16) << "Stage" << std::right
+          << std::setw(12) << "Wall (s)" << std::setw(12) << "CPU (s)"
+          << std::setw(16) << "Peak RSS (MB)" << "\n";
+
+    auto row = [&](const std::string& name, double wall, double cpu, uint64_t rss) {
+        table << std::left << std::setw(16) << name << std::right
+              << std::setprecision(3) << std::setw(12) << wall << std::setw(12) << cpu
+              << std::setprecision(1) << std::setw(16) << rss / (1024.0 * 1024.0) << "\n";
+    };
+
+    for (const auto& stage : stages) {
+        row(stage.name, stage.wallSeconds, stage.cpuSeconds, stage.peakRssBytes);
+
+        for (const auto& counter : stage.counters) {
+            table << "    " << counter.name << ": " << counter.value << "\n";
+        }
+    }
+
+    // call processCpuSeconds()
+    // call processPeakRssBytes()
+    row("total", secondsBetween(runStart, std::chrono::steady_clock::now()),
+        processCpuSeconds() - runCpuStart, processPeakRssBytes());
+
+    out << table.str();
+}
+
+/*
+-------------------------------------------------
+Function Name : writeJSON()
+
+Objective:
+    Export statistics as JSON.
+
+Input:
+    path → Output file path.
+
+Output:
+    true on success.
+
+Side Effect:
+    Writes file.
+
+Approach:
+    Emit the run totals, then every stage with its counters as an
+    object keyed by counter name. Times use microsecond precision.
+
+    // call processCpuSeconds()
+    // call processPeakRssBytes()
+*/
+bool RunStats::writeJSON(const std::string& path) const {
+
+    std::ofstream file(path);
+
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file << std::fixed << std::setprecision(6);
+
+    // call processCpuSeconds()
+    // call processPeakRssBytes()
+    file << "{\n  \"version\": 1,\n  \"total\": {"
+         << "\"wall_seconds\": " << secondsBetween(runStart, std::chrono::steady_clock::now())
+         << ", \"cpu_seconds\": " << processCpuSeconds() - runCpuStart
+         << ", \"peak_rss_bytes\": " << processPeakRssBytes() << "},\n"
+         << "  \"stages\": [";
+
+    for (size_t s = 0; s < stages.size(); s++) {
+        const Stage& stage = stages[s];
+
+        file << (s ? ",\n" : "\n")
+             << "    {\"name\": " << jsonString(stage.name)
+             << ", \"wall_seconds\": " << stage.wallSeconds
+             << ", \"cpu_seconds\": " << stage.cpuSeconds
+             << ", \"peak_rss_bytes\": " << stage.peakRssBytes
+             << ", \"counters\": {";
+
+        for (size_t c = 0; c < stage.counters.size(); c++) {
+            file << (c ? ", " : "") << jsonString(stage.counters[c].name)
+                 << ": " << stage.counters[c].value;
+        }
+
+        file << "}}";
+    }
+
+    file << "\n  ]\n}\n";
+    file.close();
+
+    return static_cast<bool>(file);
+}
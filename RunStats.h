@@ -0,0 +1,231 @@
+#ifndef RUNSTATS_H
+#define RUNSTATS_H
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*
+    ========================================================================
+                            CLASS : RunStats
+    ========================================================================
+
+    Objective:
+        The RunStats class records where a run spends its time and
+        memory, stage by stage (read/clean, TF-IDF, compare, ...):
+            - wall-clock time and process CPU time (user + system)
+            - peak resident set size of the process at the end of the stage
+            - named counters such as bytes read, tokens produced or pairs
+              scored
+
+    Input:
+        - beginStage() / endStage() calls around each pipeline stage.
+        - count() calls adding counters to the current stage.
+
+    Output:
+        - A human-readable summary table.
+        - A JSON document for regression tracking across releases.
+
+    Side Effects:
+        - Queries process resource usage (getrusage on POSIX,
+          GetProcessTimes / GetProcessMemoryInfo on Windows) once per
+          stage boundary; counters cost nothing else.
+
+    Notes:
+        - CPU time covers all threads, so CPU / wall approximates the
+          parallelism a stage achieved.
+        - Peak RSS is a high-water mark: a stage reports the largest
+          footprint reached so far, not its own allocation.
+*/
+
+class RunStats {
+private:
+
+    /*
+        Objective:
+            One named counter of a stage.
+
+        Input:
+            - name  : identifier (snake_case, used as JSON key).
+            - value : counted amount.
+
+        Output:
+            None (plain data holder).
+
+        Side Effects:
+            None.
+    */
+    struct Counter {
+        std::string name;
+        uint64_t value;
+    };
+
+    /*
+        Objective:
+            Measurements of one finished (or running) stage.
+
+        Input:
+            Filled by beginStage(), endStage() and count().
+
+        Output:
+            None (plain data holder).
+
+        Side Effects:
+            None.
+    */
+    struct Stage {
+        std::string name;
+        double wallSeconds = 0.0;
+        double cpuSeconds = 0.0;
+        uint64_t peakRssBytes = 0;
+        std::vector<Counter> counters;
+    };
+
+    // Stages in the order they ran
+    std::vector<Stage> stages;
+
+    // Start of the run and of the current stage
+    std::chrono::steady_clock::time_point runStart;
+    std::chrono::steady_clock::time_point stageStart;
+
+    // Process CPU time when the run and the current stage started
+    double runCpuStart = 0.0;
+    double stageCpuStart = 0.0;
+
+    // True between beginStage() and endStage()
+    bool stageOpen = false;
+
+    /*
+        Objective:
+            Read the CPU time used by the process so far.
+
+        Input:
+            None.
+
+        Output:
+            User + system seconds over all threads.
+
+        Side Effects:
+            None.
+    */
+    static double processCpuSeconds();
+
+    /*
+        Objective:
+            Read the peak resident set size of the process.
+
+        Input:
+            None.
+
+        Output:
+            High-water mark in bytes (0 if unavailable).
+
+        Side Effects:
+            None.
+    */
+    static uint64_t processPeakRssBytes();
+
+public:
+
+    /*
+        Objective:
+            Start measuring a run.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Records the start time and CPU time of the run.
+    */
+    RunStats();
+
+    /*
+        Objective:
+            Start a new stage, ending the current one if still open.
+
+        Input:
+            name → stage identifier (snake_case).
+
+        Output:
+            None.
+
+        Side Effects:
+            Records the stage start time and CPU time.
+    */
+    void beginStage(const std::string& name);
+
+    /*
+        Objective:
+            Finish the current stage.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Stores wall time, CPU time and peak RSS of the stage;
+            does nothing without an open stage.
+    */
+    void endStage();
+
+    /*
+        Objective:
+            Add to a counter of the current (or last) stage.
+
+        Input:
+            name  → counter identifier (snake_case).
+            value → amount to add; a new counter starts at zero.
+
+        Output:
+            None.
+
+        Side Effects:
+            Ignored if no stage has started yet.
+    */
+    void count(const std::string& name, uint64_t value);
+
+    /*
+        Objective:
+            Print a table of all stages and their counters.
+
+        Input:
+            out → destination stream.
+
+        Output:
+            One row per stage plus a total row.
+
+        Side Effects:
+            Writes to the stream.
+    */
+    void printSummary(std::ostream& out) const;
+
+    /*
+        Objective:
+            Write all stages as JSON.
+
+        Input:
+            path → output file.
+
+        Output:
+            true if the file was written.
+
+        Side Effects:
+            Creates or overwrites the file.
+
+        Format:
+            { "version": 1,
+              "total": { "wall_seconds", "cpu_seconds", "peak_rss_bytes" },
+              "stages": [ { "name", "wall_seconds", "cpu_seconds",
+                            "peak_rss_bytes", "counters": { ... } } ] }
+    */
+    bool writeJSON(const std::string& path) const;
+};
+
+#endif // RUNSTATS_H
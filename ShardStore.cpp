@@ -0,0 +1,572 @@
+#include "ShardStore.h"
+#include "FeatureHasher.h"
+#include "SimilarityChecker.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <random>
+#include <system_error>
+
+namespace {
+
+// One run-length counted column of a document
+struct ColumnCount {
+    uint32_t column;
+    int32_t count;
+};
+
+// Read one spilled row into cols/scores; false at a short read
+bool readRow(std::ifstream& in, std::vector<uint32_t>& cols, std::vector<double>& scores) {
+    uint32_t count = 0;
+    in.read(reinterpret_cast<char*>(&count), sizeof(count));
+
+    cols.resize(count);
+    scores.resize(count);
+
+    if (count > 0) {
+        in.read(reinterpret_cast<char*>(cols.data()), count * sizeof(uint32_t));
+        in.read(reinterpret_cast<char*>(scores.data()), count * sizeof(double));
+    }
+
+    return static_cast<bool>(in);
+}
+
+} // namespace
+
+/*
+-------------------------------------------------
+Function Name : ShardStore (Constructor)
+
+Objective:
+    Store directory, budget and feature mode.
+
+Input:
+    directory     → Parent of the temporary directory.
+    memoryBudget  → Memory budget in bytes.
+    signedColumns → true for FeatureHasher IDs.
+
+Output:
+    ShardStore object initialized.
+
+Side Effect:
+    None.
+
+Approach:
+    A loaded shard may take a quarter of the budget, leaving room
+    for a second shard, the score bands and the per-term tables.
+*/
+ShardStore::ShardStore(std::string directory, size_t memoryBudget, bool signedColumns)
+    : parentDirectory(std::move(directory)),
+      shardBytes(memoryBudget / 4),
+      signedFeatures(signedColumns) {
+}
+
+/*
+-------------------------------------------------
+Function Name : ~ShardStore (Destructor)
+
+Objective:
+    Delete the temporary files.
+
+Input:
+    None.
+
+Output:
+    None.
+
+Side Effect:
+    Removes the private directory and everything in it.
+
+Approach:
+    Close the writer, then remove the directory recursively; errors
+    are ignored, as there is nobody left to report them to.
+*/
+ShardStore::~ShardStore() {
+    out.close();
+
+    if (!directory.empty()) {
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+}
+
+/*
+-------------------------------------------------
+Function Name : open()
+
+Objective:
+    Create the private directory and the first shard.
+
+Input:
+    None.
+
+Output:
+    true on success.
+
+Side Effect:
+    Creates a directory and a file.
+
+Approach:
+    Try a few random directory names below the parent, so concurrent
+    runs never share files.
+
+    // call openShard()
+*/
+bool ShardStore::open() {
+    std::error_code error;
+
+    std::filesystem::path parent = parentDirectory.empty()
+        ? std::filesystem::temp_directory_path(error)
+        : std::filesystem::path(parentDirectory);
+
+    if (error) {
+        return false;
+    }
+
+    std::mt19937_64 random(std::random_device{}() ^
+        static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+
+    for (int attempt = 0; attempt < 8 && directory.empty(); attempt++) {
+        std::filesystem::path candidate = parent /
+            ("plagiarism-shards-" + std::to_string(random() % 1000000000ULL));
+
+        if (std::filesystem::create_directory(candidate, error)) {
+            directory = candidate.string();
+        }
+    }
+
+    // call openShard()
+    return !directory.empty() && openShard();
+}
+
+/*
+-------------------------------------------------
+Function Name : openShard()
+
+Objective:
+    Start a new shard file.
+
+Input:
+    None.
+
+Output:
+    true if the file was created.
+
+Side Effect:
+    Closes the current writer; appends a shard record.
+
+Approach:
+    Name shards by index inside the private directory.
+*/
+bool ShardStore::openShard() {
+    out.close();
+
+    std::string path = (std::filesystem::path(directory) /
+                        ("shard-" + std::to_string(shards.size()) + ".bin")).string();
+
+    shards.push_back({path, documents, 0, 0});
+
+    out.open(path, std::ios::binary | std::ios::trunc);
+    return static_cast<bool>(out);
+}
+
+/*
+-------------------------------------------------
+Function Name : addDocument()
+
+Objective:
+    Append the term counts of one document.
+
+Input:
+    termIds → Cleaned tokens.
+
+Output:
+    true if the record was written.
+
+Side Effect:
+    Writes to the current shard; updates document frequencies.
+
+Approach:
+    Sort a copy of the tokens and count runs by column. Signed
+    features sort positive before negative within a bucket, so one
+    run per bucket nets both signs. A full shard is closed before
+    the record that would overflow it, unless it is still empty.
+
+    // call openShard()
+*/
+bool ShardStore::addDocument(const std::vector<uint32_t>& termIds) {
+    std::vector<uint32_t> sorted(termIds);
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<ColumnCount> counts;
+
+    for (size_t t = 0; t < sorted.size();) {
+        uint32_t column = signedFeatures ? FeatureHasher::bucketOf(sorted[t]) : sorted[t];
+        int32_t count = 0;
+
+        for (; t < sorted.size(); t++) {
+            uint32_t id = sorted[t];
+
+            if ((signedFeatures ? FeatureHasher::bucketOf(id) : id) != column) break;
+
+            count += (signedFeatures && FeatureHasher::isNegative(id)) ? -1 : 1;
+        }
+
+        if (count != 0) {
+            counts.push_back({column, count});
+        }
+    }
+
+    Shard* shard = &shards.back();
+    size_t loaded = (shard->entries + counts.size()) * bytesPerEntry +
+                    (shard->documents + 1) * bytesPerDocument;
+
+    if (shard->documents > 0 && loaded > shardBytes) {
+        // call openShard()
+        if (!openShard()) {
+            return false;
+        }
+        shard = &shards.back();
+    }
+
+    uint32_t header[2] = {static_cast<uint32_t>(termIds.size()),
+                          static_cast<uint32_t>(counts.size())};
+
+    out.write(reinterpret_cast<const char*>(header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(counts.data()),
+              static_cast<std::streamsize>(counts.size() * sizeof(ColumnCount)));
+
+    for (const auto& entry : counts) {
+        if (entry.column >= documentFrequency.size()) {
+            documentFrequency.resize(entry.column + 1, 0);
+        }
+        documentFrequency[entry.column]++;
+    }
+
+    shard->documents++;
+    shard->entries += counts.size();
+    shardFileBytes += sizeof(header) + counts.size() * sizeof(ColumnCount);
+    documents++;
+
+    return static_cast<bool>(out);
+}
+
+/*
+-------------------------------------------------
+Function Name : finish()
+
+Objective:
+    Close the last shard and compute IDF.
+
+Input:
+    None.
+
+Output:
+    true if all shard data reached the files.
+
+Side Effect:
+    Closes the writer; fills the IDF table.
+
+Approach:
+    Apply the FeatureExtractor::computeIDF() formula to the document
+    frequencies; a trailing empty shard is dropped.
+*/
+bool ShardStore::finish() {
+    out.flush();
+    bool written = static_cast<bool>(out);
+    out.close();
+
+    if (!shards.empty() && shards.back().documents == 0) {
+        std::error_code error;
+        std::filesystem::remove(shards.back().path, error);
+        shards.pop_back();
+    }
+
+    idf.assign(documentFrequency.size(), 0.0);
+
+    double totalDocs = static_cast<double>(documents);
+
+    for (size_t column = 0; column < idf.size(); column++) {
+        if (documentFrequency[column] > 0) {
+            idf[column] = std::log10(totalDocs / static_cast<double>(documentFrequency[column]));
+        }
+    }
+
+    return written;
+}
+
+/*
+-------------------------------------------------
+Function Name : documentCount() / shardCount() / diskBytes() / activeTermCount()
+
+Objective:
+    Describe the stored corpus.
+
+Input:
+    None.
+
+Output:
+    Documents, shards, shard file bytes and active columns.
+
+Side Effect:
+    None.
+
+Approach:
+    Return the counters; active columns are counted from the IDF.
+*/
+int ShardStore::documentCount() const {
+    return documents;
+}
+
+size_t ShardStore::shardCount() const {
+    return shards.size();
+}
+
+uint64_t ShardStore::diskBytes() const {
+    return shardFileBytes;
+}
+
+size_t ShardStore::activeTermCount() const {
+    return static_cast<size_t>(std::count_if(idf.begin(), idf.end(),
+                                             [](double value) { return value != 0.0; }));
+}
+
+/*
+-------------------------------------------------
+Function Name : loadShard()
+
+Objective:
+    Read a shard back as TF-IDF vectors.
+
+Input:
+    shard → Shard index.
+
+Output:
+    One vector per document of the shard, or an empty list if the
+    file is short.
+
+Side Effect:
+    Reads the shard file.
+
+Approach:
+    Entries were written in column order; weight each as
+    count / length * IDF, the same expression as
+    FeatureExtractor::computeTFIDF(), and skip zero-IDF columns.
+*/
+std::vector<SparseVector> ShardStore::loadShard(size_t shard) const {
+    std::vector<SparseVector> vectors;
+    std::ifstream in(shards[shard].path, std::ios::binary);
+
+    if (!in) {
+        return vectors;
+    }
+
+    vectors.resize(shards[shard].documents);
+    std::vector<ColumnCount> counts;
+
+    for (auto& vec : vectors) {
+        uint32_t header[2] = {0, 0};
+        in.read(reinterpret_cast<char*>(header), sizeof(header));
+
+        counts.resize(header[1]);
+        in.read(reinterpret_cast<char*>(counts.data()),
+                static_cast<std::streamsize>(counts.size() * sizeof(ColumnCount)));
+
+        if (!in) {
+            return {};
+        }
+
+        vec.reserve(counts.size());
+
+        for (const auto& entry : counts) {
+            double idfValue = idf[entry.column];
+
+            if (idfValue == 0.0) {
+                continue;
+            }
+
+            double tfValue = static_cast<double>(entry.count) / static_cast<double>(header[0]);
+            vec.push_back({entry.column, tfValue * idfValue});
+        }
+    }
+
+    return vectors;
+}
+
+/*
+-------------------------------------------------
+Function Name : compareAll()
+
+Objective:
+    Stream all document pairs, scored shard block by shard block.
+
+Input:
+    threadCount → Number of worker threads.
+    sink        → Result consumer.
+    minScore    → Pairs at or below it are dropped.
+
+Output:
+    true unless shard or spill I/O failed.
+
+Side Effect:
+    Reads shards; writes and removes spill files; calls the sink.
+
+Approach:
+    Per row shard: score block (a, a), then every later shard b,
+    spilling the pairs of each row as (count, columns, scores) to
+    one file per block; finally read the row records of all blocks
+    in turn and emit them. Only j > i is kept in the diagonal block.
+    The last row shard is emitted straight from the score bands.
+
+    // call loadShard()
+    // call SimilarityChecker::compareBlock()
+*/
+bool ShardStore::compareAll(int threadCount, ResultSink& sink, double minScore) const {
+    blocks = 0;
+    spilled = 0;
+
+    for (size_t a = 0; a < shards.size(); a++) {
+        const Shard& rowShard = shards[a];
+
+        // call loadShard()
+        SimilarityChecker rows(loadShard(a), {});
+
+        if (rows.documentCount() != rowShard.documents) {
+            return false;
+        }
+
+        if (a + 1 == shards.size()) {
+            int width = rowShard.documents;
+
+            // call SimilarityChecker::compareBlock()
+            rows.compareBlock(0, width, rows, 0, width, threadCount, [&](int rowBegin, int rowEnd, const double* scores) {
+                for (int i = rowBegin; i < rowEnd; i++) {
+                    const double* row = scores + static_cast<size_t>(i - rowBegin) * width;
+
+                    for (int j = i + 1; j < width; j++) {
+                        if (row[j] > minScore) {
+                            sink.accept(rowShard.firstDocument + i, rowShard.firstDocument + j, row[j]);
+                        }
+                    }
+                }
+            });
+
+            blocks++;
+            break;
+        }
+
+        std::vector<std::string> spillPaths;
+        std::vector<uint32_t> cols;
+        std::vector<double> kept;
+        bool ok = true;
+
+        for (size_t b = a; b < shards.size() && ok; b++) {
+            spillPaths.push_back((std::filesystem::path(directory) /
+                                  ("block-" + std::to_string(b) + ".bin")).string());
+
+            std::ofstream spill(spillPaths.back(), std::ios::binary | std::ios::trunc);
+            int width = shards[b].documents;
+
+            auto write = [&](int rowBegin, int rowEnd, const double* scores) {
+                for (int i = rowBegin; i < rowEnd; i++) {
+                    const double* row = scores + static_cast<size_t>(i - rowBegin) * width;
+
+                    cols.clear();
+                    kept.clear();
+
+                    for (int j = (b == a) ? i + 1 : 0; j < width; j++) {
+                        if (row[j] > minScore) {
+                            cols.push_back(static_cast<uint32_t>(j));
+                            kept.push_back(row[j]);
+                        }
+                    }
+
+                    uint32_t count = static_cast<uint32_t>(cols.size());
+                    spill.write(reinterpret_cast<const char*>(&count), sizeof(count));
+                    spill.write(reinterpret_cast<const char*>(cols.data()), count * sizeof(uint32_t));
+                    spill.write(reinterpret_cast<const char*>(kept.data()), count * sizeof(double));
+
+                    spilled += sizeof(count) + count * (sizeof(uint32_t) + sizeof(double));
+                }
+            };
+
+            if (b == a) {
+                // call SimilarityChecker::compareBlock()
+                rows.compareBlock(0, rowShard.documents, rows, 0, width, threadCount, write);
+            } else {
+                SimilarityChecker columns(loadShard(b), {});
+
+                if (columns.documentCount() != width) {
+                    ok = false;
+                    break;
+                }
+
+                rows.compareBlock(0, rowShard.documents, columns, 0, width, threadCount, write);
+            }
+
+            blocks++;
+            spill.close();
+            ok = ok && static_cast<bool>(spill);
+        }
+
+        // Merge: row i of shard a is the concatenation of its block rows
+        std::vector<std::ifstream> readers;
+        for (const auto& path : spillPaths) {
+            readers.emplace_back(path, std::ios::binary);
+        }
+
+        for (int i = 0; i < rowShard.documents && ok; i++) {
+            for (size_t r = 0; r < readers.size() && ok; r++) {
+                ok = readRow(readers[r], cols, kept);
+
+                int columnFirst = shards[a + r].firstDocument;
+
+                for (size_t k = 0; ok && k < cols.size(); k++) {
+                    sink.accept(rowShard.firstDocument + i,
+                                columnFirst + static_cast<int>(cols[k]), kept[k]);
+                }
+            }
+        }
+
+        readers.clear();
+
+        for (const auto& path : spillPaths) {
+            std::error_code error;
+            std::filesystem::remove(path, error);
+        }
+
+        if (!ok) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+-------------------------------------------------
+Function Name : blockCount() / spilledBytes()
+
+Objective:
+    Report the work of the last compareAll().
+
+Input:
+    None.
+
+Output:
+    Blocks scored and bytes spilled.
+
+Side Effect:
+    None.
+
+Approach:
+    Return the counters.
+*/
+size_t ShardStore::blockCount() const {
+    return blocks;
+}
+
+uint64_t ShardStore::spilledBytes() const {
+    return spilled;
+}
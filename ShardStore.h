@@ -0,0 +1,297 @@
+#ifndef SHARDSTORE_H
+#define SHARDSTORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "SparseVector.h"
+#include "ResultSink.h"
+
+/*
+    ========================================================================
+                            CLASS : ShardStore
+    ========================================================================
+
+    Objective:
+        The ShardStore class runs the all-pairs comparison out of core,
+        for corpora whose vectors and scores do not fit in memory:
+            - Documents are streamed in one by one and their term counts
+              appended to on-disk shards; only document frequencies stay
+              in memory
+            - Shards are cut so that two of them, expanded into TF-IDF
+              vectors, fit in a quarter of the memory budget each
+            - Every shard pair (a, b), a <= b, is scored as one block
+              with SimilarityChecker::compareBlock()
+            - The blocks of a row shard are spilled to disk and merged
+              row by row into the report, so pairs arrive in the same
+              i-major order, with the same scores, as from the in-memory
+              engines
+
+    Input:
+        - Directory for the temporary shard files.
+        - Memory budget in bytes.
+        - Whether term IDs are signed FeatureHasher features.
+
+    Output:
+        - Scored pairs streamed into a ResultSink.
+
+    Side Effects:
+        - Creates a private subdirectory holding shard and spill files,
+          removed when the store is destroyed.
+
+    Notes:
+        The budget covers the shards, score bands and per-worker
+        scratch rows. The per-term tables (dictionary, document
+        frequencies) and the document names grow with the vocabulary
+        and the corpus, not with the shards; --hash-bits bounds the
+        former. Spill files take 12 bytes per pair of one row shard.
+*/
+
+class ShardStore {
+private:
+
+    // One on-disk shard: documents [firstDocument, firstDocument + documents)
+    struct Shard {
+        std::string path;
+        int firstDocument;
+        int documents;
+        size_t entries;
+    };
+
+    // Estimated memory per loaded entry: vector, CSR and transposed copy
+    static constexpr size_t bytesPerEntry = 40;
+
+    // Estimated memory per loaded document beyond its entries
+    static constexpr size_t bytesPerDocument = 64;
+
+    // Caller-supplied parent of the private directory
+    std::string parentDirectory;
+
+    // Private directory holding the shard and spill files
+    std::string directory;
+
+    // Loaded-size limit of one shard, in bytes
+    size_t shardBytes;
+
+    // true when term IDs are FeatureHasher features
+    bool signedFeatures;
+
+    // Completed shards followed by the one being written
+    std::vector<Shard> shards;
+
+    // Writer of the last shard
+    std::ofstream out;
+
+    // Documents containing each column (term, or hash bucket)
+    std::vector<uint32_t> documentFrequency;
+
+    // IDF of each column, computed by finish()
+    std::vector<double> idf;
+
+    // Documents added so far
+    int documents = 0;
+
+    // Bytes written to shard files
+    uint64_t shardFileBytes = 0;
+
+    // Blocks scored and bytes spilled by the last compareAll()
+    mutable size_t blocks = 0;
+    mutable uint64_t spilled = 0;
+
+    /*
+        Objective:
+            Start a new shard file.
+
+        Input:
+            None.
+
+        Output:
+            true if the file was created.
+
+        Side Effects:
+            Closes the current shard writer.
+    */
+    bool openShard();
+
+public:
+
+    /*
+        Objective:
+            Configure the store.
+
+        Input:
+            directory     → parent of the temporary directory ("" =
+                            the system temporary directory).
+            memoryBudget  → memory budget in bytes.
+            signedColumns → true for FeatureHasher IDs, which are folded
+                            into one net count per bucket.
+
+        Output:
+            None.
+
+        Side Effects:
+            None; open() creates the files.
+    */
+    ShardStore(std::string directory, size_t memoryBudget, bool signedColumns);
+
+    /*
+        Objective:
+            Remove every file the store created.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            Deletes the private directory.
+    */
+    ~ShardStore();
+
+    ShardStore(const ShardStore&) = delete;
+    ShardStore& operator=(const ShardStore&) = delete;
+
+    /*
+        Objective:
+            Create the private directory and the first shard.
+
+        Input:
+            None.
+
+        Output:
+            true on success.
+
+        Side Effects:
+            Creates files on disk.
+    */
+    bool open();
+
+    /*
+        Objective:
+            Append one document.
+
+        Input:
+            termIds → cleaned tokens (term IDs or signed features).
+
+        Output:
+            true if the counts were written.
+
+        Side Effects:
+            Appends to the current shard, starting a new one when it
+            is full; updates document frequencies.
+
+        Approach:
+            Sort the tokens, run-length count them (folding signed
+            features by bucket and dropping net-zero counts) and write
+            length, entry count and the (column, count) entries.
+    */
+    bool addDocument(const std::vector<uint32_t>& termIds);
+
+    /*
+        Objective:
+            Close the last shard and compute IDF.
+
+        Input:
+            None.
+
+        Output:
+            true if every shard was written completely.
+
+        Side Effects:
+            Flushes and closes the shard writer.
+    */
+    bool finish();
+
+    /*
+        Objective:
+            Describe the stored corpus.
+
+        Input:
+            None.
+
+        Output:
+            documentCount()   : documents added.
+            shardCount()      : shards written.
+            diskBytes()       : total size of the shard files.
+            activeTermCount() : columns with a nonzero IDF (after
+                                finish()).
+
+        Side Effects:
+            None.
+    */
+    int documentCount() const;
+    size_t shardCount() const;
+    uint64_t diskBytes() const;
+    size_t activeTermCount() const;
+
+    /*
+        Objective:
+            Read one shard back as TF-IDF vectors.
+
+        Input:
+            shard → shard index.
+
+        Output:
+            Vectors of the shard's documents, sorted by column, with
+            weights computed exactly as FeatureExtractor::computeTFIDF()
+            does; empty if the file cannot be read.
+
+        Side Effects:
+            Reads the shard file.
+    */
+    std::vector<SparseVector> loadShard(size_t shard) const;
+
+    /*
+        Objective:
+            Stream all document pairs, block by block.
+
+        Input:
+            threadCount → number of worker threads.
+            sink        → receives every pair (i, j), i < j, in i-major
+                          order.
+            minScore    → pairs scoring at or below it are neither
+                          spilled nor reported (e.g. the threshold of a
+                          flagged-only report).
+
+        Output:
+            true unless a spill file could not be written or read.
+
+        Side Effects:
+            Reads shards; writes and removes spill files.
+
+        Approach:
+            For each row shard a, load it once and load the shards
+            b >= a after it one at a time. The (a, b) block is computed
+            by SimilarityChecker::compareBlock() and spilled per row as
+            (count, columns, scores). The rows of shard a are then
+            emitted by reading the spills of blocks a .. S - 1 in turn,
+            which restores increasing j. The last row shard has a
+            single block and is emitted without spilling.
+    */
+    bool compareAll(int threadCount, ResultSink& sink,
+                    double minScore = -std::numeric_limits<double>::infinity()) const;
+
+    /*
+        Objective:
+            Report the work done by the last compareAll().
+
+        Input:
+            None.
+
+        Output:
+            blockCount()   : shard blocks scored.
+            spilledBytes() : bytes written to spill files.
+
+        Side Effects:
+            None.
+    */
+    size_t blockCount() const;
+    uint64_t spilledBytes() const;
+};
+
+#endif // SHARDSTORE_H
@@ -1,6 +1,192 @@
 #include "SimilarityChecker.h"
+#include "ThreadPool.h"
+#include "SparseMatrix.h"
+#include "DenseKernels.h"
 #include <cmath>
 #include <algorithm>
+#include <limits>
+#include <memory_resource>
+#include <utility>
+
+namespace {
+
+// Collects streamed pairs as name tuples for the vector-returning API
+class TupleCollector : public ResultSink {
+public:
+    std::vector<std::tuple<std::string, std::string, double>> results;
+
+    TupleCollector(const SimilarityChecker& owner, size_t expected) : checker(owner) {
+        results.reserve(expected);
+    }
+
+    void accept(int doc1, int doc2, double score) override {
+        results.emplace_back(checker.getDocumentName(doc1),
+                             checker.getDocumentName(doc2), score);
+    }
+
+private:
+    const SimilarityChecker& checker;
+};
+
+// Collects streamed pairs by index
+class PairCollector : public ResultSink {
+public:
+    std::vector<SimilarityPair> results;
+
+    void accept(int doc1, int doc2, double score) override {
+        results.push_back({doc1, doc2, score});
+    }
+};
+
+// Forwards only the pairs scoring above a threshold
+class AboveThresholdSink : public ResultSink {
+public:
+    AboveThresholdSink(ResultSink& target, double threshold) : sink(target), minScore(threshold) {}
+
+    void accept(int doc1, int doc2, double score) override {
+        if (score > minScore) {
+            sink.accept(doc1, doc2, score);
+        }
+    }
+
+private:
+    ResultSink& sink;
+    double minScore;
+};
+
+// Forwards the score of every pair of stored vectors to all pairs of
+// corpus documents sharing those two vectors
+class ExpandingSink : public ResultSink {
+public:
+    ExpandingSink(ResultSink& target, const std::vector<std::vector<int>>& groupMembers)
+        : sink(target), members(groupMembers) {}
+
+    void accept(int group1, int group2, double score) override {
+        for (int doc1 : members[group1]) {
+            for (int doc2 : members[group2]) {
+                sink.accept(std::min(doc1, doc2), std::max(doc1, doc2), score);
+            }
+        }
+    }
+
+private:
+    ResultSink& sink;
+    const std::vector<std::vector<int>>& members;
+};
+
+// Entries an exceedsBound() walk fetches ahead of the one it reads
+constexpr size_t prefetchDistance = 32;
+
+// Pairs this close below the threshold are always scored exactly; the
+// slack absorbs the rounding of the residual norms below
+constexpr double boundSlack = 1e-6;
+
+// Bounded walk of a threshold-only search: take the entries of the unit
+// vector 'walked' at positions order[0, count), heaviest weight first,
+// and fetch the other unit vector's weight of each term with
+// weightOf(term) (0.0 if absent). The terms still to come are disjoint
+// from those seen, so by Cauchy-Schwarz they add at most |rest of
+// walked| x |unmatched rest of the other|; false as soon as the partial
+// sum plus that bound cannot exceed threshold
+template <typename WeightOf>
+bool exceedsBound(const SparseVector& walked, const uint32_t* order, size_t count,
+                  WeightOf weightOf, double threshold) {
+    double target = threshold - boundSlack;
+    double partial = 0.0;
+    double restOrdered = 1.0;
+    double restOther = 1.0;
+
+    for (size_t k = 0; k < count; k++) {
+#if defined(__GNUC__)
+        // Entries are visited out of memory order; fetch ahead
+        if (k + prefetchDistance < count) {
+            __builtin_prefetch(&walked[order[k + prefetchDistance]]);
+        }
+#endif
+        const SparseEntry& entry = walked[order[k]];
+        double other = weightOf(entry.termId);
+
+        partial += entry.weight * other;
+        restOrdered -= entry.weight * entry.weight;
+        restOther -= other * other;
+
+        double gap = target - partial;
+
+        if (gap > 0.0 && gap * gap > std::max(restOrdered, 0.0) * std::max(restOther, 0.0)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Every engine reports a dot product of unit vectors clamped to [0, 1]:
+// rounding can put identical vectors just above 1.0, and signed feature
+// hashing can make unrelated documents score below 0.0
+double clampScore(double dot) {
+    return std::clamp(dot, 0.0, 1.0);
+}
+
+// Number of pairs (i, j) with i < j among numDocs documents
+size_t pairCountOf(int numDocs) {
+    return (numDocs < 2) ? 0 : static_cast<size_t>(numDocs) * (numDocs - 1) / 2;
+}
+
+// Band loop of compareBlock() / compareRows(): scatter every CSR row of
+// 'matrix' into a scratch row over the transposed column documents;
+// local row r is reported as rowBase + r
+void scoreBands(const SparseMatrix& matrix, int rowBase, const SparseMatrix& block, int width,
+                int threadCount, const SimilarityChecker::BlockConsumer& consumer) {
+
+    int numRows = static_cast<int>(matrix.rowCount());
+
+    ThreadPool pool(threadCount);
+
+    const size_t bandCells = 1u << 20;
+
+    int bandRows = static_cast<int>(
+        std::clamp<size_t>(bandCells / width, 1, static_cast<size_t>(numRows)));
+
+    std::vector<double> scores(static_cast<size_t>(bandRows) * width);
+    std::vector<std::vector<double>> scratch(pool.size(), std::vector<double>(width, 0.0));
+
+    for (int bandBegin = 0; bandBegin < numRows; bandBegin += bandRows) {
+        int bandEnd = std::min(bandBegin + bandRows, numRows);
+
+        pool.run(static_cast<size_t>(bandEnd - bandBegin), [&](size_t r, int worker) {
+            size_t local = static_cast<size_t>(bandBegin) + r;
+
+            const uint32_t* terms = matrix.rowColumns(local);
+            const double* weights = matrix.rowValues(local);
+            size_t length = matrix.rowLength(local);
+            std::vector<double>& row = scratch[worker];
+
+            for (size_t k = 0; k < length; k++) {
+                const uint32_t* docs = block.rowColumns(terms[k]);
+                const double* docWeights = block.rowValues(terms[k]);
+                size_t postings = block.rowLength(terms[k]);
+                double weight = weights[k];
+
+                for (size_t p = 0; p < postings; p++) {
+                    row[docs[p]] += weight * docWeights[p];
+                }
+            }
+
+            double* out = scores.data() + r * width;
+
+            for (int j = 0; j < width; j++) {
+                // call clampScore()
+                out[j] = clampScore(row[j]);
+            }
+
+            std::fill(row.begin(), row.end(), 0.0);
+        });
+
+        consumer(rowBase + bandBegin, rowBase + bandEnd, scores.data());
+    }
+}
+
+} // namespace
 
 /*
 -------------------------------------------------
@@ -10,7 +196,7 @@ Objective:
     Initialize TF-IDF vectors and document names for comparison.
 
 Input:
-    vectors → TF-IDF maps for each document.
+    vectors → Sparse TF-IDF vectors for each document.
     names   → Document file names.
 
 Output:
@@ -20,12 +206,31 @@ Side Effect:
     Stores vectors and names internally.
 
 Approach:
-    Assign vectors and names to internal variables.
+    Move vectors and names into internal variables, then compute
+    each norm once and divide the vector by it.
+
+    // call magnitude()
 */
 SimilarityChecker::SimilarityChecker(
-        const std::vector<std::map<std::string, double>>& vectors,
-        const std::vector<std::string>& names)
-    : tfidfVectors(vectors), documentNames(names) {
+        std::vector<SparseVector> vectors,
+        std::vector<std::string> names)
+    : tfidfVectors(std::move(vectors)), documentNames(std::move(names)) {
+
+    norms.reserve(tfidfVectors.size());
+
+    for (auto& vec : tfidfVectors) {
+        // call magnitude()
+        double norm = magnitude(vec);
+        norms.push_back(norm);
+
+        if (norm == 0.0) {
+            continue;
+        }
+
+        for (auto& entry : vec) {
+            entry.weight /= norm;
+        }
+    }
 }
 
 /*
@@ -46,31 +251,208 @@ Side Effect:
     None.
 
 Approach:
-    Iterate over smaller vector and multiply values where keys match.
+    Both vectors are sorted by term ID, so advance two cursors in a
+    linear merge and multiply values where IDs match.
 */
 double SimilarityChecker::dotProduct(
-        const std::map<std::string, double>& vec1,
-        const std::map<std::string, double>& vec2) const {
+        const SparseVector& vec1,
+        const SparseVector& vec2) const {
 
     double result = 0.0;
 
-    const auto& smaller = (vec1.size() < vec2.size()) ? vec1 : vec2;
-    const auto& larger  = (vec1.size() < vec2.size()) ? vec2 : vec1;
+    size_t i = 0;
+    size_t j = 0;
 
-    for (const auto& pair : smaller) {
-        const std::string& term = pair.first;
-        double value1 = pair.second;
+    while (i < vec1.size() && j < vec2.size()) {
+        uint32_t term1 = vec1[i].termId;
+        uint32_t term2 = vec2[j].termId;
 
-        auto it = larger.find(term);
-        if (it != larger.end()) {
-            double value2 = it->second;
-            result += value1 * value2;
+        if (term1 == term2) {
+            result += vec1[i].weight * vec2[j].weight;
+            i++;
+            j++;
+        }
+        else if (term1 < term2) {
+            i++;
+        }
+        else {
+            j++;
         }
     }
 
     return result;
 }
 
+/*
+-------------------------------------------------
+Function Name : magnitudeOrder()
+
+Objective:
+    Order every vector's entries by decreasing magnitude.
+
+Input:
+    None.
+
+Output:
+    Entry positions of every document in magnitude order.
+
+Side Effect:
+    None.
+
+Approach:
+    Number each vector's entries and stable-sort the numbers by
+    |weight|, so equal weights stay in term ID order.
+*/
+SimilarityChecker::MagnitudeOrder SimilarityChecker::magnitudeOrder() const {
+
+    MagnitudeOrder ordered;
+    ordered.offsets.reserve(tfidfVectors.size() + 1);
+    ordered.offsets.push_back(0);
+
+    for (const auto& vec : tfidfVectors) {
+        ordered.offsets.push_back(ordered.offsets.back() + vec.size());
+    }
+
+    ordered.positions.resize(ordered.offsets.back());
+
+    for (size_t d = 0; d < tfidfVectors.size(); d++) {
+        const SparseVector& vec = tfidfVectors[d];
+        auto first = ordered.positions.begin() + static_cast<std::ptrdiff_t>(ordered.offsets[d]);
+        auto last = first + static_cast<std::ptrdiff_t>(vec.size());
+
+        for (auto at = first; at != last; ++at) {
+            *at = static_cast<uint32_t>(at - first);
+        }
+
+        std::stable_sort(first, last, [&vec](uint32_t a, uint32_t b) {
+            return std::abs(vec[a].weight) > std::abs(vec[b].weight);
+        });
+    }
+
+    return ordered;
+}
+
+/*
+-------------------------------------------------
+Function Name : RowWeights::assign()
+
+Objective:
+    Load one document's weights for lookups by term ID.
+
+Input:
+    vec → Document vector.
+
+Output:
+    None.
+
+Side Effect:
+    Replaces the previous document.
+
+Approach:
+    Reset the markers of the previous document, then mark every
+    entry of the new one and copy its weights after weights[0].
+*/
+void SimilarityChecker::RowWeights::assign(const SparseVector& vec) {
+    if (document) {
+        for (const auto& entry : *document) {
+            markers[entry.termId] = 0;
+        }
+    }
+
+    weights.resize(vec.size() + 1);
+
+    for (size_t k = 0; k < vec.size(); k++) {
+        markers[vec[k].termId] = static_cast<uint32_t>(k + 1);
+        weights[k + 1] = vec[k].weight;
+    }
+
+    document = &vec;
+}
+
+/*
+-------------------------------------------------
+Function Name : boundedSimilarity()
+
+Objective:
+    Score one pair of a threshold-only search.
+
+Input:
+    doc1Index → First document.
+    doc2Index → Second document.
+    ordered    → magnitudeOrder() of the corpus.
+    rowWeights → doc1's weights by term ID, or nullptr.
+    threshold → Score to exceed.
+
+Output:
+    Exact cosine similarity, or -infinity if abandoned.
+
+Side Effect:
+    None.
+
+Approach:
+    Empty documents score 0.0 without a walk. With doc1's
+    rowWeights, walk doc2 in magnitude order with one table lookup
+    per term; otherwise walk the shorter vector and binary-search
+    the other. Survivors are scored with cosineSimilarity().
+
+    // call exceedsBound()
+    // call cosineSimilarity()
+*/
+double SimilarityChecker::boundedSimilarity(int doc1Index, int doc2Index,
+                                            const MagnitudeOrder& ordered,
+                                            const RowWeights* rowWeights,
+                                            double threshold) const {
+
+    const double abandoned = -std::numeric_limits<double>::infinity();
+
+    if (norms[doc1Index] == 0.0 || norms[doc2Index] == 0.0) {
+        return (0.0 > threshold) ? 0.0 : abandoned;
+    }
+
+    bool mayExceed;
+
+    // Positions of a document's entries in magnitude order
+    auto walkOrder = [&ordered](int doc) {
+        return ordered.positions.data() + ordered.offsets[doc];
+    };
+
+    if (rowWeights) {
+        // call exceedsBound()
+        mayExceed = exceedsBound(tfidfVectors[doc2Index], walkOrder(doc2Index),
+                                 tfidfVectors[doc2Index].size(),
+                                 [rowWeights](uint32_t term) { return rowWeights->weightOf(term); },
+                                 threshold);
+    } else {
+        int walked = doc1Index;
+        int probed = doc2Index;
+
+        if (tfidfVectors[walked].size() > tfidfVectors[probed].size()) {
+            std::swap(walked, probed);
+        }
+
+        const SparseVector& sorted = tfidfVectors[probed];
+
+        auto weightOf = [&sorted](uint32_t term) {
+            auto match = std::lower_bound(sorted.begin(), sorted.end(), term,
+                                          [](const SparseEntry& entry, uint32_t id) {
+                                              return entry.termId < id;
+                                          });
+            return (match != sorted.end() && match->termId == term) ? match->weight : 0.0;
+        };
+
+        // call exceedsBound()
+        mayExceed = exceedsBound(tfidfVectors[walked], walkOrder(walked),
+                                 tfidfVectors[walked].size(), weightOf, threshold);
+    }
+
+    if (!mayExceed) {
+        return abandoned;
+    }
+
+    // call cosineSimilarity()
+    return cosineSimilarity(doc1Index, doc2Index);
+}
+
 /*
 -------------------------------------------------
 Function Name : magnitude()
@@ -91,12 +473,12 @@ Approach:
     Square each value, sum them, then take square root.
 */
 double SimilarityChecker::magnitude(
-        const std::map<std::string, double>& vec) const {
+        const SparseVector& vec) const {
 
     double sum = 0.0;
 
-    for (const auto& pair : vec) {
-        double value = pair.second;
+    for (const auto& entry : vec) {
+        double value = entry.weight;
         sum += value * value;
     }
 
@@ -105,99 +487,1492 @@ double SimilarityChecker::magnitude(
 
 /*
 -------------------------------------------------
-Function Name : cosineSimilarity()
+Function Name : compareQueries()
 
 Objective:
-    Compute similarity between two documents using cosine similarity formula.
+    Compare query documents with all documents before them.
 
 Input:
-    doc1Index → Index of first document.
-    doc2Index → Index of second document.
+    firstQuery → Index of the first query document.
+    minScore   → Exclusive lower bound on kept scores.
 
 Output:
-    Double in range [0.0, 1.0].
+    Vector of pairs, (corpus or earlier query, query).
 
 Side Effect:
     None.
 
-
 Approach:
-    Use dot product divided by product of magnitudes.
+    Collect the streaming overload's pairs.
 
-    // call dotProduct()
-    // call magnitude()
+    // call compareQueries() (sink overload)
 */
-double SimilarityChecker::cosineSimilarity(int doc1Index, int doc2Index) const {
+std::vector<SimilarityPair>
+SimilarityChecker::compareQueries(int firstQuery, double minScore) const {
 
-    if (doc1Index < 0 || doc1Index >= static_cast<int>(tfidfVectors.size()) ||
-        doc2Index < 0 || doc2Index >= static_cast<int>(tfidfVectors.size())) {
-        return 0.0;
+    PairCollector collector;
+
+    // call compareQueries() (sink overload)
+    compareQueries(firstQuery, minScore, collector);
+
+    return std::move(collector.results);
+}
+
+/*
+-------------------------------------------------
+Function Name : compareQueries() (sink overload)
+
+Objective:
+    Stream query pairs into a sink.
+
+Input:
+    firstQuery → Index of the first query document.
+    minScore   → Exclusive lower bound on delivered scores.
+    sink       → Result consumer.
+
+Output:
+    None.
+
+Side Effect:
+    Calls the sink.
+
+Approach:
+    Build an inverted index of all unit vectors. For each query,
+    accumulate dot products over its terms' postings with smaller
+    document indices; the products are summed in term order, as
+    in dotProduct(), so scores match cosineSimilarity() exactly.
+*/
+void SimilarityChecker::compareQueries(int firstQuery, double minScore,
+                                       ResultSink& sink) const {
+
+    int numDocs = static_cast<int>(tfidfVectors.size());
+    scoredPairs = 0;
+
+    if (firstQuery < 0) {
+        firstQuery = 0;
     }
 
-    if (doc1Index == doc2Index) {
-        return 1.0;
+    if (firstQuery >= numDocs) {
+        return;
     }
 
-    const auto& vec1 = tfidfVectors[doc1Index];
-    const auto& vec2 = tfidfVectors[doc2Index];
+    // All postings lists share one arena, released in one shot on return
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::vector<std::pmr::vector<WeightedPosting>> index(termSpace(), &arena);
 
-    // call dotProduct()
-    double dot  = dotProduct(vec1, vec2);
+    for (int d = 0; d < numDocs; d++) {
+        for (const auto& entry : tfidfVectors[d]) {
+            index[entry.termId].push_back({d, entry.weight});
+        }
+    }
 
-    // call magnitude()
-    double mag1 = magnitude(vec1);
-    double mag2 = magnitude(vec2);
+    std::vector<double> accumulator(numDocs, 0.0);
+    // Last document whose scan reached each document; weights can be
+    // negative (feature hashing), so a zero accumulator is no marker
+    std::vector<int> touchedBy(numDocs, -1);
+    std::vector<int> touched;
 
-    if (mag1 == 0.0 || mag2 == 0.0) {
-        return 0.0;
+    for (int q = firstQuery; q < numDocs; q++) {
+
+        // Postings are sorted by docId, so stop at the query itself
+        for (const auto& entry : tfidfVectors[q]) {
+            for (const auto& posting : index[entry.termId]) {
+                if (posting.docId >= q) {
+                    break;
+                }
+                if (touchedBy[posting.docId] != q) {
+                    touchedBy[posting.docId] = q;
+                    touched.push_back(posting.docId);
+                }
+                accumulator[posting.docId] += entry.weight * posting.weight;
+            }
+        }
+
+        scoredPairs += (minScore < 0.0) ? static_cast<size_t>(q) : touched.size();
+
+        if (minScore < 0.0) {
+            for (int d = 0; d < q; d++) {
+                sink.accept(d, q, clampScore(accumulator[d]));
+                accumulator[d] = 0.0;
+            }
+        } else {
+            std::sort(touched.begin(), touched.end());
+
+            for (int d : touched) {
+                double similarity = clampScore(accumulator[d]);
+                if (similarity > minScore) {
+                    sink.accept(d, q, similarity);
+                }
+                accumulator[d] = 0.0;
+            }
+        }
+
+        touched.clear();
     }
+}
+
+/*
+-------------------------------------------------
+Function Name : getDocumentName()
+
+Objective:
+    Build the label of a document for result tuples.
+
+Input:
+    index → Document index.
+
+Output:
+    Document name or generated placeholder.
+
+Side Effect:
+    None.
 
-    return dot / (mag1 * mag2);
+Approach:
+    Use stored name when available, otherwise "Document<index>".
+*/
+std::string SimilarityChecker::getDocumentName(int index) const {
+    if (index < static_cast<int>(documentNames.size())) {
+        return documentNames[index];
+    }
+    return "Document" + std::to_string(index);
 }
 
 /*
 -------------------------------------------------
-Function Name : compareAll()
+Function Name : getDocumentNames()
 
 Objective:
-    Compare all document pairs and compute similarity values.
+    Expose stored document names.
 
 Input:
     None.
 
 Output:
-    Vector of tuples (docName1, docName2, similarityScore).
+    Reference to the name list.
 
 Side Effect:
     None.
 
 Approach:
-    Iterate through all document pairs and compute cosine similarity.
+    Return internal container directly.
+*/
+const std::vector<std::string>& SimilarityChecker::getDocumentNames() const {
+    return documentNames;
+}
 
-    // call cosineSimilarity()
+/*
+-------------------------------------------------
+Function Name : getVector()
+
+Objective:
+    Expose one normalized vector.
+
+Input:
+    index → Document index.
+
+Output:
+    Reference to the stored vector.
+
+Side Effect:
+    None.
+
+Approach:
+    Return internal vector directly.
 */
-std::vector<std::tuple<std::string, std::string, double>> 
-SimilarityChecker::compareAll() const {
+const SparseVector& SimilarityChecker::getVector(int index) const {
+    return tfidfVectors[index];
+}
 
-    std::vector<std::tuple<std::string, std::string, double>> results;
+/*
+-------------------------------------------------
+Function Name : documentCount()
 
-    int numDocs = static_cast<int>(tfidfVectors.size());
+Objective:
+    Retrieve number of stored documents.
 
-    for (int i = 0; i < numDocs; i++) {
-        for (int j = i + 1; j < numDocs; j++) {
+Input:
+    None.
 
-            // call cosineSimilarity()
-            double similarity = cosineSimilarity(i, j);
+Output:
+    Document count.
+
+Side Effect:
+    None.
 
-            std::string name1 = (i < static_cast<int>(documentNames.size()))
-                                ? documentNames[i]
-                                : "Document" + std::to_string(i);
+Approach:
+    Return number of stored vectors.
+*/
+int SimilarityChecker::documentCount() const {
+    return static_cast<int>(tfidfVectors.size());
+}
+
+/*
+-------------------------------------------------
+Function Name : lastScoredPairs()
+
+Objective:
+    Retrieve the work counter of the last search.
+
+Input:
+    None.
+
+Output:
+    Number of scored pairs.
+
+Side Effect:
+    None.
+
+Approach:
+    Return stored counter.
+*/
+size_t SimilarityChecker::lastScoredPairs() const {
+    return scoredPairs;
+}
+
+/*
+-------------------------------------------------
+Function Name : tileSize()
+
+Objective:
+    Pick tile edge length for blocked pair enumeration.
+
+Input:
+    None.
+
+Output:
+    Documents per tile block.
+
+Side Effect:
+    None.
+
+Approach:
+    Two blocks of average-sized vectors should fit in 256 KB;
+    clamp the result to [16, 1024] documents.
+*/
+int SimilarityChecker::tileSize() const {
+    const size_t cacheBytes = 256 * 1024;
+
+    size_t totalEntries = 0;
+    for (const auto& vec : tfidfVectors) {
+        totalEntries += vec.size();
+    }
+
+    size_t docs = tfidfVectors.empty() ? 1 : tfidfVectors.size();
+    size_t bytesPerVector = (totalEntries / docs + 1) * sizeof(SparseEntry);
+
+    size_t tile = cacheBytes / (2 * bytesPerVector);
+    return static_cast<int>(std::clamp<size_t>(tile, 16, 1024));
+}
+
+/*
+-------------------------------------------------
+Function Name : termSpace()
+
+Objective:
+    Find the extent of term IDs used by the vectors.
+
+Input:
+    None.
+
+Output:
+    One past the largest term ID.
+
+Side Effect:
+    None.
+
+Approach:
+    Vectors are sorted by term ID, so check the last entry of each.
+*/
+size_t SimilarityChecker::termSpace() const {
+    size_t space = 0;
+
+    for (const auto& vec : tfidfVectors) {
+        if (!vec.empty()) {
+            space = std::max(space, static_cast<size_t>(vec.back().termId) + 1);
+        }
+    }
+
+    return space;
+}
+
+/*
+-------------------------------------------------
+Function Name : cosineSimilarity()
+
+Objective:
+    Compute similarity between two documents using cosine similarity formula.
+
+Input:
+    doc1Index → Index of first document.
+    doc2Index → Index of second document.
+
+Output:
+    Double in range [0.0, 1.0].
+
+Side Effect:
+    None.
+
+
+Approach:
+    Stored vectors are unit length, so the dot product is the
+    cosine; norms cached at construction detect empty documents.
+
+    // call dotProduct()
+*/
+double SimilarityChecker::cosineSimilarity(int doc1Index, int doc2Index) const {
+
+    if (doc1Index < 0 || doc1Index >= static_cast<int>(tfidfVectors.size()) ||
+        doc2Index < 0 || doc2Index >= static_cast<int>(tfidfVectors.size())) {
+        return 0.0;
+    }
+
+    if (doc1Index == doc2Index) {
+        return 1.0;
+    }
+
+    if (norms[doc1Index] == 0.0 || norms[doc2Index] == 0.0) {
+        return 0.0;
+    }
+
+    // call dotProduct()
+    double dot = dotProduct(tfidfVectors[doc1Index], tfidfVectors[doc2Index]);
+
+    // call clampScore()
+    return clampScore(dot);
+}
+
+/*
+-------------------------------------------------
+Function Name : compareAll()
+
+Objective:
+    Compare all document pairs and compute similarity values.
+
+Input:
+    None.
+
+Output:
+    Vector of tuples (docName1, docName2, similarityScore).
+
+Side Effect:
+    None.
+
+Approach:
+    Collect the streaming overload's pairs as name tuples.
+
+    // call compareAll() (sink overload)
+*/
+std::vector<std::tuple<std::string, std::string, double>> 
+SimilarityChecker::compareAll() const {
+
+    TupleCollector collector(*this, pairCountOf(documentCount()));
+
+    // call compareAll() (sink overload)
+    compareAll(collector);
+
+    return std::move(collector.results);
+}
+
+/*
+-------------------------------------------------
+Function Name : compareAll() (sink overload)
+
+Objective:
+    Stream all document pairs into a sink.
+
+Input:
+    sink → Result consumer.
+
+Output:
+    None.
+
+Side Effect:
+    Calls the sink once per pair.
+
+Approach:
+    Iterate through all document pairs, compute cosine similarity
+    and hand each score straight to the sink.
+
+    // call cosineSimilarity()
+*/
+void SimilarityChecker::compareAll(ResultSink& sink) const {
+
+    int numDocs = static_cast<int>(tfidfVectors.size());
+    scoredPairs = pairCountOf(numDocs);
+
+    for (int i = 0; i < numDocs; i++) {
+        for (int j = i + 1; j < numDocs; j++) {
+
+            // call cosineSimilarity()
+            sink.accept(i, j, cosineSimilarity(i, j));
+        }
+    }
+}
+
+/*
+-------------------------------------------------
+Function Name : streamTiles()
+
+Objective:
+    Run an all-pairs tile kernel band by band and stream the scores.
+
+Input:
+    pool   → Worker threads.
+    tile   → Column block width.
+    kernel → Tile kernel.
+    sink   → Result consumer.
+
+Output:
+    None.
+
+Side Effect:
+    Calls the sink once per pair, in serial i-major order.
+
+Approach:
+    Bands of rows are sized so a band buffer holds at most about
+    one million scores (8 MB). Band b is scored by one pool batch
+    with a task per column block it reaches; task 0 of the same
+    batch emits band b - 1 from the other buffer, so the sink runs
+    next to the kernels. The last band is emitted after the loop.
+*/
+void SimilarityChecker::streamTiles(ThreadPool& pool, int tile, const TileKernel& kernel,
+                                    ResultSink& sink) const {
+
+    int numDocs = static_cast<int>(tfidfVectors.size());
+
+    if (numDocs < 2) {
+        return;
+    }
+
+    const size_t bandCells = 1u << 20;
+
+    int blocks = (numDocs + tile - 1) / tile;
+    int bandRows = static_cast<int>(
+        std::clamp<size_t>(bandCells / numDocs, 1, static_cast<size_t>(tile)));
+
+    std::vector<double> bands[2];
+    bands[0].resize(static_cast<size_t>(bandRows) * numDocs);
+    bands[1].resize(static_cast<size_t>(bandRows) * numDocs);
+
+    auto emit = [&](const std::vector<double>& scores, int rowBegin, int rowEnd) {
+        for (int i = rowBegin; i < rowEnd; i++) {
+            const double* row = scores.data() + static_cast<size_t>(i - rowBegin) * numDocs;
+            for (int j = i + 1; j < numDocs; j++) {
+                sink.accept(i, j, row[j]);
+            }
+        }
+    };
+
+    int current = 0;
+    int pendingBegin = 0;
+    int pendingEnd = 0;
+
+    // The last row has no pairs of its own
+    for (int bandBegin = 0; bandBegin < numDocs - 1; bandBegin += bandRows) {
+        int bandEnd = std::min(bandBegin + bandRows, numDocs);
+        int firstBlock = bandBegin / tile;
+        size_t pending = (pendingEnd > pendingBegin) ? 1 : 0;
+
+        double* scores = bands[current].data();
+        const std::vector<double>& previous = bands[1 - current];
+
+        pool.run(static_cast<size_t>(blocks - firstBlock) + pending, [&](size_t t, int worker) {
+            if (pending) {
+                if (t == 0) {
+                    emit(previous, pendingBegin, pendingEnd);
+                    return;
+                }
+                t--;
+            }
+            kernel(bandBegin, bandEnd, firstBlock + static_cast<int>(t), worker, scores);
+        });
+
+        pendingBegin = bandBegin;
+        pendingEnd = bandEnd;
+        current = 1 - current;
+    }
+
+    emit(bands[1 - current], pendingBegin, pendingEnd);
+}
+
+/*
+-------------------------------------------------
+Function Name : compareAllParallel()
+
+Objective:
+    Compare all document pairs on multiple threads.
+
+Input:
+    threadCount → Number of worker threads.
+
+Output:
+    Vector of tuples (docName1, docName2, similarityScore),
+    identical to compareAll().
+
+Side Effect:
+    Uses worker threads.
+
+Approach:
+    Collect the streaming overload's pairs as name tuples.
+
+    // call compareAllParallel() (sink overload)
+*/
+std::vector<std::tuple<std::string, std::string, double>>
+SimilarityChecker::compareAllParallel(int threadCount) const {
+
+    TupleCollector collector(*this, pairCountOf(documentCount()));
+
+    // call compareAllParallel() (sink overload)
+    compareAllParallel(threadCount, collector);
+
+    return std::move(collector.results);
+}
+
+/*
+-------------------------------------------------
+Function Name : compareAllParallel() (sink overload)
+
+Objective:
+    Stream all document pairs, scored on multiple threads.
+
+Input:
+    threadCount → Number of worker threads.
+    sink        → Result consumer.
+
+Output:
+    None.
+
+Side Effect:
+    Uses worker threads; calls the sink once per pair.
+
+Approach:
+    Score tiles of tileSize() columns pair by pair on a
+    work-stealing ThreadPool and stream them with streamTiles().
+
+    // call cosineSimilarity()
+    // call streamTiles()
+*/
+void SimilarityChecker::compareAllParallel(int threadCount, ResultSink& sink) const {
+
+    ThreadPool pool(threadCount);
+
+    if (pool.size() == 1) {
+        compareAll(sink);
+        return;
+    }
+
+    int numDocs = static_cast<int>(tfidfVectors.size());
+    int tile = tileSize();
+    scoredPairs = pairCountOf(numDocs);
+
+    auto kernel = [&](int rowBegin, int rowEnd, int colBlock, int, double* scores) {
+        int colBegin = colBlock * tile;
+        int colEnd   = std::min(colBegin + tile, numDocs);
+
+        for (int i = rowBegin; i < rowEnd; i++) {
+            double* row = scores + static_cast<size_t>(i - rowBegin) * numDocs;
+
+            for (int j = std::max(colBegin, i + 1); j < colEnd; j++) {
+                // call cosineSimilarity()
+                row[j] = cosineSimilarity(i, j);
+            }
+        }
+    };
+
+    // call streamTiles()
+    streamTiles(pool, tile, kernel, sink);
+}
+
+/*
+-------------------------------------------------
+Function Name : compareAllAbove()
+
+Objective:
+    Stream the pairs scoring above a threshold, abandoning the
+    others early.
+
+Input:
+    threshold   → Exclusive lower bound on reported scores.
+    threadCount → Number of worker threads.
+    sink        → Result consumer.
+
+Output:
+    None.
+
+Side Effect:
+    Uses worker threads; calls the sink once per reported pair.
+
+Approach:
+    Order the vectors by magnitude once. The tile kernel of
+    compareAllParallel() loads each row document into its
+    worker's RowWeights table and runs every pair of the row
+    through boundedSimilarity(); abandoned cells hold -infinity
+    and are dropped on the way into the sink. Walks read the
+    column documents out of memory order, so tiles keep them in
+    cache even for one worker. Pairs scored to completion are
+    counted per worker.
+
+    // call magnitudeOrder()
+    // call boundedSimilarity()
+    // call streamTiles()
+*/
+void SimilarityChecker::compareAllAbove(double threshold, int threadCount,
+                                        ResultSink& sink) const {
+
+    int numDocs = static_cast<int>(tfidfVectors.size());
+
+    if (numDocs < 2) {
+        scoredPairs = 0;
+        return;
+    }
+
+    // call magnitudeOrder()
+    MagnitudeOrder ordered = magnitudeOrder();
+
+    ThreadPool pool(threadCount);
+
+    std::vector<RowWeights> rows(pool.size(), RowWeights(termSpace()));
+    std::vector<size_t> scored(pool.size(), 0);
+
+    auto scoreRow = [&](int i, int colBegin, int colEnd, int worker, double* row) {
+        RowWeights& weights = rows[worker];
+        size_t count = 0;
+
+        weights.assign(tfidfVectors[i]);
+
+        for (int j = colBegin; j < colEnd; j++) {
+            // call boundedSimilarity()
+            row[j] = boundedSimilarity(i, j, ordered, &weights, threshold);
+            count += (row[j] != -std::numeric_limits<double>::infinity());
+        }
+
+        scored[worker] += count;
+    };
+
+    int tile = tileSize();
+
+    auto kernel = [&](int rowBegin, int rowEnd, int colBlock, int worker, double* scores) {
+        int colBegin = colBlock * tile;
+        int colEnd   = std::min(colBegin + tile, numDocs);
+
+        for (int i = rowBegin; i < std::min(rowEnd, colEnd - 1); i++) {
+            double* row = scores + static_cast<size_t>(i - rowBegin) * numDocs;
+            scoreRow(i, std::max(colBegin, i + 1), colEnd, worker, row);
+        }
+    };
+
+    AboveThresholdSink above(sink, threshold);
+
+    // call streamTiles()
+    streamTiles(pool, tile, kernel, above);
+
+    scoredPairs = 0;
+    for (size_t count : scored) {
+        scoredPairs += count;
+    }
+}
+
+/*
+-------------------------------------------------
+Function Name : compareAllBlocked()
+
+Objective:
+    Compare all document pairs through a blocked Gram matrix product.
+
+Input:
+    threadCount → Number of worker threads.
+
+Output:
+    Vector of tuples (docName1, docName2, similarityScore),
+    identical to compareAll().
+
+Side Effect:
+    Uses worker threads.
+
+Approach:
+    Collect the streaming overload's pairs as name tuples.
+
+    // call compareAllBlocked() (sink overload)
+*/
+std::vector<std::tuple<std::string, std::string, double>>
+SimilarityChecker::compareAllBlocked(int threadCount) const {
+
+    TupleCollector collector(*this, pairCountOf(documentCount()));
+
+    // call compareAllBlocked() (sink overload)
+    compareAllBlocked(threadCount, collector);
+
+    return std::move(collector.results);
+}
+
+/*
+-------------------------------------------------
+Function Name : compareAllBlocked() (sink overload)
+
+Objective:
+    Stream all document pairs computed by a blocked Gram matrix
+    product.
+
+Input:
+    threadCount → Number of worker threads.
+    sink        → Result consumer.
+
+Output:
+    None.
+
+Side Effect:
+    Uses worker threads; calls the sink once per pair.
+
+Approach:
+    Pack vectors into CSR, transpose one column block per tile
+    column in parallel, then stream upper-triangular tiles with
+    streamTiles(). Each worker owns a dense scratch row of
+    tileSize() accumulators, which is cleared after every row.
+
+    // call streamTiles()
+*/
+void SimilarityChecker::compareAllBlocked(int threadCount, ResultSink& sink) const {
+
+    int numDocs = static_cast<int>(tfidfVectors.size());
+    scoredPairs = pairCountOf(numDocs);
+
+    if (numDocs < 2) {
+        return;
+    }
+
+    ThreadPool pool(threadCount);
+
+    SparseMatrix matrix(tfidfVectors, termSpace());
+
+    int tile = tileSize();
+    int blocks = (numDocs + tile - 1) / tile;
+
+    // Column blocks: term -> (local document, weight) for each tile column
+    std::vector<SparseMatrix> columnBlocks(blocks);
+
+    pool.run(static_cast<size_t>(blocks), [&](size_t b, int) {
+        size_t begin = b * tile;
+        size_t end = std::min(begin + tile, static_cast<size_t>(numDocs));
+        columnBlocks[b] = matrix.transposedRows(begin, end);
+    });
+
+    std::vector<std::vector<double>> scratch(pool.size(), std::vector<double>(tile, 0.0));
+
+    auto kernel = [&](int rowBegin, int rowEnd, int colBlock, int worker, double* scores) {
+        int colBegin = colBlock * tile;
+        int colEnd   = std::min(colBegin + tile, numDocs);
+
+        const SparseMatrix& block = columnBlocks[colBlock];
+        std::vector<double>& row = scratch[worker];
+
+        for (int i = rowBegin; i < rowEnd; i++) {
+            const uint32_t* terms = matrix.rowColumns(i);
+            const double* weights = matrix.rowValues(i);
+            size_t length = matrix.rowLength(i);
+
+            // Scatter x_i[t] * y[t] into the scratch row
+            for (size_t k = 0; k < length; k++) {
+                const uint32_t* docs = block.rowColumns(terms[k]);
+                const double* docWeights = block.rowValues(terms[k]);
+                size_t postings = block.rowLength(terms[k]);
+                double weight = weights[k];
+
+                for (size_t p = 0; p < postings; p++) {
+                    row[docs[p]] += weight * docWeights[p];
+                }
+            }
+
+            double* out = scores + static_cast<size_t>(i - rowBegin) * numDocs;
+
+            for (int j = std::max(colBegin, i + 1); j < colEnd; j++) {
+                // call clampScore()
+                out[j] = clampScore(row[j - colBegin]);
+            }
+
+            std::fill(row.begin(), row.begin() + (colEnd - colBegin), 0.0);
+        }
+    };
+
+    // call streamTiles()
+    streamTiles(pool, tile, kernel, sink);
+}
+
+/*
+-------------------------------------------------
+Function Name : compareBlock()
+
+Objective:
+    Score a range of documents against a range of another checker.
+
+Input:
+    rowBegin, rowEnd → Row documents.
+    columns          → Checker holding the column documents.
+    colBegin, colEnd → Column documents.
+    threadCount      → Number of worker threads.
+    consumer         → Receives the scores band by band.
+
+Output:
+    None.
+
+Side Effect:
+    Uses worker threads; calls the consumer once per band.
+
+Approach:
+    Pack both ranges into CSR over a shared term space and transpose
+    the columns once. Bands of rows are sized so a band buffer holds
+    about one million scores; each row is one pool task that scatters
+    into its worker's scratch row of W accumulators, exactly as
+    compareAllBlocked() does for one tile.
+
+    // call scoreBands()
+*/
+void SimilarityChecker::compareBlock(int rowBegin, int rowEnd,
+                                     const SimilarityChecker& columns, int colBegin, int colEnd,
+                                     int threadCount, const BlockConsumer& consumer) const {
+
+    int numRows = rowEnd - rowBegin;
+    int width = colEnd - colBegin;
+    scoredPairs = (numRows > 0 && width > 0) ? static_cast<size_t>(numRows) * width : 0;
+
+    if (numRows <= 0 || width <= 0) {
+        return;
+    }
+
+    size_t space = std::max(termSpace(), columns.termSpace());
+
+    SparseMatrix matrix(tfidfVectors, rowBegin, rowEnd, space);
+    SparseMatrix block = SparseMatrix(columns.tfidfVectors, colBegin, colEnd, space)
+                             .transposedRows(0, static_cast<size_t>(width));
+
+    // call scoreBands()
+    scoreBands(matrix, rowBegin, block, width, threadCount, consumer);
+}
+
+/*
+-------------------------------------------------
+Function Name : compareTile()
+
+Objective:
+    Keep the pairs of one tile that score above a minimum.
+
+Input:
+    rowBegin, rowEnd → Row documents.
+    colBegin, colEnd → Column documents.
+    minScore         → Pairs must score above it.
+    threadCount      → Number of worker threads.
+
+Output:
+    Qualifying pairs (i < j) in i-major order.
+
+Side Effect:
+    Uses worker threads.
+
+Approach:
+    Score the tile with compareBlock() and filter each band.
+
+    // call compareBlock()
+*/
+std::vector<SimilarityPair> SimilarityChecker::compareTile(int rowBegin, int rowEnd,
+                                                           int colBegin, int colEnd,
+                                                           double minScore,
+                                                           int threadCount) const {
+    std::vector<SimilarityPair> pairs;
+    int width = colEnd - colBegin;
+
+    // call compareBlock()
+    compareBlock(rowBegin, rowEnd, *this, colBegin, colEnd, threadCount,
+                 [&](int bandBegin, int bandEnd, const double* scores) {
+        for (int i = bandBegin; i < bandEnd; i++) {
+            const double* row = scores + static_cast<size_t>(i - bandBegin) * width;
+
+            for (int j = std::max(colBegin, i + 1); j < colEnd; j++) {
+                if (row[j - colBegin] > minScore) {
+                    pairs.push_back({i, j, row[j - colBegin]});
+                }
+            }
+        }
+    });
+
+    return pairs;
+}
+
+/*
+-------------------------------------------------
+Function Name : compareRows()
+
+Objective:
+    Score selected documents against all documents.
+
+Input:
+    rows        → Documents to score.
+    threadCount → Number of worker threads.
+    consumer    → Receives the scores band by band.
+
+Output:
+    None.
+
+Side Effect:
+    Uses worker threads; calls the consumer once per band.
+
+Approach:
+    Pack the selected vectors into CSR, transpose the whole corpus
+    once and run the band loop of compareBlock() over them.
+
+    // call scoreBands()
+*/
+void SimilarityChecker::compareRows(const std::vector<int>& rows, int threadCount,
+                                    const BlockConsumer& consumer) const {
+    int width = documentCount();
+    scoredPairs = rows.size() * static_cast<size_t>(width);
+
+    if (rows.empty() || width == 0) {
+        return;
+    }
+
+    std::vector<SparseVector> selected;
+    selected.reserve(rows.size());
+    for (int row : rows) {
+        selected.push_back(tfidfVectors[row]);
+    }
+
+    size_t space = termSpace();
+
+    SparseMatrix matrix(selected, space);
+    SparseMatrix block = SparseMatrix(tfidfVectors, space)
+                             .transposedRows(0, static_cast<size_t>(width));
+
+    // call scoreBands()
+    scoreBands(matrix, 0, block, width, threadCount, consumer);
+}
+
+/*
+-------------------------------------------------
+Function Name : compareAllExpanded()
+
+Objective:
+    Stream all corpus pairs from the scores of collapsed duplicates.
+
+Input:
+    representative → Stored vector of every corpus document.
+    threadCount    → Number of worker threads.
+    sink           → Result consumer.
+
+Output:
+    None.
+
+Side Effect:
+    Uses worker threads; calls the sink for every pair.
+
+Approach:
+    Report the pairs within every group at 1.0, then run the blocked
+    all-pairs engine over the stored vectors only and expand each
+    score to every pair of members of its two groups. Only pairs of
+    distinct vectors count as scored.
+
+    // call compareAllBlocked()
+*/
+void SimilarityChecker::compareAllExpanded(const std::vector<int>& representative,
+                                           int threadCount, ResultSink& sink) const {
+    std::vector<std::vector<int>> members(documentCount());
+
+    for (size_t d = 0; d < representative.size(); d++) {
+        members[representative[d]].push_back(static_cast<int>(d));
+    }
+
+    for (const std::vector<int>& group : members) {
+        for (size_t a = 0; a < group.size(); a++) {
+            for (size_t b = a + 1; b < group.size(); b++) {
+                sink.accept(group[a], group[b], 1.0);
+            }
+        }
+    }
+
+    ExpandingSink expanding(sink, members);
+
+    // call compareAllBlocked()
+    compareAllBlocked(threadCount, expanding);
+}
+
+/*
+-------------------------------------------------
+Function Name : compareAllDense()
+
+Objective:
+    Compare all document pairs on dense float32 rows.
+
+Input:
+    threadCount → Number of worker threads.
+
+Output:
+    Vector of tuples (docName1, docName2, similarityScore) in
+    compareAll() order.
+
+Side Effect:
+    Uses worker threads.
+
+Approach:
+    Collect the streaming overload's pairs as name tuples.
+
+    // call compareAllDense() (sink overload)
+*/
+std::vector<std::tuple<std::string, std::string, double>>
+SimilarityChecker::compareAllDense(int threadCount) const {
+
+    TupleCollector collector(*this, pairCountOf(documentCount()));
+
+    // call compareAllDense() (sink overload)
+    compareAllDense(threadCount, collector);
+
+    return std::move(collector.results);
+}
+
+/*
+-------------------------------------------------
+Function Name : compareAllDense() (sink overload)
+
+Objective:
+    Stream all document pairs scored on dense float32 rows.
+
+Input:
+    threadCount → Number of worker threads.
+    sink        → Result consumer.
+
+Output:
+    None.
+
+Side Effect:
+    Uses worker threads; calls the sink once per pair.
+
+Approach:
+    Compact used term IDs into dense columns, expand the unit
+    vectors into zero-padded float rows, then stream tiles of pairs
+    scored with the dispatched SIMD kernel.
+
+    // call denseDot()
+    // call streamTiles()
+*/
+void SimilarityChecker::compareAllDense(int threadCount, ResultSink& sink) const {
+
+    int numDocs = static_cast<int>(tfidfVectors.size());
+    scoredPairs = pairCountOf(numDocs);
+
+    if (numDocs < 2) {
+        return;
+    }
+
+    ThreadPool pool(threadCount);
+
+    // Dense column of every used term
+    const uint32_t unused = UINT32_MAX;
+    std::vector<uint32_t> column(termSpace(), unused);
+    size_t activeTerms = 0;
+
+    for (const auto& vec : tfidfVectors) {
+        for (const auto& entry : vec) {
+            if (column[entry.termId] == unused) {
+                column[entry.termId] = static_cast<uint32_t>(activeTerms++);
+            }
+        }
+    }
+
+    size_t width = (activeTerms + 15) / 16 * 16;
+    std::vector<float> rows(static_cast<size_t>(numDocs) * width, 0.0f);
+
+    for (int d = 0; d < numDocs; d++) {
+        float* row = rows.data() + static_cast<size_t>(d) * width;
+        for (const auto& entry : tfidfVectors[d]) {
+            row[column[entry.termId]] = static_cast<float>(entry.weight);
+        }
+    }
+
+    // Rows are wider than sparse vectors, so shrink the tile to keep
+    // two blocks of float rows in cache
+    size_t rowBytes = width * sizeof(float) + 1;
+    int tile = static_cast<int>(std::clamp<size_t>((256 * 1024) / (2 * rowBytes), 16, 1024));
+
+    auto kernel = [&](int rowBegin, int rowEnd, int colBlock, int, double* scores) {
+        int colBegin = colBlock * tile;
+        int colEnd   = std::min(colBegin + tile, numDocs);
+
+        for (int i = rowBegin; i < rowEnd; i++) {
+            const float* rowI = rows.data() + static_cast<size_t>(i) * width;
+            double* out = scores + static_cast<size_t>(i - rowBegin) * numDocs;
+
+            for (int j = std::max(colBegin, i + 1); j < colEnd; j++) {
+                const float* rowJ = rows.data() + static_cast<size_t>(j) * width;
+
+                // call denseDot() / clampScore()
+                out[j] = clampScore(static_cast<double>(denseDot(rowI, rowJ, width)));
+            }
+        }
+    };
+
+    // call streamTiles()
+    streamTiles(pool, tile, kernel, sink);
+}
+
+/*
+-------------------------------------------------
+Function Name : shouldUseDense()
+
+Objective:
+    Choose between dense and sparse all-pairs backends.
+
+Input:
+    documentCount → Number of documents.
+    activeTerms   → Number of used terms.
+    density       → Fraction of nonzero cells.
+
+Output:
+    true to use compareAllDense().
+
+Side Effect:
+    None.
+
+Approach:
+    Require a small vocabulary, enough density for the dense work
+    to be useful, and a bounded dense matrix size.
+*/
+bool SimilarityChecker::shouldUseDense(size_t documentCount, size_t activeTerms,
+                                       double density) {
+    const size_t maxTerms = 8192;
+    const double minDensity = 0.10;
+    const size_t maxBytes = 512u * 1024 * 1024;
+
+    if (documentCount < 2 || activeTerms == 0 || activeTerms > maxTerms) {
+        return false;
+    }
+
+    size_t denseBytes = documentCount * ((activeTerms + 15) / 16 * 16) * sizeof(float);
+
+    return density >= minDensity && denseBytes <= maxBytes;
+}
+
+/*
+-------------------------------------------------
+Function Name : compareAboveThreshold()
+
+Objective:
+    Report only pairs whose similarity exceeds a threshold.
+
+Input:
+    threshold → Minimum similarity (exclusive).
+
+Output:
+    Vector of qualifying pairs sorted by (doc1, doc2).
+
+Side Effect:
+    None.
+
+Approach:
+    All-Pairs prefix filtering. For each document x in turn:
+    1. Accumulate partial dot products against the indexed suffixes
+       of earlier documents y.
+    2. For every y reached, add dot(x, unindexed prefix of y); if the
+       total can reach the threshold, rescore exactly.
+    3. Visit x's terms from most to least common, adding
+       |weight| * maxWeight[term] to a bound; terms stay in x's
+       unindexed prefix until the bound reaches the threshold, and
+       the rest are appended to the index.
+
+    // call dotProduct()
+    // call cosineSimilarity()
+*/
+std::vector<SimilarityPair>
+SimilarityChecker::compareAboveThreshold(double threshold) const {
+
+    std::vector<SimilarityPair> results;
+
+    int numDocs = static_cast<int>(tfidfVectors.size());
+    size_t space = termSpace();
+    scoredPairs = 0;
+
+    // Largest weight magnitude and document frequency of every term;
+    // magnitudes keep the bound valid for signed (hashed) weights
+    std::vector<double> maxWeight(space, 0.0);
+    std::vector<int> docFrequency(space, 0);
+
+    for (const auto& vec : tfidfVectors) {
+        for (const auto& entry : vec) {
+            maxWeight[entry.termId] = std::max(maxWeight[entry.termId], std::abs(entry.weight));
+            docFrequency[entry.termId]++;
+        }
+    }
+
+    // All postings lists share one arena, released in one shot on return
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::vector<std::pmr::vector<WeightedPosting>> index(space, &arena);
+    std::vector<SparseVector> unindexed(numDocs);
+    std::vector<double> accumulator(numDocs, 0.0);
+    // Last document whose scan reached each document
+    std::vector<int> touchedBy(numDocs, -1);
+    std::vector<int> touched;
+
+    // Small slack so rounding in the bound never drops a real match
+    const double slack = 1e-9;
+
+    for (int x = 0; x < numDocs; x++) {
+
+        if (norms[x] == 0.0) {
+            continue;
+        }
+
+        const SparseVector& vec = tfidfVectors[x];
+
+        // 1. Partial scores through the index
+        for (const auto& entry : vec) {
+            for (const auto& posting : index[entry.termId]) {
+                if (touchedBy[posting.docId] != x) {
+                    touchedBy[posting.docId] = x;
+                    touched.push_back(posting.docId);
+                }
+                accumulator[posting.docId] += entry.weight * posting.weight;
+            }
+        }
+
+        // 2. Finish candidates with their unindexed prefix
+        for (int y : touched) {
+            // call dotProduct()
+            double bound = accumulator[y] + dotProduct(vec, unindexed[y]);
+            accumulator[y] = 0.0;
+
+            if (bound + slack > threshold) {
+                scoredPairs++;
+
+                // call cosineSimilarity()
+                double similarity = cosineSimilarity(y, x);
+
+                if (similarity > threshold) {
+                    results.push_back({y, x, similarity});
+                }
+            }
+        }
+        touched.clear();
+
+        // 3. Index the suffix of x past the threshold bound
+        std::vector<size_t> order(vec.size());
+        for (size_t k = 0; k < order.size(); k++) {
+            order[k] = k;
+        }
+
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            int dfA = docFrequency[vec[a].termId];
+            int dfB = docFrequency[vec[b].termId];
+            return (dfA != dfB) ? dfA > dfB : vec[a].termId < vec[b].termId;
+        });
+
+        double prefixBound = 0.0;
+
+        for (size_t k : order) {
+            const SparseEntry& entry = vec[k];
+            prefixBound += std::abs(entry.weight) * maxWeight[entry.termId];
+
+            if (prefixBound + slack > threshold) {
+                index[entry.termId].push_back({x, entry.weight});
+            } else {
+                unindexed[x].push_back(entry);
+            }
+        }
+
+        std::sort(unindexed[x].begin(), unindexed[x].end(),
+                  [](const SparseEntry& a, const SparseEntry& b) {
+                      return a.termId < b.termId;
+                  });
+    }
+
+    std::sort(results.begin(), results.end(),
+              [](const SimilarityPair& a, const SimilarityPair& b) {
+                  return (a.doc1 != b.doc1) ? a.doc1 < b.doc1 : a.doc2 < b.doc2;
+              });
+
+    return results;
+}
+
+/*
+-------------------------------------------------
+Function Name : findTopK()
+
+Objective:
+    Keep the K best matches of each document.
+
+Input:
+    k        → Matches per document.
+    minScore → Exclusive lower bound on reported scores.
+
+Output:
+    Vector of pairs sorted by (doc1, doc2).
+
+Side Effect:
+    None.
+
+Approach:
+    Build an inverted index of all unit vectors. For each document,
+    accumulate dot products with every document sharing a term,
+    select the K highest scores above minScore, and collect the
+    selected pairs without duplicates.
+
+    // call cosineSimilarity()
+*/
+std::vector<SimilarityPair>
+SimilarityChecker::findTopK(int k, double minScore) const {
+
+    std::vector<SimilarityPair> results;
+
+    int numDocs = static_cast<int>(tfidfVectors.size());
+    scoredPairs = 0;
+
+    if (k <= 0 || numDocs < 2) {
+        return results;
+    }
+
+    // All postings lists share one arena, released in one shot on return
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::vector<std::pmr::vector<WeightedPosting>> index(termSpace(), &arena);
+
+    for (int d = 0; d < numDocs; d++) {
+        for (const auto& entry : tfidfVectors[d]) {
+            index[entry.termId].push_back({d, entry.weight});
+        }
+    }
+
+    std::vector<double> accumulator(numDocs, 0.0);
+    // Last document whose scan reached each document
+    std::vector<int> touchedBy(numDocs, -1);
+    std::vector<int> touched;
+    std::vector<std::pair<int, int>> selected;
+
+    for (int x = 0; x < numDocs; x++) {
+
+        // Exact dot products with every document sharing a term
+        for (const auto& entry : tfidfVectors[x]) {
+            for (const auto& posting : index[entry.termId]) {
+                if (posting.docId == x) {
+                    continue;
+                }
+                if (touchedBy[posting.docId] != x) {
+                    touchedBy[posting.docId] = x;
+                    touched.push_back(posting.docId);
+                }
+                accumulator[posting.docId] += entry.weight * posting.weight;
+            }
+        }
+
+        std::vector<std::pair<double, int>> candidates;
+        candidates.reserve(touched.size());
+
+        // Every pair sharing a term is accumulated from both sides
+        scoredPairs += touched.size();
+
+        for (int y : touched) {
+            if (accumulator[y] > minScore) {
+                candidates.push_back({accumulator[y], y});
+            }
+            accumulator[y] = 0.0;
+        }
+        touched.clear();
+
+        // Highest score first, lower index on ties
+        size_t keep = std::min(candidates.size(), static_cast<size_t>(k));
+        std::partial_sort(candidates.begin(), candidates.begin() + keep, candidates.end(),
+                          [](const std::pair<double, int>& a, const std::pair<double, int>& b) {
+                              return (a.first != b.first) ? a.first > b.first
+                                                          : a.second < b.second;
+                          });
+
+        for (size_t c = 0; c < keep; c++) {
+            int y = candidates[c].second;
+            selected.push_back({std::min(x, y), std::max(x, y)});
+        }
+    }
+
+    scoredPairs /= 2;
+
+    std::sort(selected.begin(), selected.end());
+    selected.erase(std::unique(selected.begin(), selected.end()), selected.end());
+
+    results.reserve(selected.size());
+
+    for (const auto& pair : selected) {
+        // call cosineSimilarity()
+        double similarity = cosineSimilarity(pair.first, pair.second);
+
+        if (similarity > minScore) {
+            results.push_back({pair.first, pair.second, similarity});
+        }
+    }
+
+    return results;
+}
+
+/*
+-------------------------------------------------
+Function Name : compareCandidates()
+
+Objective:
+    Score candidate pairs with exact cosine similarity.
+
+Input:
+    candidates → Document index pairs.
+    minScore   → Exclusive lower bound on kept scores.
+
+Output:
+    Vector of scored pairs.
+
+Side Effect:
+    None.
+
+Approach:
+    Order each pair's indices and call cosineSimilarity() for it.
+    With a nonnegative minScore only pairs above it are kept, so
+    each pair goes through boundedSimilarity() instead and only
+    the ones it cannot rule out are scored (and counted).
+
+    // call magnitudeOrder()
+    // call boundedSimilarity()
+    // call cosineSimilarity()
+*/
+std::vector<SimilarityPair> SimilarityChecker::compareCandidates(
+        const std::vector<std::pair<int, int>>& candidates,
+        double minScore) const {
+
+    std::vector<SimilarityPair> results;
+    results.reserve(candidates.size());
+    scoredPairs = 0;
+
+    bool bounded = minScore >= 0.0 && !candidates.empty();
+
+    // call magnitudeOrder()
+    MagnitudeOrder ordered;
+    if (bounded) {
+        ordered = magnitudeOrder();
+    }
+
+    for (const auto& candidate : candidates) {
+        int doc1 = std::min(candidate.first, candidate.second);
+        int doc2 = std::max(candidate.first, candidate.second);
+
+        if (doc1 == doc2) {
+            continue;
+        }
+
+        double similarity;
+
+        if (bounded) {
+            // call boundedSimilarity()
+            similarity = boundedSimilarity(doc1, doc2, ordered, nullptr, minScore);
+
+            if (similarity == -std::numeric_limits<double>::infinity()) {
+                continue;
+            }
+        } else {
+            // call cosineSimilarity()
+            similarity = cosineSimilarity(doc1, doc2);
+        }
 
-            std::string name2 = (j < static_cast<int>(documentNames.size()))
-                                ? documentNames[j]
-                                : "Document" + std::to_string(j);
+        scoredPairs++;
 
-            results.push_back(std::make_tuple(name1, name2, similarity));
+        if (similarity > minScore) {
+            results.push_back({doc1, doc2, similarity});
         }
     }
 
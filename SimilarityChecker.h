@@ -1,10 +1,19 @@
 #ifndef SIMILARITYCHECKER_H
 #define SIMILARITYCHECKER_H
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <string>
-#include <map>
 #include <tuple>
+#include <utility>
+#include <functional>
+
+#include "SparseVector.h"
+#include "SimilarityPair.h"
+#include "ResultSink.h"
+
+class ThreadPool;
 
 /*
     ========================================================================
@@ -18,13 +27,18 @@
         algorithms for vector-based document comparison.
 
     Input:
-        - A vector of TF-IDF vectors, where each document is represented as:
-                map<string term, double tfidfValue>
+        - A vector of TF-IDF vectors, where each document is represented as
+          a SparseVector: (termId, tfidfValue) entries sorted by term ID,
+          holding only the nonzero terms of that document.
         - A vector of document names (strings).
 
     Output:
         - Cosine similarity between any two documents.
         - A list of all pairwise similarity scores.
+        - Pruned lists holding only pairs above a threshold, or the
+          top K matches of each document.
+        - Streams of scored pairs pushed into a ResultSink while they
+          are computed.
 
     Side Effects:
         - None. This class does not modify input vectors or write to files.
@@ -36,7 +50,89 @@ private:
 
     /*
         Objective:
-            Store TF-IDF vectors for all documents.
+            One entry of a term's postings list in the candidate index.
+
+        Input:
+            - docId  : document containing the term.
+            - weight : normalized TF-IDF weight of the term in docId.
+
+        Output:
+            None (plain data holder).
+
+        Side Effects:
+            None.
+    */
+    struct WeightedPosting {
+        int docId;
+        double weight;
+    };
+
+    /*
+        Objective:
+            Walk order of every stored vector for boundedSimilarity(),
+            kept as entry positions so the vectors are not copied.
+
+        Input:
+            Filled by magnitudeOrder().
+
+        Output:
+            None (plain data holder): document d's entries in order
+            of decreasing magnitude are tfidfVectors[d][positions[k]]
+            for k in [offsets[d], offsets[d + 1]).
+
+        Side Effects:
+            None.
+    */
+    struct MagnitudeOrder {
+        std::vector<size_t> offsets;
+        std::vector<uint32_t> positions;
+    };
+
+    /*
+        Objective:
+            One document's weights by term ID for the bounded walks of
+            compareAllAbove(), without a dense row of weights over the
+            term space.
+
+        Input:
+            - Constructor: the term space (see termSpace()).
+            - assign()   : the document's vector; it must outlive the
+                           lookups and the next assign().
+            - weightOf() : a term ID below the term space.
+
+        Output:
+            The document's weight of the term, 0.0 if absent.
+
+        Side Effects:
+            assign() replaces the previous document.
+
+        Approach:
+            A marker array over the term space holds 1 + the entry
+            index of each of the document's terms and 0 elsewhere;
+            weights[0] is 0.0, so a lookup is two reads without a
+            branch. assign() clears only the previous document's
+            markers, and the marker array takes 4 bytes per term
+            instead of a dense row's 8.
+    */
+    class RowWeights {
+    private:
+        std::vector<uint32_t> markers;
+        std::vector<double> weights{0.0};
+        const SparseVector* document = nullptr;
+
+    public:
+        explicit RowWeights(size_t termSpace) : markers(termSpace, 0) {}
+
+        void assign(const SparseVector& vec);
+
+        double weightOf(uint32_t term) const {
+            return weights[markers[term]];
+        }
+    };
+
+    /*
+        Objective:
+            Store TF-IDF vectors for all documents, scaled to unit length.
 
         Input:
             Passed once during construction.
@@ -45,9 +141,26 @@ private:
             None.
 
         Side Effects:
+            Normalized in the constructor so cosine similarity reduces
+            to a plain dot product.
+    */
+    std::vector<SparseVector> tfidfVectors;
+
+    /*
+        Objective:
+            Store the original magnitude (Euclidean norm) of each vector.
+
+        Input:
+            Computed once during construction.
+
+        Output:
             None.
+
+        Side Effects:
+            A zero norm marks an empty document, which scores 0.0
+            against every other document.
     */
-    std::vector<std::map<std::string, double>> tfidfVectors;
+    std::vector<double> norms;
 
     /*
         Objective:
@@ -64,12 +177,28 @@ private:
     */
     std::vector<std::string> documentNames;
 
+    /*
+        Objective:
+            Count the document pairs scored by the most recent search.
+
+        Input:
+            Set by every compare*() / findTopK() call.
+
+        Output:
+            None.
+
+        Side Effects:
+            Mutable so const searches can record it; only meaningful
+            when searches on one checker do not run concurrently.
+    */
+    mutable size_t scoredPairs = 0;
+
     /*
         Objective:
             Compute the dot product of two sparse TF-IDF vectors.
 
         Input:
-            vec1, vec2 → maps of term : TF-IDF value.
+            vec1, vec2 → sparse vectors sorted by term ID.
 
         Output:
             Double value representing dot product.
@@ -78,18 +207,70 @@ private:
             None.
 
         Approach:
-            - Iterate through the smaller map to reduce time.
+            - Walk both vectors in a single linear merge.
             - Multiply values only for matching terms.
+            - Cost is O(|vec1| + |vec2|), independent of vocabulary size.
     */
-    double dotProduct(const std::map<std::string, double>& vec1,
-                      const std::map<std::string, double>& vec2) const;
+    double dotProduct(const SparseVector& vec1,
+                      const SparseVector& vec2) const;
+
+    /*
+        Objective:
+            Order every stored vector's entries by decreasing
+            magnitude, for boundedSimilarity().
+
+        Input:
+            None.
+
+        Output:
+            Entry positions per document (4 bytes per entry instead of
+            a 16-byte copy); ties keep term ID order.
+
+        Side Effects:
+            None.
+    */
+    MagnitudeOrder magnitudeOrder() const;
+
+    /*
+        Objective:
+            Score one pair in a threshold-only search, abandoning it as
+            soon as it provably cannot exceed the threshold.
+
+        Input:
+            doc1Index, doc2Index → distinct document indices.
+            ordered              → magnitudeOrder() of the corpus.
+            rowWeights           → doc1's weights by term ID, or
+                                   nullptr.
+            threshold            → score the pair has to exceed.
+
+        Output:
+            cosineSimilarity() of the pair, or negative infinity if the
+            pair was abandoned (its score is <= threshold).
+
+        Side Effects:
+            None.
+
+        Approach:
+            - Walk one vector from its heaviest weight down, fetching
+              the other vector's weight of each term: from
+              'rowWeights' if given, else by binary search.
+            - The terms still to come are disjoint from those already
+              seen, so by Cauchy-Schwarz they add at most
+              |rest of the walked vector| x |unmatched rest of the
+              other|; both residual norms shrink as weights are taken.
+            - Abandon once the partial sum plus that bound falls below
+              the threshold (less a small slack for rounding); score
+              survivors exactly, so kept scores match compareAll().
+    */
+    double boundedSimilarity(int doc1Index, int doc2Index, const MagnitudeOrder& ordered,
+                             const RowWeights* rowWeights, double threshold) const;
 
     /*
         Objective:
             Calculate magnitude (Euclidean norm) of a TF-IDF vector.
 
         Input:
-            vec → map<string, double>
+            vec → SparseVector
 
         Output:
             sqrt(sum of squares of values)
@@ -97,7 +278,90 @@ private:
         Side Effects:
             None.
     */
-    double magnitude(const std::map<std::string, double>& vec) const;
+    double magnitude(const SparseVector& vec) const;
+
+    /*
+        Objective:
+            Choose the edge length (in documents) of a comparison tile.
+
+        Input:
+            None (uses average vector size).
+
+        Output:
+            Number of documents per tile row/column block.
+
+        Side Effects:
+            None.
+
+        Approach:
+            Size tiles so the vectors of one row block and one column
+            block fit together in a typical 256 KB L2 cache.
+    */
+    int tileSize() const;
+
+    /*
+        Objective:
+            Return the size of the term ID space used by the vectors.
+
+        Input:
+            None.
+
+        Output:
+            One past the largest term ID of any stored vector.
+
+        Side Effects:
+            None.
+    */
+    size_t termSpace() const;
+
+    /*
+        Objective:
+            Score the pairs of some rows against one column block.
+
+        Input:
+            rowBegin, rowEnd → rows to score.
+            colBlock         → column block (documents colBlock * tile
+                               to the next block start).
+            worker           → ThreadPool worker running the call.
+            scores           → band buffer; the score of (i, j) for
+                               j > i goes to scores[(i - rowBegin) * N + j].
+
+        Output:
+            None (writes to scores).
+
+        Side Effects:
+            None beyond the buffer and per-worker scratch.
+    */
+    using TileKernel = std::function<void(int rowBegin, int rowEnd, int colBlock,
+                                          int worker, double* scores)>;
+
+    /*
+        Objective:
+            Run an all-pairs kernel and stream its scores in order.
+
+        Input:
+            pool   → workers to run the kernel on.
+            tile   → column block width used by the kernel.
+            kernel → TileKernel computing the scores.
+            sink   → receives every pair (i, j), i < j, in i-major order.
+
+        Output:
+            None.
+
+        Side Effects:
+            Calls the sink; holds two bands of scores at a time.
+
+        Approach:
+            - Cut the rows into bands small enough that a band's scores
+              (band rows x N doubles) stay within a fixed budget.
+            - Score each band as one ThreadPool batch of column-block
+              tasks, writing into one of two band buffers.
+            - Emission of the previous band into the sink runs as an
+              extra task of the same batch, so writing the report
+              overlaps with computing the next band.
+    */
+    void streamTiles(ThreadPool& pool, int tile, const TileKernel& kernel,
+                     ResultSink& sink) const;
 
 public:
 
@@ -107,7 +371,7 @@ public:
             and corresponding document names.
 
         Input:
-            vectors → List of TF-IDF maps.
+            vectors → List of sparse TF-IDF vectors.
             names → Document names.
 
         Output:
@@ -115,9 +379,79 @@ public:
 
         Side Effects:
             Stores internal state.
+            Computes every vector norm once and L2-normalizes the
+            stored vectors.
+
+        Notes:
+            Both arguments are taken by value: pass them with std::move
+            to hand over ownership without copying (the vectors are
+            normalized in place). Lvalue arguments are copied.
+    */
+    SimilarityChecker(std::vector<SparseVector> vectors,
+                      std::vector<std::string> names);
+
+    /*
+        Objective:
+            Give read access to the stored document names.
+
+        Input:
+            None.
+
+        Output:
+            Reference to the names passed at construction.
+
+        Side Effects:
+            None.
+    */
+    const std::vector<std::string>& getDocumentNames() const;
+
+    /*
+        Objective:
+            Access a stored vector.
+
+        Input:
+            index → document index.
+
+        Output:
+            The document's TF-IDF vector, scaled to unit length (empty
+            documents stay all-zero).
+
+        Side Effects:
+            None.
+    */
+    const SparseVector& getVector(int index) const;
+
+    /*
+        Objective:
+            Return the number of stored documents.
+
+        Input:
+            None.
+
+        Output:
+            Document count.
+
+        Side Effects:
+            None.
     */
-    SimilarityChecker(const std::vector<std::map<std::string, double>>& vectors,
-                      const std::vector<std::string>& names);
+    int documentCount() const;
+
+    /*
+        Objective:
+            Report how much work the most recent search did.
+
+        Input:
+            None.
+
+        Output:
+            Number of document pairs whose similarity was computed
+            (all pairs for the all-pairs engines, fewer for pruned and
+            candidate searches). Pairs never scored were pruned.
+
+        Side Effects:
+            None.
+    */
+    size_t lastScoredPairs() const;
 
     /*
         Objective:
@@ -154,6 +488,496 @@ public:
             None.
     */
     std::vector<std::tuple<std::string, std::string, double>> compareAll() const;
+
+    /*
+        Objective:
+            Compare all unique document pairs, streaming each score.
+
+        Input:
+            sink → receives every pair in compareAll() order.
+
+        Output:
+            None.
+
+        Side Effects:
+            Calls the sink once per pair; no results are kept.
+    */
+    void compareAll(ResultSink& sink) const;
+
+    /*
+        Objective:
+            Compare all unique document pairs using several threads.
+
+        Input:
+            threadCount → number of worker threads (< 1 = all cores).
+
+        Output:
+            Same vector of tuples as compareAll(), in the same order.
+
+        Side Effects:
+            Spawns worker threads for the duration of the call.
+
+        Approach:
+            - Split the upper-triangular pair space into square tiles of
+              tileSize() x tileSize() documents.
+            - Distribute tiles over a work-stealing ThreadPool.
+            - Scores are collected band by band in the serial i-major
+              order (see streamTiles()), so output is deterministic.
+    */
+    std::vector<std::tuple<std::string, std::string, double>>
+    compareAllParallel(int threadCount) const;
+
+    /*
+        Objective:
+            Streaming form of compareAllParallel().
+
+        Input:
+            threadCount → number of worker threads (< 1 = all cores).
+            sink        → receives every pair in compareAll() order.
+
+        Output:
+            None.
+
+        Side Effects:
+            Spawns worker threads; holds two bands of scores
+            (see streamTiles()) instead of all results.
+    */
+    void compareAllParallel(int threadCount, ResultSink& sink) const;
+
+    /*
+        Objective:
+            Stream only the pairs scoring above a threshold, abandoning
+            each other pair as soon as it provably cannot reach it.
+
+        Input:
+            threshold   → only pairs with score > threshold are sent.
+            threadCount → number of worker threads (< 1 = all cores).
+            sink        → receives the qualifying pairs in compareAll()
+                          order.
+
+        Output:
+            None.
+
+        Side Effects:
+            Spawns worker threads when threadCount != 1.
+
+        Approach:
+            - Every pair goes through boundedSimilarity(), with the row
+              document loaded into its worker's RowWeights table;
+              the pairs it cannot rule out are scored with
+              cosineSimilarity(), so reported scores are identical to
+              compareAll().
+            - Tiles and band order as compareAllParallel().
+            - lastScoredPairs() counts the pairs scored to completion.
+    */
+    void compareAllAbove(double threshold, int threadCount, ResultSink& sink) const;
+
+    /*
+        Objective:
+            Compare all unique document pairs with a batch sparse
+            matrix product instead of pair-by-pair dot products.
+
+        Input:
+            threadCount → number of worker threads (< 1 = all cores,
+                          1 = calling thread only).
+
+        Output:
+            Same vector of tuples as compareAll(), in the same order,
+            with bit-identical scores.
+
+        Side Effects:
+            Spawns worker threads for the duration of the call.
+            Holds one transposed column block per tile column
+            (about 8 bytes per term plus 12 per nonzero each).
+
+        Approach:
+            Blocked SpGEMM computing the upper triangle of X * X^T:
+            - Pack the unit vectors into a CSR matrix X.
+            - Transpose each block of tileSize() rows into a column
+              block (term -> documents of the block).
+            - For a (row block, column block) tile, stream every row
+              x of the row block through the column block, adding
+              x[t] * y[t] into a dense scratch row indexed by y; the
+              scratch finishes all dot products of x in the block.
+            - Terms of x are visited in increasing ID order, the same
+              summation order as dotProduct().
+    */
+    std::vector<std::tuple<std::string, std::string, double>>
+    compareAllBlocked(int threadCount) const;
+
+    /*
+        Objective:
+            Streaming form of compareAllBlocked().
+
+        Input:
+            threadCount → number of worker threads.
+            sink        → receives every pair in compareAll() order.
+
+        Output:
+            None.
+
+        Side Effects:
+            Spawns worker threads; holds the column blocks and two
+            bands of scores instead of all results.
+    */
+    void compareAllBlocked(int threadCount, ResultSink& sink) const;
+
+    /*
+        Objective:
+            Receive one band of cross-block scores.
+
+        Input:
+            rowBegin, rowEnd → rows (of the calling checker) in the band.
+            scores           → the score of (i, j) is
+                               scores[(i - rowBegin) * W + (j - colBegin)],
+                               where [colBegin, colBegin + W) is the
+                               column range of the call.
+
+        Output:
+            None.
+
+        Side Effects:
+            Defined by the consumer; the buffer is reused afterwards.
+    */
+    using BlockConsumer = std::function<void(int rowBegin, int rowEnd,
+                                             const double* scores)>;
+
+    /*
+        Objective:
+            Score a range of this checker's documents against a range of
+            another checker's documents, e.g. two shards of a corpus too
+            large to hold in memory at once, or one tile of the pair
+            matrix.
+
+        Input:
+            rowBegin, rowEnd → rows of this checker.
+            columns          → checker holding the column documents (may
+                               be *this).
+            colBegin, colEnd → columns of 'columns'.
+            threadCount      → number of worker threads.
+            consumer         → receives the scores band by band, rows in
+                               increasing order.
+
+        Output:
+            None.
+
+        Side Effects:
+            Spawns worker threads for the duration of the call.
+            Holds a CSR copy of both ranges, one transposed copy of the
+            columns, a band of about one million scores and one
+            scratch row of W accumulators per worker.
+
+        Approach:
+            Same scatter as compareAllBlocked(), with the whole column
+            range as a single column block, so the scores are
+            bit-identical to those of the in-memory engines for the same
+            vectors.
+    */
+    void compareBlock(int rowBegin, int rowEnd,
+                      const SimilarityChecker& columns, int colBegin, int colEnd,
+                      int threadCount, const BlockConsumer& consumer) const;
+
+    /*
+        Objective:
+            Score one tile of the pair matrix and keep its best pairs.
+
+        Input:
+            rowBegin, rowEnd → row documents of the tile.
+            colBegin, colEnd → column documents of the tile.
+            minScore         → pairs must score above it.
+            threadCount      → number of worker threads.
+
+        Output:
+            Pairs (i, j) of the tile with i < j and score > minScore,
+            in i-major order.
+
+        Side Effects:
+            Spawns worker threads for the duration of the call.
+
+        Approach:
+            compareBlock() of the two ranges of this checker; tiles
+            that straddle the diagonal keep only its upper side.
+
+            // call compareBlock()
+    */
+    std::vector<SimilarityPair> compareTile(int rowBegin, int rowEnd,
+                                            int colBegin, int colEnd,
+                                            double minScore, int threadCount) const;
+
+    /*
+        Objective:
+            Score selected documents against every document, e.g. the
+            documents that changed since a cached run.
+
+        Input:
+            rows        → documents to score, in any order.
+            threadCount → number of worker threads.
+            consumer    → receives the scores band by band; band rows
+                          are positions in 'rows', and the score of
+                          (rows[k], j) is scores[(k - bandBegin) * N + j]
+                          with N = documentCount().
+
+        Output:
+            None.
+
+        Side Effects:
+            Spawns worker threads for the duration of the call.
+            Holds a CSR copy of the selected rows and a transposed
+            copy of the corpus.
+
+        Approach:
+            Same band loop and scatter as compareBlock(), so every score
+            is bit-identical to the all-pairs engines.
+    */
+    void compareRows(const std::vector<int>& rows, int threadCount,
+                     const BlockConsumer& consumer) const;
+
+    /*
+        Objective:
+            Compare all pairs of a corpus whose exact duplicates were
+            collapsed into one stored vector each.
+
+        Input:
+            representative → for every document of the corpus, the
+                             stored vector it shares; duplicates map to
+                             the same vector.
+            threadCount    → number of worker threads.
+            sink           → receives every corpus pair (i < j): first
+                             the pairs within each group, then the pairs
+                             of each two groups, in the i-major order of
+                             the stored vectors rather than of the corpus.
+
+        Output:
+            None.
+
+        Side Effects:
+            Spawns worker threads for the duration of the call.
+            Document names, if given, label corpus documents rather
+            than stored vectors.
+
+        Approach:
+            A pair of duplicates is reported at exactly 1.0.
+            compareAllBlocked() scores the D stored vectors' D(D-1)/2
+            pairs once, and each score is expanded to every pair of
+            members of the two groups; it is bit-identical to scoring
+            the full corpus. lastScoredPairs() is D(D-1)/2.
+
+            // call compareAllBlocked()
+    */
+    void compareAllExpanded(const std::vector<int>& representative, int threadCount,
+                            ResultSink& sink) const;
+
+    /*
+        Objective:
+            Compare all unique document pairs on dense float32 vectors
+            with a SIMD dot-product kernel (see DenseKernels.h).
+
+        Input:
+            threadCount → number of worker threads (< 1 = all cores,
+                          1 = calling thread only).
+
+        Output:
+            Same pairs and order as compareAll(). Scores agree with the
+            sparse path within denseTolerance.
+
+        Side Effects:
+            Spawns worker threads for the duration of the call.
+            Allocates documents x active terms x 4 bytes.
+
+        Approach:
+            - Map every term used by some vector to a dense column and
+              pad rows to a multiple of 16 floats.
+            - Run upper-triangular tiles on the ThreadPool, scoring each
+              pair with denseDot() on the unit-length float rows.
+
+        Notes:
+            float32 rounding of the weights and of the sum bounds the
+            absolute error by about length x 2^-24 for unit vectors;
+            denseTolerance is a generous bound for a few thousand
+            terms, far below the 0.01% resolution of the report.
+    */
+    std::vector<std::tuple<std::string, std::string, double>>
+    compareAllDense(int threadCount) const;
+
+    /*
+        Objective:
+            Streaming form of compareAllDense().
+
+        Input:
+            threadCount → number of worker threads.
+            sink        → receives every pair in compareAll() order.
+
+        Output:
+            None.
+
+        Side Effects:
+            Spawns worker threads; holds the dense rows and two bands
+            of scores instead of all results.
+    */
+    void compareAllDense(int threadCount, ResultSink& sink) const;
+
+    // Maximum absolute score difference between the dense and sparse paths
+    static constexpr double denseTolerance = 1e-5;
+
+    /*
+        Objective:
+            Decide whether the dense backend beats the sparse ones.
+
+        Input:
+            documentCount → number of documents.
+            activeTerms   → distinct terms with a nonzero weight.
+            density       → fraction of nonzero (document, term) cells.
+
+        Output:
+            true if compareAllDense() is expected to be faster.
+
+        Side Effects:
+            None.
+
+        Approach:
+            Dense work per pair is proportional to activeTerms, sparse
+            work to the overlap of the two documents. Choose dense for
+            small vocabularies (<= 8192 terms) that are dense enough
+            (>= 10% of cells nonzero), as long as the dense matrix stays
+            under 512 MB.
+    */
+    static bool shouldUseDense(size_t documentCount, size_t activeTerms, double density);
+
+    /*
+        Objective:
+            Find every pair whose similarity is above a threshold,
+            skipping pairs that provably cannot reach it.
+
+        Input:
+            threshold → minimum similarity (exclusive), 0.0 to 1.0.
+
+        Output:
+            Pairs with score > threshold, sorted by (doc1, doc2).
+            Scores are identical to cosineSimilarity().
+
+        Side Effects:
+            None.
+
+        Approach:
+            All-Pairs prefix filtering over the unit vectors:
+            - Documents are processed in order against an inverted
+              index of the documents before them.
+            - Terms of each document are visited from most to least
+              common; while the bound sum(weight * maxWeight[term])
+              stays below the threshold, terms are kept in an
+              unindexed prefix instead of the index.
+            - A pair never reached through the index overlaps only on
+              prefix terms, so its score is below the threshold.
+            - Reached candidates are finished with the prefix dot
+              product and rescored exactly.
+    */
+    std::vector<SimilarityPair> compareAboveThreshold(double threshold) const;
+
+    /*
+        Objective:
+            Find the K most similar documents of every document.
+
+        Input:
+            k        → matches kept per document.
+            minScore → only pairs with score > minScore qualify
+                       (use the report threshold to combine both filters).
+
+        Output:
+            Union of every document's top-K pairs, each pair once,
+            sorted by (doc1, doc2).
+
+        Side Effects:
+            None.
+
+        Approach:
+            Accumulate dot products through an inverted index so only
+            documents sharing a term are scored, then keep the K best
+            (ties broken by lower index).
+    */
+    std::vector<SimilarityPair> findTopK(int k, double minScore) const;
+
+    /*
+        Objective:
+            Score only the pairs proposed by a CandidateGenerator stage.
+
+        Input:
+            candidates → (doc1, doc2) pairs, e.g. from MinHashLSH.
+            minScore   → only pairs with score > minScore are kept
+                         (negative keeps every candidate).
+
+        Output:
+            Scored pairs in candidate order, with doc1 < doc2.
+
+        Side Effects:
+            None.
+
+        Notes:
+            With minScore >= 0 the pairs go through boundedSimilarity(),
+            so candidates that cannot exceed it are abandoned early;
+            lastScoredPairs() counts only those scored to completion.
+    */
+    std::vector<SimilarityPair>
+    compareCandidates(const std::vector<std::pair<int, int>>& candidates,
+                      double minScore) const;
+
+    /*
+        Objective:
+            Score newly added documents against the rest of the corpus.
+
+        Input:
+            firstQuery → index of the first query document; documents
+                         [firstQuery, N) are queries, the rest is the
+                         existing corpus.
+            minScore   → only pairs with score > minScore are kept
+                         (negative keeps every pair, including zeros).
+
+        Output:
+            Every pair with at least one query document, each once,
+            with doc1 < doc2, grouped by query in increasing order.
+
+        Side Effects:
+            None.
+
+        Approach:
+            Index all unit vectors once, then for each query accumulate
+            dot products with the documents before it that share a
+            term. Corpus pairs are never visited, so the cost is
+            O(M x N) for M queries instead of O((N + M)^2).
+    */
+    std::vector<SimilarityPair> compareQueries(int firstQuery, double minScore) const;
+
+    /*
+        Objective:
+            Streaming form of compareQueries().
+
+        Input:
+            firstQuery → index of the first query document.
+            minScore   → only pairs with score > minScore are delivered
+                         (negative delivers every pair).
+            sink       → receives the pairs in compareQueries() order.
+
+        Output:
+            None.
+
+        Side Effects:
+            Calls the sink as each query is finished.
+    */
+    void compareQueries(int firstQuery, double minScore, ResultSink& sink) const;
+
+    /*
+        Objective:
+            Return the report label of a document.
+
+        Input:
+            index → document index.
+
+        Output:
+            Stored document name, or "Document<index>" if none was given.
+
+        Side Effects:
+            None.
+    */
+    std::string getDocumentName(int index) const;
 };
 
 #endif // SIMILARITYCHECKER_H
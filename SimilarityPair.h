@@ -0,0 +1,33 @@
+#ifndef SIMILARITYPAIR_H
+#define SIMILARITYPAIR_H
+
+/*
+    ========================================================================
+                          STRUCT : SimilarityPair
+    ========================================================================
+
+    Objective:
+        Represent one scored document pair by index, without copying the
+        document names.
+
+    Input:
+        - doc1  : index of the first document (doc1 < doc2).
+        - doc2  : index of the second document.
+        - score : cosine similarity between 0.0 and 1.0.
+
+    Output:
+        None (plain data holder).
+
+    Side Effects:
+        None.
+
+    Notes:
+        Names are resolved only when the pair is written to a report.
+*/
+struct SimilarityPair {
+    int doc1;
+    int doc2;
+    double score;
+};
+
+#endif // SIMILARITYPAIR_H
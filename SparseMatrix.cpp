@@ -0,0 +1,265 @@
+#include "SparseMatrix.h"
+
+/*
+-------------------------------------------------
+Function Name : SparseMatrix (Constructor)
+
+Objective:
+    Build a CSR matrix from sparse row vectors.
+
+Input:
+    rows        → Sparse vectors, one per row.
+    columnCount → Number of columns.
+
+Output:
+    SparseMatrix object initialized.
+
+Side Effect:
+    Allocates the flat entry arrays.
+
+Approach:
+    Pack the full range of rows.
+
+    // call SparseMatrix() (range overload)
+*/
+SparseMatrix::SparseMatrix(const std::vector<SparseVector>& rows, size_t columnCount)
+    : SparseMatrix(rows, 0, rows.size(), columnCount) {
+}
+
+/*
+-------------------------------------------------
+Function Name : SparseMatrix (Constructor, range overload)
+
+Objective:
+    Build a CSR matrix from a slice of sparse row vectors.
+
+Input:
+    rows        → Sparse vectors.
+    rowBegin    → First vector to pack.
+    rowEnd      → One past the last vector to pack.
+    columnCount → Number of columns.
+
+Output:
+    SparseMatrix object initialized.
+
+Side Effect:
+    Allocates the flat entry arrays.
+
+Approach:
+    Reserve the total entry count, then append every row's entries
+    and record where each row ends.
+*/
+SparseMatrix::SparseMatrix(const std::vector<SparseVector>& rows, size_t rowBegin,
+                           size_t rowEnd, size_t columnCount)
+    : columnTotal(columnCount) {
+
+    size_t totalEntries = 0;
+    for (size_t r = rowBegin; r < rowEnd; r++) {
+        totalEntries += rows[r].size();
+    }
+
+    rowOffsets.reserve(rowEnd - rowBegin + 1);
+    columns.reserve(totalEntries);
+    values.reserve(totalEntries);
+
+    for (size_t r = rowBegin; r < rowEnd; r++) {
+        for (const auto& entry : rows[r]) {
+            columns.push_back(entry.termId);
+            values.push_back(entry.weight);
+        }
+        rowOffsets.push_back(columns.size());
+    }
+}
+
+/*
+-------------------------------------------------
+Function Name : transposedRows()
+
+Objective:
+    Transpose a slice of rows.
+
+Input:
+    rowBegin → First row.
+    rowEnd   → One past the last row.
+
+Output:
+    Column-major view of the slice as a SparseMatrix.
+
+Side Effect:
+    None.
+
+Approach:
+    Counting sort by column: count, prefix-sum, scatter. Rows are
+    visited in order, so every transposed row is sorted.
+*/
+SparseMatrix SparseMatrix::transposedRows(size_t rowBegin, size_t rowEnd) const {
+
+    SparseMatrix transposed;
+    transposed.columnTotal = (rowEnd > rowBegin) ? rowEnd - rowBegin : 0;
+
+    size_t entryBegin = rowOffsets[rowBegin];
+    size_t entryEnd = rowOffsets[rowEnd];
+
+    // Entries per column, shifted by one for the prefix sum
+    transposed.rowOffsets.assign(columnTotal + 1, 0);
+    for (size_t e = entryBegin; e < entryEnd; e++) {
+        transposed.rowOffsets[columns[e] + 1]++;
+    }
+
+    for (size_t c = 0; c < columnTotal; c++) {
+        transposed.rowOffsets[c + 1] += transposed.rowOffsets[c];
+    }
+
+    transposed.columns.resize(entryEnd - entryBegin);
+    transposed.values.resize(entryEnd - entryBegin);
+
+    std::vector<size_t> next(transposed.rowOffsets.begin(), transposed.rowOffsets.end() - 1);
+
+    for (size_t row = rowBegin; row < rowEnd; row++) {
+        for (size_t e = rowOffsets[row]; e < rowOffsets[row + 1]; e++) {
+            size_t slot = next[columns[e]]++;
+            transposed.columns[slot] = static_cast<uint32_t>(row - rowBegin);
+            transposed.values[slot] = values[e];
+        }
+    }
+
+    return transposed;
+}
+
+/*
+-------------------------------------------------
+Function Name : rowCount()
+
+Objective:
+    Retrieve number of rows.
+
+Input:
+    None.
+
+Output:
+    Row count.
+
+Side Effect:
+    None.
+
+Approach:
+    One offset per row plus the final end offset.
+*/
+size_t SparseMatrix::rowCount() const {
+    return rowOffsets.size() - 1;
+}
+
+/*
+-------------------------------------------------
+Function Name : columnCount()
+
+Objective:
+    Retrieve number of columns.
+
+Input:
+    None.
+
+Output:
+    Column count.
+
+Side Effect:
+    None.
+
+Approach:
+    Return stored value.
+*/
+size_t SparseMatrix::columnCount() const {
+    return columnTotal;
+}
+
+/*
+-------------------------------------------------
+Function Name : nonZeroCount()
+
+Objective:
+    Retrieve number of stored entries.
+
+Input:
+    None.
+
+Output:
+    Entry count.
+
+Side Effect:
+    None.
+
+Approach:
+    Return size of the value array.
+*/
+size_t SparseMatrix::nonZeroCount() const {
+    return values.size();
+}
+
+/*
+-------------------------------------------------
+Function Name : rowLength()
+
+Objective:
+    Retrieve number of entries in a row.
+
+Input:
+    row → Row index.
+
+Output:
+    Entry count of the row.
+
+Side Effect:
+    None.
+
+Approach:
+    Difference of consecutive row offsets.
+*/
+size_t SparseMatrix::rowLength(size_t row) const {
+    return rowOffsets[row + 1] - rowOffsets[row];
+}
+
+/*
+-------------------------------------------------
+Function Name : rowColumns()
+
+Objective:
+    Retrieve column indices of a row.
+
+Input:
+    row → Row index.
+
+Output:
+    Pointer to the row's first column index.
+
+Side Effect:
+    None.
+
+Approach:
+    Offset into the column array.
+*/
+const uint32_t* SparseMatrix::rowColumns(size_t row) const {
+    return columns.data() + rowOffsets[row];
+}
+
+/*
+-------------------------------------------------
+Function Name : rowValues()
+
+Objective:
+    Retrieve values of a row.
+
+Input:
+    row → Row index.
+
+Output:
+    Pointer to the row's first value.
+
+Side Effect:
+    None.
+
+Approach:
+    Offset into the value array.
+*/
+const double* SparseMatrix::rowValues(size_t row) const {
+    return values.data() + rowOffsets[row];
+}
@@ -0,0 +1,162 @@
+#ifndef SPARSEMATRIX_H
+#define SPARSEMATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "SparseVector.h"
+
+/*
+    ========================================================================
+                          CLASS : SparseMatrix
+    ========================================================================
+
+    Objective:
+        The SparseMatrix class stores a set of sparse vectors as one
+        matrix in Compressed Sparse Row (CSR) form:
+            - rowOffsets[r] .. rowOffsets[r + 1] delimit the entries of row r
+            - columns[] and values[] hold those entries in column order
+        Packing every document into three flat arrays lets batch kernels
+        stream through contiguous memory instead of chasing one heap block
+        per document.
+
+    Input:
+        - Sparse vectors (rows), each sorted by term ID, and the number of
+          columns (size of the term ID space).
+
+    Output:
+        - Row views (column indices and values).
+        - Transposed row slices, used as column blocks by the Gram kernel
+          in SimilarityChecker.
+
+    Side Effects:
+        - None.
+*/
+
+class SparseMatrix {
+private:
+
+    // Number of columns (one past the largest column index)
+    size_t columnTotal = 0;
+
+    // Start of every row in columns/values, plus one final end offset
+    std::vector<size_t> rowOffsets{0};
+
+    // Column index of every stored entry, row by row
+    std::vector<uint32_t> columns;
+
+    // Value of every stored entry, aligned with 'columns'
+    std::vector<double> values;
+
+public:
+
+    /*
+        Objective:
+            Create an empty matrix (no rows, no columns).
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    SparseMatrix() = default;
+
+    /*
+        Objective:
+            Pack sparse vectors into CSR form.
+
+        Input:
+            rows        → one SparseVector per row, sorted by term ID.
+            columnCount → number of columns; every term ID must be below it.
+
+        Output:
+            None.
+
+        Side Effects:
+            Copies all entries into the flat arrays.
+    */
+    SparseMatrix(const std::vector<SparseVector>& rows, size_t columnCount);
+
+    /*
+        Objective:
+            Pack a contiguous range of sparse vectors into CSR form.
+
+        Input:
+            rows        → sparse vectors, each sorted by term ID.
+            rowBegin    → first vector of the range (becomes row 0).
+            rowEnd      → one past the last vector of the range.
+            columnCount → number of columns; every term ID must be below it.
+
+        Output:
+            None.
+
+        Side Effects:
+            Copies the range's entries into the flat arrays.
+    */
+    SparseMatrix(const std::vector<SparseVector>& rows, size_t rowBegin, size_t rowEnd,
+                 size_t columnCount);
+
+    /*
+        Objective:
+            Transpose a contiguous range of rows.
+
+        Input:
+            rowBegin → first row of the range.
+            rowEnd   → one past the last row of the range.
+
+        Output:
+            Matrix with columnCount() rows; row c lists the rows of the
+            range that have an entry in column c, as local indices
+            (row - rowBegin) in increasing order.
+
+        Side Effects:
+            None.
+
+        Approach:
+            Count entries per column, prefix-sum the counts into row
+            offsets, then scatter the range's entries in row order.
+    */
+    SparseMatrix transposedRows(size_t rowBegin, size_t rowEnd) const;
+
+    /*
+        Objective:
+            Report the matrix shape.
+
+        Input:
+            None.
+
+        Output:
+            Number of rows / columns / stored entries.
+
+        Side Effects:
+            None.
+    */
+    size_t rowCount() const;
+    size_t columnCount() const;
+    size_t nonZeroCount() const;
+
+    /*
+        Objective:
+            Access one row.
+
+        Input:
+            row → row index below rowCount().
+
+        Output:
+            Entry count, and pointers to the row's column indices and
+            values (rowLength() entries each).
+
+        Side Effects:
+            None.
+    */
+    size_t rowLength(size_t row) const;
+    const uint32_t* rowColumns(size_t row) const;
+    const double* rowValues(size_t row) const;
+};
+
+#endif // SPARSEMATRIX_H
@@ -0,0 +1,44 @@
+#ifndef SPARSEVECTOR_H
+#define SPARSEVECTOR_H
+
+#include <cstdint>
+#include <vector>
+
+/*
+    ========================================================================
+                          STRUCT : SparseEntry
+    ========================================================================
+
+    Objective:
+        Represent one nonzero component of a TF-IDF document vector.
+
+    Input:
+        - termId : TermDictionary ID of the word this component belongs to.
+        - weight : TF-IDF value of the term in the document.
+
+    Output:
+        None (plain data holder).
+
+    Side Effects:
+        None.
+*/
+struct SparseEntry {
+    uint32_t termId;
+    double weight;
+};
+
+/*
+    Objective:
+        A document vector that stores only its nonzero terms.
+
+    Notes:
+        - Entries are kept sorted by termId in ascending order and each term
+          appears at most once.
+        - Terms missing from the vector have an implicit weight of 0.0, so
+          memory scales with document length instead of vocabulary size.
+        - The ordering lets SimilarityChecker compute dot products with a
+          single linear merge of two integer-keyed arrays.
+*/
+using SparseVector = std::vector<SparseEntry>;
+
+#endif // SPARSEVECTOR_H
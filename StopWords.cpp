@@ -0,0 +1,155 @@
+#include "StopWords.h"
+
+namespace {
+
+// Common English function words (the original TextCleaner list)
+constexpr std::string_view englishWords[] = {
+    "a", "an", "and", "are", "as", "at", "be", "by", "for", "from",
+    "has", "he", "in", "is", "it", "its", "of", "on", "that", "the",
+    "to", "was", "will", "with", "this", "but", "they", "have",
+    "had", "what", "said", "each", "which", "their", "time", "if",
+    "up", "out", "many", "then", "them", "these", "so", "some", "her",
+    "would", "make", "like", "into", "him", "two", "more",
+    "very", "after", "words", "long", "than", "first", "been", "call",
+    "who", "oil", "sit", "now", "find", "down", "day", "did", "get",
+    "come", "made", "may", "part"
+};
+
+// French function words; elided articles and pronouns (l', d', qu')
+// are split off at the apostrophe and appear as single tokens
+constexpr std::string_view frenchWords[] = {
+    "le", "la", "les", "l", "de", "des", "du", "d", "un", "une",
+    "et", "ou", "mais", "donc", "car", "ni", "en", "est", "sont", "que",
+    "qu", "qui", "dans", "pour", "par", "sur", "sous", "sans", "avec", "au",
+    "aux", "ce", "ces", "cet", "cette", "c", "il", "ils", "elle", "elles",
+    "on", "nous", "vous", "je", "j", "tu", "ne", "n", "pas", "se",
+    "s", "sa", "son", "ses", "leur", "leurs", "mon", "ma", "mes", "m",
+    "ton", "ta", "tes", "t", "nos", "vos", "notre", "votre", "lui", "y",
+    "a", "si", "plus", "comme", "tout", "tous", "aussi"
+};
+
+// German function words (words with umlauts or sharp s are left out)
+constexpr std::string_view germanWords[] = {
+    "der", "die", "das", "den", "dem", "des", "ein", "eine", "einer", "einem",
+    "einen", "und", "oder", "aber", "doch", "in", "im", "zu", "zum", "zur",
+    "von", "mit", "auf", "aus", "bei", "nach", "vor", "bis", "durch", "um",
+    "am", "an", "als", "auch", "nur", "noch", "schon", "sehr", "mehr", "nicht",
+    "ist", "sind", "war", "hat", "haben", "wird", "werden", "sein", "kann", "es",
+    "er", "sie", "ich", "wir", "ihr", "man", "sich", "so", "wie", "wenn",
+    "dass", "ob", "wo", "was", "wer", "hier", "alle", "diese", "dieser", "dieses",
+    "ja", "nein"
+};
+
+// Spanish function words (words with accents are left out)
+constexpr std::string_view spanishWords[] = {
+    "de", "la", "que", "el", "en", "y", "a", "los", "del", "se",
+    "las", "por", "un", "para", "con", "no", "una", "su", "al", "lo",
+    "como", "pero", "sus", "le", "ya", "o", "este", "si", "porque", "esta",
+    "entre", "cuando", "muy", "sin", "sobre", "me", "hasta", "hay", "donde", "quien",
+    "desde", "todo", "nos", "durante", "todos", "uno", "les", "ni", "contra", "otros",
+    "ese", "eso", "ante", "ellos", "e", "esto", "antes", "algunos", "unos", "yo",
+    "otro", "otras", "otra", "tanto", "esa", "estos", "mucho", "quienes", "nada", "muchos",
+    "cual", "poco", "ella", "estar", "estas", "algunas", "algo", "nosotros", "es", "son",
+    "fue", "ha", "han", "ser"
+};
+
+// Tables, built by the compiler
+constexpr auto englishTable = buildStopWordTable(englishWords);
+constexpr auto frenchTable = buildStopWordTable(frenchWords);
+constexpr auto germanTable = buildStopWordTable(germanWords);
+constexpr auto spanishTable = buildStopWordTable(spanishWords);
+
+// Every compiled language; the first one is the default
+constexpr StopWordSet languages[] = {
+    StopWordSet("english", englishTable),
+    StopWordSet("french", frenchTable),
+    StopWordSet("german", germanTable),
+    StopWordSet("spanish", spanishTable),
+    StopWordSet()
+};
+
+} // namespace
+
+/*
+-------------------------------------------------
+Function Name : forLanguage()
+
+Objective:
+    Look up a compiled stopword list.
+
+Input:
+    language → Language name.
+
+Output:
+    Pointer to the set, or nullptr.
+
+Side Effect:
+    None.
+
+Approach:
+    Linear search of the language table.
+*/
+const StopWordSet* StopWordSet::forLanguage(std::string_view language) {
+    for (const auto& set : languages) {
+        if (set.language() == language) {
+            return &set;
+        }
+    }
+
+    return nullptr;
+}
+
+/*
+-------------------------------------------------
+Function Name : english()
+
+Objective:
+    Return the default stopword list.
+
+Input:
+    None.
+
+Output:
+    The English set.
+
+Side Effect:
+    None.
+
+Approach:
+    Return the first entry of the language table.
+*/
+const StopWordSet& StopWordSet::english() {
+    return languages[0];
+}
+
+/*
+-------------------------------------------------
+Function Name : languageNames()
+
+Objective:
+    List the compiled languages.
+
+Input:
+    None.
+
+Output:
+    Comma-separated names.
+
+Side Effect:
+    None.
+
+Approach:
+    Join the names of the language table.
+*/
+std::string StopWordSet::languageNames() {
+    std::string names;
+
+    for (const auto& set : languages) {
+        if (!names.empty()) {
+            names += ", ";
+        }
+        names += set.language();
+    }
+
+    return names;
+}
@@ -0,0 +1,407 @@
+#ifndef STOPWORDS_H
+#define STOPWORDS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "HashUtils.h"
+
+/*
+    ========================================================================
+                            HEADER : StopWords
+    ========================================================================
+
+    Objective:
+        Compile every stopword list into a perfect hash table, so the
+        per-token stopword check costs one short hash, one probe and at
+        most one comparison, with no allocation and no runtime setup:
+            - StopWordTable<N> is built by a constexpr function from a
+              plain array of words (hash and displace: words are grouped
+              into buckets, and each bucket gets a seed that moves all
+              of its words into free slots)
+            - StopWordSet is a small, copyable view of one table that
+              TextCleaner keeps and queries
+            - One table per language is compiled in; adding a language
+              is one more word array in StopWords.cpp
+
+    Input:
+        - Arrays of distinct, nonempty, lowercase ASCII words. Duplicates
+          or empty words make the table fail to compile.
+
+    Output:
+        - Constant tables in static storage and views of them.
+
+    Side Effects:
+        - None. Everything is read-only, so a set can be shared by any
+          number of threads.
+
+    Notes:
+        Tokens are runs of ASCII letters and digits, so a word with any
+        other byte (accents, apostrophes) could never match and does not
+        belong in a list.
+*/
+
+/*
+    Objective:
+        Hash a stopword or token (FNV-1a).
+
+    Input:
+        word → bytes to hash.
+
+    Output:
+        64-bit hash; the same at compile time and at run time.
+
+    Side Effects:
+        None.
+*/
+constexpr uint64_t stopWordHash(std::string_view word) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+
+    for (char c : word) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001B3ULL;
+    }
+
+    return hash;
+}
+
+/*
+    Objective:
+        Round a table size up to a power of two.
+
+    Input:
+        n → requested size.
+
+    Output:
+        Smallest power of two >= n (at least 1).
+
+    Side Effects:
+        None.
+*/
+constexpr size_t stopWordTableSize(size_t n) {
+    size_t size = 1;
+
+    while (size < n) {
+        size <<= 1;
+    }
+
+    return size;
+}
+
+/*
+    Objective:
+        Hold one compiled stopword list.
+
+    Input:
+        N → number of words.
+
+    Output:
+        None.
+
+    Side Effects:
+        None.
+
+    Notes:
+        Slots are at most half full and buckets hold about four words,
+        which keeps the seed search short (and the build well inside the
+        compiler's constexpr limits). Empty slots hold an empty view,
+        which never equals a token.
+*/
+template <size_t N>
+struct StopWordTable {
+    static constexpr size_t slotCount = stopWordTableSize(2 * N);
+    static constexpr size_t bucketCount = stopWordTableSize((N + 3) / 4);
+
+    std::array<std::string_view, slotCount> slots{};
+    std::array<uint64_t, bucketCount> seeds{};
+    size_t longest = 0;
+    uint64_t digest = 0;
+};
+
+/*
+    Objective:
+        Build the perfect hash table of a word list at compile time.
+
+    Input:
+        words → N distinct, nonempty words.
+
+    Output:
+        The filled table.
+
+    Side Effects:
+        None.
+
+    Approach:
+        - Reject empty and duplicate words.
+        - Bucket every word by the high half of its hash.
+        - Visit buckets from largest to smallest and, for each, try seeds
+          0, 1, 2, ... until mixHash(hash ^ seed) puts every word of the
+          bucket in a distinct free slot.
+        - Fold the slot contents into a digest identifying the list.
+
+    Notes:
+        A 'throw' reached during constant evaluation is a compile error,
+        which is how bad lists are reported.
+*/
+template <size_t N>
+constexpr StopWordTable<N> buildStopWordTable(const std::string_view (&words)[N]) {
+    using Table = StopWordTable<N>;
+    Table table{};
+
+    std::array<uint64_t, N> hashes{};
+    std::array<size_t, N> bucketOf{};
+    std::array<size_t, Table::bucketCount> bucketSize{};
+    size_t largestBucket = 0;
+
+    for (size_t w = 0; w < N; w++) {
+        if (words[w].empty()) {
+            throw "empty stopword";
+        }
+
+        for (size_t v = 0; v < w; v++) {
+            if (words[v] == words[w]) {
+                throw "duplicate stopword";
+            }
+        }
+
+        hashes[w] = stopWordHash(words[w]);
+        bucketOf[w] = (hashes[w] >> 32) & (Table::bucketCount - 1);
+
+        if (++bucketSize[bucketOf[w]] > largestBucket) {
+            largestBucket = bucketSize[bucketOf[w]];
+        }
+
+        if (words[w].size() > table.longest) {
+            table.longest = words[w].size();
+        }
+    }
+
+    std::array<bool, Table::slotCount> used{};
+    std::array<size_t, N> placed{};
+
+    for (size_t size = largestBucket; size > 0; size--) {
+        for (size_t b = 0; b < Table::bucketCount; b++) {
+            if (bucketSize[b] != size) continue;
+
+            bool fits = false;
+
+            for (uint64_t seed = 0; seed < (uint64_t(1) << 20) && !fits; seed++) {
+                size_t count = 0;
+                fits = true;
+
+                for (size_t w = 0; w < N && fits; w++) {
+                    if (bucketOf[w] != b) continue;
+
+                    size_t slot = mixHash(hashes[w] ^ seed) & (Table::slotCount - 1);
+
+                    for (size_t k = 0; k < count && fits; k++) {
+                        fits = placed[k] != slot;
+                    }
+
+                    fits = fits && !used[slot];
+                    placed[count++] = slot;
+                }
+
+                if (fits) {
+                    table.seeds[b] = seed;
+
+                    size_t k = 0;
+                    for (size_t w = 0; w < N; w++) {
+                        if (bucketOf[w] != b) continue;
+
+                        used[placed[k]] = true;
+                        table.slots[placed[k++]] = words[w];
+                    }
+                }
+            }
+
+            if (!fits) {
+                throw "no perfect hash seed found";
+            }
+        }
+    }
+
+    for (size_t s = 0; s < Table::slotCount; s++) {
+        table.digest = combineHash(table.digest, stopWordHash(table.slots[s]));
+    }
+
+    return table;
+}
+
+/*
+    ========================================================================
+                            CLASS : StopWordSet
+    ========================================================================
+
+    Objective:
+        View one compiled stopword list by language and answer
+        membership queries for the tokenizer.
+
+    Input:
+        - A language name, or a compiled StopWordTable.
+
+    Output:
+        - contains(), inlined into the tokenizer loop.
+
+    Side Effects:
+        - None. A default-constructed set is empty ("none").
+*/
+
+class StopWordSet {
+private:
+
+    // Language of the list
+    std::string_view name = "none";
+
+    // Views of the table in static storage
+    const std::string_view* slots = nullptr;
+    const uint64_t* seeds = nullptr;
+    uint64_t slotMask = 0;
+    uint64_t bucketMask = 0;
+
+    // Longest word; 0 for the empty set
+    size_t longest = 0;
+
+    // Number of words
+    size_t words = 0;
+
+    // Identity of the list
+    uint64_t tableDigest = 0;
+
+public:
+
+    /*
+        Objective:
+            Create the empty set.
+
+        Input:
+            None.
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    constexpr StopWordSet() = default;
+
+    /*
+        Objective:
+            View a compiled table.
+
+        Input:
+            language → name of the list.
+            table    → table in static storage.
+
+        Output:
+            None.
+
+        Side Effects:
+            None; 'table' must outlive the view.
+    */
+    template <size_t N>
+    constexpr StopWordSet(std::string_view language, const StopWordTable<N>& table)
+        : name(language), slots(table.slots.data()), seeds(table.seeds.data()),
+          slotMask(StopWordTable<N>::slotCount - 1),
+          bucketMask(StopWordTable<N>::bucketCount - 1),
+          longest(table.longest), words(N), tableDigest(table.digest) {
+    }
+
+    /*
+        Objective:
+            Look up a compiled list.
+
+        Input:
+            language → "english", "french", "german", "spanish" or
+                       "none".
+
+        Output:
+            Pointer to the set; nullptr if no such list is compiled in.
+
+        Side Effects:
+            None.
+    */
+    static const StopWordSet* forLanguage(std::string_view language);
+
+    /*
+        Objective:
+            Return the default list.
+
+        Input:
+            None.
+
+        Output:
+            The English set.
+
+        Side Effects:
+            None.
+    */
+    static const StopWordSet& english();
+
+    /*
+        Objective:
+            List the compiled languages, for help and error messages.
+
+        Input:
+            None.
+
+        Output:
+            Comma-separated language names.
+
+        Side Effects:
+            None.
+    */
+    static std::string languageNames();
+
+    /*
+        Objective:
+            Test whether a token is a stopword.
+
+        Input:
+            word → lowercase token.
+
+        Output:
+            true if the word is in the list.
+
+        Side Effects:
+            None.
+
+        Approach:
+            Tokens longer than the longest word are rejected without
+            hashing; otherwise hash, pick the bucket's seed, probe the
+            single candidate slot and compare.
+    */
+    bool contains(std::string_view word) const {
+        if (word.empty() || word.size() > longest) {
+            return false;
+        }
+
+        uint64_t hash = stopWordHash(word);
+        uint64_t seed = seeds[(hash >> 32) & bucketMask];
+
+        return slots[mixHash(hash ^ seed) & slotMask] == word;
+    }
+
+    /*
+        Objective:
+            Describe the set.
+
+        Input:
+            None.
+
+        Output:
+            language() : name of the list.
+            size()     : number of words.
+            digest()   : hash of the list, for cache compatibility checks.
+
+        Side Effects:
+            None.
+    */
+    std::string_view language() const { return name; }
+    size_t size() const { return words; }
+    uint64_t digest() const { return tableDigest; }
+};
+
+#endif // STOPWORDS_H
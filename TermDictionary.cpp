@@ -0,0 +1,176 @@
+#include "TermDictionary.h"
+
+/*
+-------------------------------------------------
+Function Name : TermDictionary (Constructor)
+
+Objective:
+    Create an empty dictionary on a memory resource.
+
+Input:
+    resource → Allocation source for all storage.
+
+Output:
+    TermDictionary object initialized.
+
+Side Effect:
+    None.
+
+Approach:
+    Hand the resource to both containers.
+*/
+TermDictionary::TermDictionary(std::pmr::memory_resource* resource)
+    : terms(resource), ids(resource) {
+}
+
+/*
+-------------------------------------------------
+Function Name : operator= (Move Assignment)
+
+Objective:
+    Move terms from another dictionary.
+
+Input:
+    other → Source dictionary.
+
+Output:
+    Reference to this dictionary.
+
+Side Effect:
+    Empties the source.
+
+Approach:
+    Polymorphic allocators do not propagate on move assignment, so
+    containers on different resources would move strings one by one
+    and invalidate the key views. Steal storage only when resources
+    match; otherwise re-intern every term.
+
+    // call intern()
+*/
+TermDictionary& TermDictionary::operator=(TermDictionary&& other) {
+
+    if (this == &other) {
+        return *this;
+    }
+
+    if (terms.get_allocator() == other.terms.get_allocator()) {
+        terms = std::move(other.terms);
+        ids = std::move(other.ids);
+    } else {
+        terms.clear();
+        ids.clear();
+
+        for (const auto& term : other.terms) {
+            // call intern()
+            intern(term);
+        }
+    }
+
+    other.terms.clear();
+    other.ids.clear();
+
+    return *this;
+}
+
+/*
+-------------------------------------------------
+Function Name : intern()
+
+Objective:
+    Map a term to its integer ID.
+
+Input:
+    term → Word to intern.
+
+Output:
+    Existing or newly assigned term ID.
+
+Side Effect:
+    Adds unseen terms to the dictionary.
+
+Approach:
+    Look up the term; if missing, store a copy and index a view of it.
+*/
+uint32_t TermDictionary::intern(std::string_view term) {
+    auto it = ids.find(term);
+
+    if (it != ids.end()) {
+        return it->second;
+    }
+
+    uint32_t id = static_cast<uint32_t>(terms.size());
+    terms.emplace_back(term);
+    ids.emplace(std::string_view(terms.back()), id);
+
+    return id;
+}
+
+/*
+-------------------------------------------------
+Function Name : find()
+
+Objective:
+    Look up a term ID without modifying the dictionary.
+
+Input:
+    term → Word to look up.
+
+Output:
+    Term ID or npos.
+
+Side Effect:
+    None.
+
+Approach:
+    Hash lookup on the term view.
+*/
+uint32_t TermDictionary::find(std::string_view term) const {
+    auto it = ids.find(term);
+    return (it != ids.end()) ? it->second : npos;
+}
+
+/*
+-------------------------------------------------
+Function Name : getTerm()
+
+Objective:
+    Retrieve the string of a term ID.
+
+Input:
+    id → Term ID.
+
+Output:
+    View of the term string.
+
+Side Effect:
+    None.
+
+Approach:
+    Index into stored terms.
+*/
+std::string_view TermDictionary::getTerm(uint32_t id) const {
+    return terms[id];
+}
+
+/*
+-------------------------------------------------
+Function Name : size()
+
+Objective:
+    Retrieve number of interned terms.
+
+Input:
+    None.
+
+Output:
+    Dictionary size.
+
+Side Effect:
+    None.
+
+Approach:
+    Return size of term storage.
+*/
+size_t TermDictionary::size() const {
+    return terms.size();
+}
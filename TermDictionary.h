@@ -0,0 +1,182 @@
+#ifndef TERMDICTIONARY_H
+#define TERMDICTIONARY_H
+
+#include <cstdint>
+#include <deque>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/*
+    ========================================================================
+                          CLASS : TermDictionary
+    ========================================================================
+
+    Objective:
+        The TermDictionary class interns vocabulary words into compact
+        integer term IDs shared by every pipeline stage:
+            - TextCleaner fills it while tokenizing
+            - FeatureExtractor and InvertedIndex key their tables on IDs
+            - SimilarityChecker compares (termId, weight) vectors
+        Integer IDs replace string keys so lookups and comparisons on the
+        hot path no longer hash or compare strings.
+
+    Input:
+        - Term strings (any lowercased word produced by the cleaner).
+
+    Output:
+        - A stable uint32 ID for every distinct term.
+        - The term string for a given ID.
+
+    Side Effects:
+        - None externally.
+        - IDs are assigned in order of first appearance, starting at 0.
+        - Terms and the hash table are allocated from a caller-supplied
+          memory resource, so a dictionary can live in a per-run or
+          per-document arena and be released in one shot.
+*/
+
+class TermDictionary {
+private:
+
+    /*
+        Objective:
+            Store term strings, indexed by term ID.
+
+        Input:
+            Appended by intern().
+
+        Output:
+            None.
+
+        Side Effects:
+            std::deque never relocates its elements on push_back, so the
+            string_view keys of 'ids' stay valid as the dictionary grows.
+    */
+    std::pmr::deque<std::pmr::string> terms;
+
+    /*
+        Objective:
+            Map each term to its ID for O(1) lookup.
+
+        Input:
+            Filled by intern().
+
+        Output:
+            None.
+
+        Side Effects:
+            Keys view the strings stored in 'terms'.
+    */
+    std::pmr::unordered_map<std::string_view, uint32_t> ids;
+
+public:
+
+    // Returned by find() when a term has not been interned
+    static constexpr uint32_t npos = UINT32_MAX;
+
+    /*
+        Objective:
+            Create an empty dictionary.
+
+        Input:
+            resource → memory resource for terms and hash table (the
+                       default heap if omitted); must outlive the
+                       dictionary.
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    explicit TermDictionary(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    // Keys view the internal strings, so copying would leave them dangling
+    TermDictionary(const TermDictionary&) = delete;
+    TermDictionary& operator=(const TermDictionary&) = delete;
+
+    // Moving keeps the source's resource, so the strings do not move
+    TermDictionary(TermDictionary&&) = default;
+
+    /*
+        Objective:
+            Take over another dictionary's terms.
+
+        Input:
+            other → dictionary to move from.
+
+        Output:
+            Reference to this dictionary.
+
+        Side Effects:
+            Leaves 'other' empty. Storage is stolen when both use the
+            same resource; otherwise the terms are re-interned into
+            this dictionary's resource so no key is left dangling.
+    */
+    TermDictionary& operator=(TermDictionary&& other);
+
+    /*
+        Objective:
+            Return the ID of a term, adding it if it is new.
+
+        Input:
+            term → word to intern.
+
+        Output:
+            Term ID.
+
+        Side Effects:
+            May append the term to the dictionary.
+    */
+    uint32_t intern(std::string_view term);
+
+    /*
+        Objective:
+            Look up the ID of a term without adding it.
+
+        Input:
+            term → word to look up.
+
+        Output:
+            Term ID, or TermDictionary::npos if unknown.
+
+        Side Effects:
+            None.
+    */
+    uint32_t find(std::string_view term) const;
+
+    /*
+        Objective:
+            Return the term string of an ID.
+
+        Input:
+            id → term ID (must be < size()).
+
+        Output:
+            View of the stored term, valid while the dictionary lives.
+
+        Side Effects:
+            None.
+    */
+    std::string_view getTerm(uint32_t id) const;
+
+    /*
+        Objective:
+            Return the number of interned terms.
+
+        Input:
+            None.
+
+        Output:
+            Dictionary size (also one past the largest term ID).
+
+        Side Effects:
+            None.
+    */
+    size_t size() const;
+};
+
+#endif // TERMDICTIONARY_H
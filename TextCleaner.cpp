@@ -1,15 +1,55 @@
 #include "TextCleaner.h"
-#include <algorithm>
-#include <sstream>
-#include <cctype>
-#include <iostream>
+#include <array>
+
+namespace {
+
+// Byte classes of the tokenizer (ASCII only, like the "C" locale)
+enum ByteClass : unsigned char {
+    WordByte = 1,   // letter or digit
+    UpperByte = 2,  // 'A'-'Z'
+    SpaceByte = 4   // ' ', '\t', '\n', '\v', '\f', '\r'
+};
+
+// Class bits of every byte
+constexpr std::array<unsigned char, 256> makeByteClassTable() {
+    std::array<unsigned char, 256> table{};
+
+    for (int c = 0; c < 256; c++) {
+        bool upper = (c >= 'A' && c <= 'Z');
+        bool lower = (c >= 'a' && c <= 'z');
+        bool digit = (c >= '0' && c <= '9');
+        bool space = (c == ' ' || (c >= '\t' && c <= '\r'));
+
+        table[c] = static_cast<unsigned char>((upper || lower || digit ? WordByte : 0) |
+                                              (upper ? UpperByte : 0) |
+                                              (space ? SpaceByte : 0));
+    }
+
+    return table;
+}
+
+// Lowercase form of every byte ('A'-'Z' to 'a'-'z', others unchanged)
+constexpr std::array<unsigned char, 256> makeLowerTable() {
+    std::array<unsigned char, 256> table{};
+
+    for (int c = 0; c < 256; c++) {
+        table[c] = static_cast<unsigned char>((c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c);
+    }
+
+    return table;
+}
+
+constexpr std::array<unsigned char, 256> byteClass = makeByteClassTable();
+constexpr std::array<unsigned char, 256> lowerTable = makeLowerTable();
+
+} // namespace
 
 /*
 -------------------------------------------------
 Function Name : TextCleaner (Constructor)
 
 Objective:
-    Initialize TextCleaner and load stopwords.
+    Initialize TextCleaner with English stopwords.
 
 Input:
     None.
@@ -18,54 +58,61 @@ Output:
     TextCleaner object initialized.
 
 Side Effect:
-    Loads stopwords into internal set.
+    None.
 
 Approach:
-    Calls stopword initialization routine.
+    Delegate to the list constructor.
 
-    // call initializeStopWords()
+    // call StopWordSet::english()
 */
-TextCleaner::TextCleaner() {
-    // call initializeStopWords()
-    initializeStopWords();
+TextCleaner::TextCleaner()
+    // call StopWordSet::english()
+    : TextCleaner(StopWordSet::english()) {
 }
 
 /*
 -------------------------------------------------
-Function Name : initializeStopWords()
+Function Name : TextCleaner (Constructor, stopword list)
 
 Objective:
-    Fill stopWords set with common English words.
+    Initialize TextCleaner with a compiled stopword list.
 
 Input:
-    None.
+    stopWordSet → Stopword list.
 
 Output:
-    None.
+    TextCleaner object initialized.
 
 Side Effect:
-    Populates internal stopWords container.
+    None.
 
 Approach:
-    Insert predefined words into unordered_set.
+    Copy the view; the table itself is static.
 */
-void TextCleaner::initializeStopWords() {
-
-    std::vector<std::string> words = {
-        "a", "an", "and", "are", "as", "at", "be", "by", "for", "from",
-        "has", "he", "in", "is", "it", "its", "of", "on", "that", "the",
-        "to", "was", "will", "with", "the", "this", "but", "they", "have",
-        "had", "what", "said", "each", "which", "their", "time", "if",
-        "up", "out", "many", "then", "them", "these", "so", "some", "her",
-        "would", "make", "like", "into", "him", "has", "two", "more",
-        "very", "after", "words", "long", "than", "first", "been", "call",
-        "who", "oil", "sit", "now", "find", "down", "day", "did", "get",
-        "come", "made", "may", "part"
-    };
+TextCleaner::TextCleaner(const StopWordSet& stopWordSet) : stopWords(stopWordSet) {
+}
 
-    for (const auto& word : words) {
-        stopWords.insert(word);
-    }
+/*
+-------------------------------------------------
+Function Name : stopWordSet()
+
+Objective:
+    Return the stopword list in use.
+
+Input:
+    None.
+
+Output:
+    StopWordSet view.
+
+Side Effect:
+    None.
+
+Approach:
+    Return the member.
+*/
+const StopWordSet& TextCleaner::stopWordSet() const {
+    return stopWords;
 }
 
 /*
@@ -85,11 +132,15 @@ Side Effect:
     None.
 
 Approach:
-    Apply ::tolower to each character.
+    Map each byte through the lowercase table.
 */
 std::string TextCleaner::toLower(const std::string& text) const {
     std::string result = text;
-    std::transform(result.begin(), result.end(), result.begin(), ::tolower);
+
+    for (char& c : result) {
+        c = static_cast<char>(lowerTable[static_cast<unsigned char>(c)]);
+    }
+
     return result;
 }
 
@@ -111,17 +162,14 @@ Side Effect:
 
 
 Approach:
-    Replace non-alphanumeric characters with space.
+    Replace bytes that are neither word nor space bytes with space.
 */
 std::string TextCleaner::removePunctuation(const std::string& text) const {
-    std::string result;
-    result.reserve(text.size());
+    std::string result = text;
 
-    for (char c : text) {
-        if (std::isalnum(c) || std::isspace(c)) {
-            result += c;
-        } else {
-            result += ' ';
+    for (char& c : result) {
+        if (!(byteClass[static_cast<unsigned char>(c)] & (WordByte | SpaceByte))) {
+            c = ' ';
         }
     }
 
@@ -153,7 +201,7 @@ std::vector<std::string> TextCleaner::removeStopWords(
     std::vector<std::string> filtered;
 
     for (const auto& token : tokens) {
-        if (stopWords.find(token) == stopWords.end() && !token.empty()) {
+        if (!token.empty() && !stopWords.contains(token)) {
             filtered.push_back(token);
         }
     }
@@ -177,25 +225,106 @@ Output:
 Side Effect:
     None.
 
-Inside Function:
 Approach:
-    Use string stream to extract words.
+    Collect the runs of non-space bytes.
 */
 std::vector<std::string> TextCleaner::tokenize(const std::string& text) const {
 
     std::vector<std::string> tokens;
-    std::istringstream iss(text);
-    std::string token;
+    size_t length = text.size();
+    size_t pos = 0;
 
-    while (iss >> token) {
-        if (!token.empty()) {
-            tokens.push_back(token);
+    auto isSpace = [&](size_t at) {
+        return (byteClass[static_cast<unsigned char>(text[at])] & SpaceByte) != 0;
+    };
+
+    while (pos < length) {
+        while (pos < length && isSpace(pos)) {
+            pos++;
+        }
+
+        size_t start = pos;
+
+        while (pos < length && !isSpace(pos)) {
+            pos++;
+        }
+
+        if (pos > start) {
+            tokens.emplace_back(text, start, pos - start);
         }
     }
 
     return tokens;
 }
 
+/*
+-------------------------------------------------
+Function Name : nextToken()
+
+Objective:
+    Extract the next cleaned token directly from a raw buffer.
+
+Input:
+    text    → raw document.
+    pos     → current scan position.
+    scratch → reusable lowercase buffer.
+    token   → receives the token view.
+
+Output:
+    true if a token was found.
+
+Side Effect:
+    Advances pos; may overwrite scratch.
+
+Approach:
+    Skip non-word bytes, take the following run of word bytes,
+    lowercase it into scratch only if it has uppercase letters,
+    and repeat while the run is a stopword.
+*/
+bool TextCleaner::nextToken(std::string_view text, size_t& pos,
+                            std::string& scratch, std::string_view& token) const {
+
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(text.data());
+    size_t length = text.size();
+
+    while (pos < length) {
+
+        // Skip separators (whitespace and punctuation)
+        while (pos < length && !(byteClass[bytes[pos]] & WordByte)) {
+            pos++;
+        }
+
+        if (pos >= length) {
+            break;
+        }
+
+        size_t start = pos;
+        unsigned char classes = 0;
+
+        while (pos < length && (byteClass[bytes[pos]] & WordByte)) {
+            classes |= byteClass[bytes[pos]];
+            pos++;
+        }
+
+        if (classes & UpperByte) {
+            scratch.resize(pos - start);
+            for (size_t k = start; k < pos; k++) {
+                scratch[k - start] = static_cast<char>(lowerTable[bytes[k]]);
+            }
+            token = std::string_view(scratch);
+        } else {
+            token = text.substr(start, pos - start);
+        }
+
+        // Inline stopword check
+        if (!stopWords.contains(token)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 /*
 -------------------------------------------------
 Function Name : preprocess()
@@ -213,26 +342,101 @@ Side Effect:
     None.
 
 Approach:
-    Apply lowercase, punctuation removal, tokenization and stopword filtering.
+    Lowercase, punctuation removal, tokenization and stopword
+    filtering in one pass over the text.
 
-    // call toLower()
-    // call removePunctuation()
-    // call tokenize()
-    // call removeStopWords()
+    // call nextToken()
 */
 std::vector<std::string> TextCleaner::preprocess(const std::string& text) const {
 
-    // call toLower()
-    std::string lowerText = toLower(text);
+    std::vector<std::string> cleaned;
 
-    // call removePunctuation()
-    std::string noPunct = removePunctuation(lowerText);
+    size_t pos = 0;
+    std::string scratch;
+    std::string_view token;
 
-    // call tokenize()
-    std::vector<std::string> tokens = tokenize(noPunct);
-
-    // call removeStopWords()
-    std::vector<std::string> cleaned = removeStopWords(tokens);
+    // call nextToken()
+    while (nextToken(text, pos, scratch, token)) {
+        cleaned.emplace_back(token);
+    }
 
     return cleaned;
 }
+
+/*
+-------------------------------------------------
+Function Name : preprocess() (dictionary overload)
+
+Objective:
+    Perform full text cleaning and map tokens to term IDs.
+
+Input:
+    text       → raw document.
+    dictionary → shared term dictionary.
+
+Output:
+    Vector of term IDs of cleaned tokens.
+
+Side Effect:
+    Interns new terms into the dictionary.
+
+Approach:
+    Scan the raw buffer once and intern every token as it is found.
+
+    // call nextToken()
+*/
+std::vector<uint32_t> TextCleaner::preprocess(std::string_view text,
+                                              TermDictionary& dictionary) const {
+
+    std::vector<uint32_t> termIds;
+
+    size_t pos = 0;
+    std::string scratch;
+    std::string_view token;
+
+    // call nextToken()
+    while (nextToken(text, pos, scratch, token)) {
+        termIds.push_back(dictionary.intern(token));
+    }
+
+    return termIds;
+}
+
+/*
+-------------------------------------------------
+Function Name : preprocess() (feature hashing overload)
+
+Objective:
+    Perform full text cleaning and hash tokens into features.
+
+Input:
+    text   → raw document.
+    hasher → feature hasher.
+
+Output:
+    Vector of signed feature IDs of cleaned tokens.
+
+Side Effect:
+    None.
+
+Approach:
+    Scan the raw buffer once and hash every token as it is found.
+
+    // call nextToken()
+*/
+std::vector<uint32_t> TextCleaner::preprocess(std::string_view text,
+                                              const FeatureHasher& hasher) const {
+
+    std::vector<uint32_t> featureIds;
+
+    size_t pos = 0;
+    std::string scratch;
+    std::string_view token;
+
+    // call nextToken()
+    while (nextToken(text, pos, scratch, token)) {
+        featureIds.push_back(hasher.featureId(token));
+    }
+
+    return featureIds;
+}
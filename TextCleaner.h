@@ -3,7 +3,12 @@
 
 #include <vector>
 #include <string>
-#include <unordered_set>
+#include <string_view>
+#include <cstdint>
+
+#include "StopWords.h"
+#include "TermDictionary.h"
+#include "FeatureHasher.h"
 
 /*
     ========================================================================
@@ -17,7 +22,8 @@
             - Lowercasing text
             - Removing punctuation
             - Splitting text into tokens (tokenization)
-            - Removing common English stopwords
+            - Removing common stopwords (English unless another
+              compiled language is chosen)
         These preprocessing steps improve analysis quality and reduce noise.
 
     Input:
@@ -25,11 +31,14 @@
         - Tokenized lists of words
 
     Output:
-        - Cleaned and tokenized vector<string> suitable for FeatureExtractor.
+        - Cleaned and tokenized vector<string>, or the same tokens as
+          TermDictionary IDs (vector<uint32_t>) for FeatureExtractor.
 
     Side Effects:
-        - None externally.
-        - Internally initializes a stopword set but does not modify inputs.
+        - None. The stopword table and the byte classification tables
+          are compile-time constants, so construction does no work.
+        - All members are read-only after construction, so one instance
+          can be shared by several threads.
 */
 
 class TextCleaner {
@@ -37,22 +46,27 @@ private:
 
     /*
         Objective:
-            Store a set of English stopwords for fast lookup.
+            Hold the stopword list of the configured language.
 
         Input:
-            Populated internally during construction.
+            Set during construction.
 
         Output:
             None.
 
         Side Effects:
-            Used by removeStopWords() to eliminate low-value words.
+            Used by removeStopWords() and nextToken() to eliminate
+            low-value words. The list is a perfect hash table compiled
+            into the program (see StopWords.h), so string_view tokens
+            are looked up without hashing a std::string or allocating.
     */
-    std::unordered_set<std::string> stopWords;
+    StopWordSet stopWords;
+
+public:
 
     /*
         Objective:
-            Populate the stopWords set with common English function words.
+            Initialize TextCleaner with the English stopword list.
 
         Input:
             None.
@@ -61,29 +75,40 @@ private:
             None.
 
         Side Effects:
-            Modifies the 'stopWords' set during initialization.
-
-        Approach:
-            - Insert hardcoded stopwords into an unordered_set for O(1) lookup.
+            None.
     */
-    void initializeStopWords();
+    TextCleaner();
 
-public:
+    /*
+        Objective:
+            Initialize TextCleaner with another stopword list.
+
+        Input:
+            stopWordSet → compiled list, e.g. from
+                          StopWordSet::forLanguage().
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    explicit TextCleaner(const StopWordSet& stopWordSet);
 
     /*
         Objective:
-            Initialize TextCleaner and load stopwords.
+            Return the stopword list in use.
 
         Input:
             None.
 
         Output:
-            None.
+            The configured StopWordSet.
 
         Side Effects:
-            Calls initializeStopWords() internally.
+            None.
     */
-    TextCleaner();
+    const StopWordSet& stopWordSet() const;
 
     /*
         Objective:
@@ -153,10 +178,37 @@ public:
             None.
 
         Approach:
-            - Uses stringstream to split on whitespace.
+            - Splits on whitespace bytes of the byte class table.
     */
     std::vector<std::string> tokenize(const std::string& text) const;
 
+    /*
+        Objective:
+            Scan a raw buffer for its next non-stopword token in a single
+            pass, without copying the buffer.
+
+        Input:
+            text    → raw document content (any case, any punctuation).
+            pos     → scan position; start at 0, advanced past the token.
+            scratch → reusable buffer for tokens that need lowercasing.
+
+        Output:
+            true and 'token' set to the lowercased word, or false at the
+            end of the buffer.
+
+        Side Effects:
+            'token' views either 'text' (already lowercase) or 'scratch',
+            and is valid until the next call.
+
+        Approach:
+            - Classify bytes through the byte class table to find word
+              runs and whether they hold uppercase letters.
+            - Lowercase through the lowercase table only when they do.
+            - Check the stopword set inline and skip matches.
+    */
+    bool nextToken(std::string_view text, size_t& pos,
+                   std::string& scratch, std::string_view& token) const;
+
     /*
         Objective:
             Run the complete preprocessing pipeline:
@@ -173,8 +225,57 @@ public:
 
         Side Effects:
             None.
+
+        Approach:
+            - Single pass with nextToken(); equivalent to the four steps.
     */
     std::vector<std::string> preprocess(const std::string& text) const;
+
+    /*
+        Objective:
+            Run the complete preprocessing pipeline and intern every
+            surviving token into a shared term dictionary.
+
+        Input:
+            text       → raw document content.
+            dictionary → dictionary receiving new terms.
+
+        Output:
+            vector<uint32_t> → term IDs of the cleaned tokens, in order.
+
+        Side Effects:
+            Adds unseen terms to 'dictionary'.
+
+        Approach:
+            - Single pass with nextToken(); tokens are interned straight
+              from the raw buffer with no intermediate strings.
+    */
+    std::vector<uint32_t> preprocess(std::string_view text,
+                                     TermDictionary& dictionary) const;
+
+    /*
+        Objective:
+            Run the complete preprocessing pipeline and hash every
+            surviving token into a fixed feature space.
+
+        Input:
+            text   → raw document content.
+            hasher → feature hasher.
+
+        Output:
+            vector<uint32_t> → signed feature IDs of the cleaned tokens,
+                               in order.
+
+        Side Effects:
+            None; no shared state is touched, so documents can be
+            processed fully in parallel.
+
+        Approach:
+            - Single pass with nextToken(); tokens are hashed straight
+              from the raw buffer.
+    */
+    std::vector<uint32_t> preprocess(std::string_view text,
+                                     const FeatureHasher& hasher) const;
 };
 
 #endif // TEXTCLEANER_H
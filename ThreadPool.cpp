@@ -0,0 +1,180 @@
+#include "ThreadPool.h"
+#include <thread>
+
+/*
+-------------------------------------------------
+Function Name : ThreadPool (Constructor)
+
+Objective:
+    Configure worker count.
+
+Input:
+    threads → Requested worker count (< 1 means all hardware threads).
+
+Output:
+    ThreadPool object initialized.
+
+Side Effect:
+    None.
+
+Approach:
+    Fall back to std::thread::hardware_concurrency() for non-positive
+    values, and to one worker if that is unknown.
+*/
+ThreadPool::ThreadPool(int threads) : threadCount(threads) {
+
+    if (threadCount < 1) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+    }
+
+    if (threadCount < 1) {
+        threadCount = 1;
+    }
+}
+
+/*
+-------------------------------------------------
+Function Name : size()
+
+Objective:
+    Retrieve worker count.
+
+Input:
+    None.
+
+Output:
+    Number of workers.
+
+Side Effect:
+    None.
+
+Approach:
+    Return stored value.
+*/
+int ThreadPool::size() const {
+    return threadCount;
+}
+
+/*
+-------------------------------------------------
+Function Name : nextTask()
+
+Objective:
+    Give a worker its next task.
+
+Input:
+    queues → Per-worker task queues.
+    worker → Asking worker index.
+    task   → Output task index.
+
+Output:
+    true if a task was assigned.
+
+Side Effect:
+    Pops one task from a queue.
+
+Approach:
+    Pop the front of the worker's own queue; if empty, visit the
+    other workers in turn and steal from the back of the first
+    non-empty queue.
+*/
+bool ThreadPool::nextTask(std::vector<WorkQueue>& queues, int worker, size_t& task) {
+
+    {
+        std::lock_guard<std::mutex> guard(queues[worker].lock);
+
+        if (!queues[worker].tasks.empty()) {
+            task = queues[worker].tasks.front();
+            queues[worker].tasks.pop_front();
+            return true;
+        }
+    }
+
+    int count = static_cast<int>(queues.size());
+
+    for (int offset = 1; offset < count; offset++) {
+        WorkQueue& victim = queues[(worker + offset) % count];
+        std::lock_guard<std::mutex> guard(victim.lock);
+
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.back();
+            victim.tasks.pop_back();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+-------------------------------------------------
+Function Name : run()
+
+Objective:
+    Execute a batch of tasks in parallel.
+
+Input:
+    taskCount → Number of tasks.
+    task      → Callable (taskIndex, workerIndex).
+
+Output:
+    None.
+
+Side Effect:
+    Spawns and joins worker threads.
+
+Approach:
+    Deal tasks into contiguous per-worker ranges, start the
+    workers (the caller is worker 0) and join them.
+*/
+void ThreadPool::run(size_t taskCount,
+                     const std::function<void(size_t, int)>& task) const {
+
+    if (taskCount == 0) {
+        return;
+    }
+
+    int workers = threadCount;
+    if (static_cast<size_t>(workers) > taskCount) {
+        workers = static_cast<int>(taskCount);
+    }
+
+    if (workers == 1) {
+        for (size_t t = 0; t < taskCount; t++) {
+            task(t, 0);
+        }
+        return;
+    }
+
+    std::vector<WorkQueue> queues(workers);
+
+    // Deal tasks into contiguous ranges, one per worker
+    for (int w = 0; w < workers; w++) {
+        size_t begin = taskCount * w / workers;
+        size_t end   = taskCount * (w + 1) / workers;
+
+        for (size_t t = begin; t < end; t++) {
+            queues[w].tasks.push_back(t);
+        }
+    }
+
+    auto workerLoop = [&](int worker) {
+        size_t t;
+        while (nextTask(queues, worker, t)) {
+            task(t, worker);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+
+    for (int w = 1; w < workers; w++) {
+        threads.emplace_back(workerLoop, w);
+    }
+
+    workerLoop(0);
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
@@ -0,0 +1,142 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/*
+    ========================================================================
+                            CLASS : ThreadPool
+    ========================================================================
+
+    Objective:
+        The ThreadPool class runs a batch of independent, indexed tasks on a
+        fixed number of worker threads. Load is balanced by work stealing:
+            - Tasks are first split into one contiguous range per worker
+            - Each worker consumes its own range from the front
+            - A worker that runs dry steals from the back of another worker
+        This keeps all workers busy even when task costs are very uneven
+        (for example, comparison tiles over documents of skewed sizes).
+
+    Input:
+        - Number of worker threads.
+        - A task count and a callable invoked once per task index.
+
+    Output:
+        - None directly; tasks write their own results.
+
+    Side Effects:
+        - Spawns (threadCount - 1) threads per run(); the calling thread
+          acts as worker 0.
+*/
+
+class ThreadPool {
+private:
+
+    /*
+        Objective:
+            Hold the pending task indices of one worker.
+
+        Input:
+            Filled by run() before workers start.
+
+        Output:
+            None.
+
+        Side Effects:
+            The owner pops from the front, thieves pop from the back.
+    */
+    struct WorkQueue {
+        std::mutex lock;
+        std::deque<size_t> tasks;
+    };
+
+    /*
+        Objective:
+            Store the configured number of workers.
+
+        Input:
+            Provided during construction.
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    int threadCount;
+
+    /*
+        Objective:
+            Fetch the next task for a worker, stealing if necessary.
+
+        Input:
+            queues → per-worker queues.
+            worker → index of the asking worker.
+            task   → receives the task index.
+
+        Output:
+            true if a task was found, false when all queues are empty.
+
+        Side Effects:
+            Removes the returned task from its queue.
+    */
+    static bool nextTask(std::vector<WorkQueue>& queues, int worker, size_t& task);
+
+public:
+
+    /*
+        Objective:
+            Create a pool with a given number of workers.
+
+        Input:
+            threads → worker count; values < 1 select the number of
+                      hardware threads.
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    explicit ThreadPool(int threads);
+
+    /*
+        Objective:
+            Return the number of workers.
+
+        Input:
+            None.
+
+        Output:
+            Worker count (always >= 1).
+
+        Side Effects:
+            None.
+    */
+    int size() const;
+
+    /*
+        Objective:
+            Execute task(0) ... task(taskCount - 1) across all workers
+            and wait for them to finish.
+
+        Input:
+            taskCount → number of tasks.
+            task      → callable receiving (taskIndex, workerIndex).
+
+        Output:
+            None.
+
+        Side Effects:
+            Runs 'task' concurrently; it must be safe to call from
+            several threads at once.
+    */
+    void run(size_t taskCount,
+             const std::function<void(size_t, int)>& task) const;
+};
+
+#endif // THREADPOOL_H
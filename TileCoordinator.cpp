@@ -0,0 +1,358 @@
+#include "TileCoordinator.h"
+#include "TileProtocol.h"
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <iostream>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// One connected worker node
+struct WorkerNode {
+    NetChannel channel;
+    size_t id;
+    long tile;
+    Clock::time_point deadline;
+};
+
+} // namespace
+
+/*
+-------------------------------------------------
+Function Name : TileCoordinator (Constructor)
+
+Objective:
+    Store corpus identity and tiling parameters.
+
+Input:
+    documentCount → Documents of the shared index.
+    termCount     → Terms of the shared index.
+    corpusHash    → Digest of the shared index.
+    minScore      → Reporting threshold.
+    tileDocs      → Documents per tile edge.
+    timeoutSecs   → Seconds allowed per tile.
+
+Output:
+    TileCoordinator object initialized.
+
+Side Effect:
+    Clamps the tile size and timeout to their minimum.
+
+Approach:
+    Assign parameters to member variables.
+*/
+TileCoordinator::TileCoordinator(int documentCount, uint64_t termCount, uint64_t corpusHash,
+                                 double minScore, int tileDocs, int timeoutSecs)
+    : documents(documentCount), terms(termCount), digest(corpusHash),
+      threshold(minScore), tileDocuments(std::max(1, tileDocs)),
+      tileTimeout(std::max(0, timeoutSecs)) {
+}
+
+/*
+-------------------------------------------------
+Function Name : run()
+
+Objective:
+    Distribute all tiles and merge their results.
+
+Input:
+    port → TCP port to listen on.
+    sink → Result consumer.
+
+Output:
+    true if every tile was merged.
+
+Side Effect:
+    Accepts worker connections; calls the sink; prints worker events.
+
+Approach:
+    Enumerate tiles (r, c), r <= c, row block by row block. Each round
+    hands pending tiles to idle workers, waits up to a second for
+    sockets, welcomes new workers, collects results and drops workers
+    that failed or passed their deadline, putting their tile back at
+    the front of the queue. Whenever the oldest unmerged row block is
+    complete, its tiles are merged row by row: within a row, tiles are
+    visited by increasing column block, which yields increasing j.
+
+    // call waitReadable()
+    // call sendMessage() / receiveHeader()
+*/
+bool TileCoordinator::run(int port, ResultSink& sink) {
+    retries = 0;
+    workersSeen = 0;
+
+    int blocks = (documents + tileDocuments - 1) / tileDocuments;
+
+    std::vector<Tile> tiles;
+    std::vector<size_t> firstTile(blocks + 1, 0);
+    std::vector<int> remaining(blocks, 0);
+
+    for (int r = 0; r < blocks; r++) {
+        firstTile[r] = tiles.size();
+
+        for (int c = r; c < blocks; c++) {
+            tiles.push_back({r, r * tileDocuments, std::min((r + 1) * tileDocuments, documents),
+                             c * tileDocuments, std::min((c + 1) * tileDocuments, documents),
+                             0, false, {}});
+            remaining[r]++;
+        }
+    }
+    firstTile[blocks] = tiles.size();
+    tileTotal = tiles.size();
+
+    std::deque<long> pending;
+    for (size_t t = 0; t < tiles.size(); t++) {
+        pending.push_back(static_cast<long>(t));
+    }
+
+    NetListener listener;
+
+    if (!listener.listen(port)) {
+        std::cerr << "Error: Cannot listen on port " << port << ".\n";
+        return false;
+    }
+
+    std::cout << "Coordinator: " << tiles.size() << " tiles of " << tileDocuments
+              << " documents, listening on port " << port << "\n";
+
+    std::vector<WorkerNode> workers;
+    int nextRowBlock = 0;
+    bool failed = false;
+
+    // Close a worker's connection and give its tile to another one
+    auto drop = [&](WorkerNode& worker, const char* reason) {
+        std::cout << "Worker " << worker.id << " lost (" << reason << ")";
+
+        if (worker.tile >= 0) {
+            Tile& tile = tiles[worker.tile];
+
+            if (++tile.attempts >= maxAttempts) {
+                failed = true;
+            } else {
+                pending.push_front(worker.tile);
+                retries++;
+                std::cout << ", tile " << worker.tile << " requeued";
+            }
+        }
+
+        std::cout << "\n";
+        worker.channel.close();
+        worker.tile = -1;
+    };
+
+    while (nextRowBlock < blocks && !failed) {
+
+        // Hand out work
+        for (auto& worker : workers) {
+            if (!worker.channel.isOpen() || worker.tile >= 0 || pending.empty()) continue;
+
+            long t = pending.front();
+            pending.pop_front();
+
+            TileMessage message{static_cast<uint64_t>(t),
+                                static_cast<uint32_t>(tiles[t].rowBegin),
+                                static_cast<uint32_t>(tiles[t].rowEnd),
+                                static_cast<uint32_t>(tiles[t].colBegin),
+                                static_cast<uint32_t>(tiles[t].colEnd)};
+
+            worker.tile = t;
+            worker.deadline = Clock::now() + std::chrono::seconds(tileTimeout);
+
+            // call sendMessage()
+            if (!sendMessage(worker.channel, MessageType::Tile, &message, sizeof(message))) {
+                drop(worker, "send failed");
+            }
+        }
+
+        workers.erase(std::remove_if(workers.begin(), workers.end(),
+                                     [](const WorkerNode& w) { return !w.channel.isOpen(); }),
+                      workers.end());
+
+        std::vector<NetChannel::Handle> handles{listener.handle()};
+        for (const auto& worker : workers) {
+            handles.push_back(worker.channel.handle());
+        }
+
+        // call waitReadable()
+        std::vector<bool> ready = waitReadable(handles, 1000);
+
+        // Collect results
+        for (size_t w = 0; w < workers.size() && !failed; w++) {
+            WorkerNode& worker = workers[w];
+
+            if (!ready[w + 1]) {
+                if (worker.tile >= 0 && tileTimeout > 0 && Clock::now() > worker.deadline) {
+                    drop(worker, "tile timed out");
+                }
+                continue;
+            }
+
+            MessageHeader header;
+            ResultHeader result;
+
+            // call receiveHeader()
+            if (!receiveHeader(worker.channel, header)) {
+                drop(worker, "disconnected");
+                continue;
+            }
+
+            if (header.type != static_cast<uint32_t>(MessageType::Result) || worker.tile < 0 ||
+                header.length < sizeof(result) ||
+                !worker.channel.receiveAll(&result, sizeof(result)) ||
+                result.tile != static_cast<uint64_t>(worker.tile)) {
+                drop(worker, "protocol error");
+                continue;
+            }
+
+            Tile& tile = tiles[worker.tile];
+
+            // A tile has at most one record per cell; checked before the
+            // length so the product cannot wrap, and before allocating
+            uint64_t cells = static_cast<uint64_t>(tile.rowEnd - tile.rowBegin) *
+                             static_cast<uint64_t>(tile.colEnd - tile.colBegin);
+
+            if (result.pairs > cells ||
+                header.length != sizeof(result) + result.pairs * sizeof(PairRecord)) {
+                drop(worker, "protocol error");
+                continue;
+            }
+
+            std::vector<PairRecord> records(result.pairs);
+
+            if (!records.empty() &&
+                !worker.channel.receiveAll(records.data(), records.size() * sizeof(PairRecord))) {
+                drop(worker, "disconnected");
+                continue;
+            }
+
+            bool inside = std::all_of(records.begin(), records.end(), [&](const PairRecord& p) {
+                return static_cast<int64_t>(p.doc1) >= tile.rowBegin &&
+                       static_cast<int64_t>(p.doc1) < tile.rowEnd &&
+                       static_cast<int64_t>(p.doc2) >= tile.colBegin &&
+                       static_cast<int64_t>(p.doc2) < tile.colEnd && p.doc1 < p.doc2;
+            });
+
+            // Strictly increasing (doc1, doc2): i-major order, no duplicates
+            auto notAfter = [](const PairRecord& a, const PairRecord& b) {
+                return a.doc1 != b.doc1 ? a.doc1 > b.doc1 : a.doc2 >= b.doc2;
+            };
+
+            if (!inside ||
+                std::adjacent_find(records.begin(), records.end(), notAfter) != records.end()) {
+                drop(worker, "protocol error");
+                continue;
+            }
+
+            tile.pairs.reserve(records.size());
+            for (const auto& record : records) {
+                tile.pairs.push_back({static_cast<int>(record.doc1),
+                                      static_cast<int>(record.doc2), record.score});
+            }
+
+            tile.done = true;
+            remaining[tile.rowBlock]--;
+            worker.tile = -1;
+        }
+
+        // Welcome a new worker
+        if (ready[0] && !failed) {
+            NetChannel channel = listener.accept();
+            channel.setReceiveTimeout(10);
+
+            MessageHeader header;
+            HelloMessage hello;
+
+            bool accepted = receiveHeader(channel, header) &&
+                            header.type == static_cast<uint32_t>(MessageType::Hello) &&
+                            header.length == sizeof(hello) &&
+                            channel.receiveAll(&hello, sizeof(hello)) &&
+                            hello.version == tileProtocolVersion &&
+                            hello.byteOrder == tileByteOrderMark &&
+                            hello.documents == static_cast<uint64_t>(documents) &&
+                            hello.terms == terms && hello.digest == digest;
+
+            WelcomeMessage welcome{threshold};
+
+            if (accepted && sendMessage(channel, MessageType::Welcome, &welcome, sizeof(welcome))) {
+                // Results are read right after poll() reports them
+                channel.setReceiveTimeout(60);
+                workers.push_back({std::move(channel), ++workersSeen, -1, Clock::now()});
+
+                std::cout << "Worker " << workersSeen << " joined\n";
+            } else if (channel.isOpen()) {
+                sendMessage(channel, MessageType::Reject);
+                std::cout << "Worker rejected: different corpus index or protocol version\n";
+            }
+        }
+
+        // Merge every complete row block at the front
+        while (nextRowBlock < blocks && remaining[nextRowBlock] == 0) {
+            size_t begin = firstTile[nextRowBlock];
+            size_t end = firstTile[nextRowBlock + 1];
+            std::vector<size_t> cursor(end - begin, 0);
+
+            for (int i = tiles[begin].rowBegin; i < tiles[begin].rowEnd; i++) {
+                for (size_t t = begin; t < end; t++) {
+                    const std::vector<SimilarityPair>& pairs = tiles[t].pairs;
+                    size_t& at = cursor[t - begin];
+
+                    for (; at < pairs.size() && pairs[at].doc1 == i; at++) {
+                        sink.accept(pairs[at].doc1, pairs[at].doc2, pairs[at].score);
+                    }
+                }
+            }
+
+            for (size_t t = begin; t < end; t++) {
+                std::vector<SimilarityPair>().swap(tiles[t].pairs);
+            }
+
+            nextRowBlock++;
+        }
+    }
+
+    for (auto& worker : workers) {
+        if (worker.channel.isOpen()) {
+            sendMessage(worker.channel, MessageType::Bye);
+        }
+    }
+
+    if (failed) {
+        std::cerr << "Error: A tile failed on " << maxAttempts << " workers; giving up.\n";
+        return false;
+    }
+
+    return true;
+}
+
+/*
+-------------------------------------------------
+Function Name : tileCount() / retryCount() / workerCount()
+
+Objective:
+    Report the last run.
+
+Input:
+    None.
+
+Output:
+    Tiles, requeued tiles and accepted workers.
+
+Side Effect:
+    None.
+
+Approach:
+    Return the counters.
+*/
+size_t TileCoordinator::tileCount() const {
+    return tileTotal;
+}
+
+size_t TileCoordinator::retryCount() const {
+    return retries;
+}
+
+size_t TileCoordinator::workerCount() const {
+    return workersSeen;
+}
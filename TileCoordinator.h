@@ -0,0 +1,154 @@
+#ifndef TILECOORDINATOR_H
+#define TILECOORDINATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "SimilarityPair.h"
+#include "ResultSink.h"
+
+/*
+    ========================================================================
+                          CLASS : TileCoordinator
+    ========================================================================
+
+    Objective:
+        The TileCoordinator class spreads the all-pairs comparison of a
+        shared corpus index over worker nodes (TileWorker):
+            - The upper triangle of the pair matrix is cut into
+              (row block, column block) tiles of tileDocuments documents
+            - Workers connect over TCP, prove they loaded the same index
+              and are handed one tile at a time
+            - Workers send back only the pairs above the threshold
+            - A tile whose worker disconnects or times out goes back to
+              the front of the queue, so a lost node costs only its
+              current tile
+            - Row blocks are merged into the report as soon as all their
+              tiles are in, in the same i-major order as a single-node
+              run
+
+    Input:
+        - Corpus identity (document count, term count, digest).
+        - Threshold, tile size and per-tile timeout.
+
+    Output:
+        - Pairs above threshold streamed into a ResultSink.
+
+    Side Effects:
+        - Listens on a TCP port; prints worker events to stdout.
+
+    Notes:
+        The coordinator itself holds no vectors, only the results of
+        row blocks that are not complete yet.
+*/
+
+class TileCoordinator {
+private:
+
+    // One tile of the pair matrix and its results
+    struct Tile {
+        int rowBlock;
+        int rowBegin;
+        int rowEnd;
+        int colBegin;
+        int colEnd;
+        int attempts;
+        bool done;
+        std::vector<SimilarityPair> pairs;
+    };
+
+    // Workers that lose a tile this often abort the run
+    static constexpr int maxAttempts = 3;
+
+    // Corpus size and identity sent by workers
+    int documents;
+    uint64_t terms;
+    uint64_t digest;
+
+    // Reported pairs must score above it
+    double threshold;
+
+    // Documents per tile edge
+    int tileDocuments;
+
+    // Seconds a worker may spend on one tile (0 = unlimited)
+    int tileTimeout;
+
+    // Counters of the last run()
+    size_t retries = 0;
+    size_t workersSeen = 0;
+    size_t tileTotal = 0;
+
+public:
+
+    /*
+        Objective:
+            Configure a distributed comparison.
+
+        Input:
+            documentCount → documents of the shared index.
+            termCount     → terms of the shared index.
+            corpusHash    → corpusDigest() of the shared index.
+            minScore      → pairs must score above it.
+            tileDocs      → documents per tile edge (>= 1).
+            timeoutSecs   → seconds per tile before the worker is
+                            dropped (0 = unlimited).
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    TileCoordinator(int documentCount, uint64_t termCount, uint64_t corpusHash,
+                    double minScore, int tileDocs, int timeoutSecs);
+
+    /*
+        Objective:
+            Run the comparison to completion.
+
+        Input:
+            port → TCP port to listen on.
+            sink → receives every pair above threshold, in i-major order.
+
+        Output:
+            true once every tile is merged; false if the port cannot be
+            bound or a tile failed maxAttempts times.
+
+        Side Effects:
+            Accepts connections; blocks until done.
+
+        Approach:
+            - A single thread polls the listener and all worker sockets.
+            - New workers are checked (Hello) and welcomed, or rejected.
+            - Idle workers get the next pending tile; pending tiles are
+              kept in row-block order so early blocks finish first.
+            - Results complete their tile; the completed prefix of row
+              blocks is merged into the sink and freed.
+            - Disconnects, protocol errors and expired deadlines drop
+              the worker and requeue its tile.
+    */
+    bool run(int port, ResultSink& sink);
+
+    /*
+        Objective:
+            Report the last run.
+
+        Input:
+            None.
+
+        Output:
+            tileCount()   : tiles of the pair matrix.
+            retryCount()  : tiles handed out again after a failure.
+            workerCount() : workers accepted.
+
+        Side Effects:
+            None.
+    */
+    size_t tileCount() const;
+    size_t retryCount() const;
+    size_t workerCount() const;
+};
+
+#endif // TILECOORDINATOR_H
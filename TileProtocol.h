@@ -0,0 +1,191 @@
+#ifndef TILEPROTOCOL_H
+#define TILEPROTOCOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "NetChannel.h"
+#include "CorpusIndex.h"
+#include "HashUtils.h"
+
+/*
+    ========================================================================
+                            FILE : TileProtocol.h
+    ========================================================================
+
+    Objective:
+        Define the messages exchanged by TileCoordinator and TileWorker:
+            worker      -> coordinator : Hello (corpus identity)
+            coordinator -> worker      : Welcome (threshold) or Reject
+            coordinator -> worker      : Tile (document ranges), repeated
+            worker      -> coordinator : Result (pairs above threshold)
+            coordinator -> worker      : Bye, once every tile is done
+
+    Input:
+        - None.
+
+    Output:
+        - Fixed-layout message structs and framing helpers.
+
+    Side Effects:
+        - None.
+
+    Notes:
+        Every message is a MessageHeader followed by 'length' payload
+        bytes, in host byte order; Hello carries a byte-order mark so
+        nodes of different endianness refuse each other.
+*/
+
+// Start of every message header
+constexpr uint32_t tileProtocolMagic = 0x544C4750; // "PGLT"
+
+// Bumped whenever a message layout changes
+constexpr uint32_t tileProtocolVersion = 1;
+
+// Read back as a different value on a host with the other byte order
+constexpr uint32_t tileByteOrderMark = 0x01020304;
+
+// Largest payload a node accepts (guards against garbage lengths)
+constexpr uint64_t maxMessageBytes = 1ULL << 34;
+
+enum class MessageType : uint32_t {
+    Hello = 1,
+    Welcome = 2,
+    Reject = 3,
+    Tile = 4,
+    Result = 5,
+    Bye = 6
+};
+
+struct MessageHeader {
+    uint32_t magic;
+    uint32_t type;
+    uint64_t length;
+};
+
+// Identity of the corpus a worker has loaded
+struct HelloMessage {
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t documents;
+    uint64_t terms;
+    uint64_t digest;
+};
+
+struct WelcomeMessage {
+    double threshold;
+};
+
+// Pairs (i, j), i in [rowBegin, rowEnd), j in [colBegin, colEnd), i < j
+struct TileMessage {
+    uint64_t tile;
+    uint32_t rowBegin;
+    uint32_t rowEnd;
+    uint32_t colBegin;
+    uint32_t colEnd;
+};
+
+// Followed by 'pairs' PairRecords (at most one per tile cell) in strictly
+// increasing (doc1, doc2) order; the coordinator drops workers that break this
+struct ResultHeader {
+    uint64_t tile;
+    uint64_t pairs;
+};
+
+struct PairRecord {
+    uint32_t doc1;
+    uint32_t doc2;
+    double score;
+};
+
+/*
+    Objective:
+        Send one message.
+
+    Input:
+        channel      → connection.
+        type         → message type.
+        payload      → fixed part of the payload (may be nullptr).
+        payloadBytes → its size.
+        extra        → variable part appended after it (may be nullptr).
+        extraBytes   → its size.
+
+    Output:
+        true if the whole message was sent.
+
+    Side Effects:
+        Closes the channel on failure.
+*/
+inline bool sendMessage(NetChannel& channel, MessageType type,
+                        const void* payload = nullptr, size_t payloadBytes = 0,
+                        const void* extra = nullptr, size_t extraBytes = 0) {
+    MessageHeader header{tileProtocolMagic, static_cast<uint32_t>(type),
+                         static_cast<uint64_t>(payloadBytes + extraBytes)};
+
+    return channel.sendAll(&header, sizeof(header)) &&
+           (payloadBytes == 0 || channel.sendAll(payload, payloadBytes)) &&
+           (extraBytes == 0 || channel.sendAll(extra, extraBytes));
+}
+
+/*
+    Objective:
+        Receive and check a message header.
+
+    Input:
+        channel → connection.
+        header  → filled with the received header.
+
+    Output:
+        true for a well-formed header.
+
+    Side Effects:
+        Closes the channel on a malformed header or a failed receive.
+*/
+inline bool receiveHeader(NetChannel& channel, MessageHeader& header) {
+    if (!channel.receiveAll(&header, sizeof(header))) {
+        return false;
+    }
+
+    if (header.magic != tileProtocolMagic || header.length > maxMessageBytes) {
+        channel.close();
+        return false;
+    }
+
+    return true;
+}
+
+/*
+    Objective:
+        Identify a loaded corpus index, so a worker holding a different
+        snapshot is refused.
+
+    Input:
+        index → loaded corpus index.
+
+    Output:
+        Hash of the document names, lengths and stored norms.
+
+    Side Effects:
+        None.
+*/
+inline uint64_t corpusDigest(const CorpusIndex& index) {
+    uint64_t digest = combineHash(index.documentCount(), index.termCount());
+
+    for (size_t d = 0; d < index.documentCount(); d++) {
+        for (char c : index.documentName(d)) {
+            digest = combineHash(digest, static_cast<unsigned char>(c));
+        }
+
+        double norm = index.norm(d);
+        uint64_t normBits = 0;
+        std::memcpy(&normBits, &norm, sizeof(normBits));
+
+        digest = combineHash(digest, static_cast<uint64_t>(index.documentLength(d)));
+        digest = combineHash(digest, normBits);
+    }
+
+    return digest;
+}
+
+#endif // TILEPROTOCOL_H
@@ -0,0 +1,163 @@
+#include "TileWorker.h"
+#include "TileProtocol.h"
+#include "SimilarityChecker.h"
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+/*
+-------------------------------------------------
+Function Name : TileWorker (Constructor)
+
+Objective:
+    Store the checker, corpus identity and thread count.
+
+Input:
+    similarity → Checker over the shared index.
+    termCount  → Terms of the shared index.
+    corpusHash → Digest of the shared index.
+    threads    → Threads per tile.
+
+Output:
+    TileWorker object initialized.
+
+Side Effect:
+    None.
+
+Approach:
+    Assign parameters to member variables.
+*/
+TileWorker::TileWorker(const SimilarityChecker& similarity, uint64_t termCount,
+                       uint64_t corpusHash, int threads)
+    : checker(similarity), terms(termCount), digest(corpusHash), threadCount(threads) {
+}
+
+/*
+-------------------------------------------------
+Function Name : run()
+
+Objective:
+    Connect to a coordinator and score tiles until told to stop.
+
+Input:
+    host         → Coordinator host.
+    port         → Coordinator port.
+    connectTries → Connection attempts.
+
+Output:
+    true if the session ended with Bye.
+
+Side Effect:
+    Network I/O; prints connection events.
+
+Approach:
+    Retry the connection once a second, introduce the corpus, then
+    loop: receive a Tile, check its ranges, score it and reply with
+    the pairs above the welcome threshold.
+
+    // call sendMessage() / receiveHeader()
+    // call SimilarityChecker::compareTile()
+*/
+bool TileWorker::run(const std::string& host, int port, int connectTries) {
+    tilesDone = 0;
+
+    NetChannel channel;
+
+    for (int attempt = 0; attempt < connectTries && !channel.isOpen(); attempt++) {
+        if (attempt > 0) {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+        channel = NetChannel::connectTo(host, port);
+    }
+
+    if (!channel.isOpen()) {
+        std::cerr << "Error: Cannot connect to coordinator " << host << ":" << port << ".\n";
+        return false;
+    }
+
+    HelloMessage hello{tileProtocolVersion, tileByteOrderMark,
+                       static_cast<uint64_t>(checker.documentCount()), terms, digest};
+
+    MessageHeader header;
+    WelcomeMessage welcome;
+
+    // call sendMessage() / receiveHeader()
+    if (!sendMessage(channel, MessageType::Hello, &hello, sizeof(hello)) ||
+        !receiveHeader(channel, header) ||
+        header.type != static_cast<uint32_t>(MessageType::Welcome) ||
+        header.length != sizeof(welcome) ||
+        !channel.receiveAll(&welcome, sizeof(welcome))) {
+        std::cerr << "Error: Coordinator refused this worker (different corpus index?).\n";
+        return false;
+    }
+
+    std::cout << "Connected to coordinator " << host << ":" << port << "\n";
+
+    std::vector<PairRecord> records;
+    int documents = checker.documentCount();
+
+    while (receiveHeader(channel, header)) {
+        if (header.type == static_cast<uint32_t>(MessageType::Bye)) {
+            std::cout << "Coordinator finished; tiles scored: " << tilesDone << "\n";
+            return true;
+        }
+
+        TileMessage tile;
+
+        if (header.type != static_cast<uint32_t>(MessageType::Tile) ||
+            header.length != sizeof(tile) || !channel.receiveAll(&tile, sizeof(tile)) ||
+            tile.rowBegin > tile.rowEnd || tile.rowEnd > static_cast<uint32_t>(documents) ||
+            tile.colBegin > tile.colEnd || tile.colEnd > static_cast<uint32_t>(documents)) {
+            break;
+        }
+
+        // call SimilarityChecker::compareTile()
+        std::vector<SimilarityPair> pairs = checker.compareTile(
+            static_cast<int>(tile.rowBegin), static_cast<int>(tile.rowEnd),
+            static_cast<int>(tile.colBegin), static_cast<int>(tile.colEnd),
+            welcome.threshold, threadCount);
+
+        records.clear();
+        records.reserve(pairs.size());
+        for (const auto& pair : pairs) {
+            records.push_back({static_cast<uint32_t>(pair.doc1),
+                               static_cast<uint32_t>(pair.doc2), pair.score});
+        }
+
+        ResultHeader result{tile.tile, records.size()};
+
+        if (!sendMessage(channel, MessageType::Result, &result, sizeof(result),
+                         records.data(), records.size() * sizeof(PairRecord))) {
+            break;
+        }
+
+        tilesDone++;
+    }
+
+    std::cerr << "Error: Lost the connection to the coordinator.\n";
+    return false;
+}
+
+/*
+-------------------------------------------------
+Function Name : tileCount()
+
+Objective:
+    Report the last session.
+
+Input:
+    None.
+
+Output:
+    Tiles scored.
+
+Side Effect:
+    None.
+
+Approach:
+    Return the counter.
+*/
+size_t TileWorker::tileCount() const {
+    return tilesDone;
+}
@@ -0,0 +1,109 @@
+#ifndef TILEWORKER_H
+#define TILEWORKER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class SimilarityChecker;
+
+/*
+    ========================================================================
+                            CLASS : TileWorker
+    ========================================================================
+
+    Objective:
+        The TileWorker class is the compute side of a distributed
+        comparison: it connects to a TileCoordinator, scores the tiles
+        it is handed with SimilarityChecker::compareTile() and sends
+        back only the pairs above the coordinator's threshold.
+
+    Input:
+        - A SimilarityChecker built from the shared corpus index.
+        - The identity of that index and a thread count.
+
+    Output:
+        - Result messages to the coordinator.
+
+    Side Effects:
+        - Opens a TCP connection; prints connection events to stdout.
+*/
+
+class TileWorker {
+private:
+
+    // Vectors of the shared corpus index
+    const SimilarityChecker& checker;
+
+    // Identity sent in the Hello message
+    uint64_t terms;
+    uint64_t digest;
+
+    // Threads per tile
+    int threadCount;
+
+    // Tiles completed by the last run()
+    size_t tilesDone = 0;
+
+public:
+
+    /*
+        Objective:
+            Configure a worker.
+
+        Input:
+            similarity → checker over the shared index; must outlive
+                         run().
+            termCount  → terms of the shared index.
+            corpusHash → corpusDigest() of the shared index.
+            threads    → threads scoring each tile (0 = all cores).
+
+        Output:
+            None.
+
+        Side Effects:
+            None.
+    */
+    TileWorker(const SimilarityChecker& similarity, uint64_t termCount, uint64_t corpusHash,
+               int threads);
+
+    /*
+        Objective:
+            Serve one coordinator until it has no work left.
+
+        Input:
+            host         → coordinator host.
+            port         → coordinator port.
+            connectTries → connection attempts, one second apart, so
+                           workers may start before the coordinator.
+
+        Output:
+            true if the coordinator ended the session with Bye; false if
+            it could not be reached, refused the corpus or went away.
+
+        Side Effects:
+            Blocks for the whole session.
+
+        Approach:
+            Send Hello, wait for Welcome, then answer every Tile with a
+            Result until Bye arrives.
+    */
+    bool run(const std::string& host, int port, int connectTries = 30);
+
+    /*
+        Objective:
+            Report the last session.
+
+        Input:
+            None.
+
+        Output:
+            Number of tiles scored and sent.
+
+        Side Effects:
+            None.
+    */
+    size_t tileCount() const;
+};
+
+#endif // TILEWORKER_H
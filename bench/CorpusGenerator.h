@@ -0,0 +1,381 @@
+#ifndef CORPUSGENERATOR_H
+#define CORPUSGENERATOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "HashUtils.h"
+
+/*
+    ========================================================================
+                          STRUCT : CorpusOptions
+    ========================================================================
+
+    Objective:
+        Describe the shape of a synthetic corpus.
+
+    Input:
+        - documents     : number of documents.
+        - length        : mean tokens per document (actual lengths vary
+                          uniformly by +/- 20%).
+        - vocabulary    : number of distinct words.
+        - zipf          : Zipf exponent s; word of rank r is drawn with
+                          probability proportional to 1 / r^s.
+        - duplicateRate : fraction of documents planted as near-duplicates
+                          of an earlier original document.
+        - editRate      : fraction of a near-duplicate's tokens replaced
+                          by fresh draws.
+        - seed          : generator seed; equal options give equal corpora
+                          on every platform.
+
+    Output:
+        None (plain data holder).
+
+    Side Effects:
+        None.
+*/
+struct CorpusOptions {
+    size_t documents = 1000;
+    size_t length = 400;
+    size_t vocabulary = 20000;
+    double zipf = 1.1;
+    double duplicateRate = 0.05;
+    double editRate = 0.10;
+    uint64_t seed = 42;
+};
+
+/*
+    ========================================================================
+                          CLASS : CorpusGenerator
+    ========================================================================
+
+    Objective:
+        Produce deterministic synthetic documents for benchmarks:
+            - Zipf-distributed words over a pseudo-word vocabulary
+            - sentences with capitalization and punctuation, so the text
+              cleaner does real work
+            - planted near-duplicate pairs with a known edit rate
+
+    Input:
+        - CorpusOptions.
+
+    Output:
+        - Document texts by index, and the list of planted pairs.
+
+    Side Effects:
+        - None. Every document is derived from its own seed, so documents
+          can be generated in any order without keeping earlier ones.
+
+    Notes:
+        - Random numbers come from HashUtils mixing instead of <random>
+          distributions, whose output differs between standard libraries.
+*/
+class CorpusGenerator {
+private:
+
+    // Generation parameters
+    CorpusOptions options;
+
+    // Cumulative Zipf probabilities by word rank
+    std::vector<double> cumulative;
+
+    // Counter-based random stream
+    struct Stream {
+        uint64_t state;
+
+        uint64_t next() {
+            state = mixHash(state);
+            return state;
+        }
+
+        // Uniform double in [0, 1)
+        double unit() {
+            return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0);
+        }
+    };
+
+    // Independent stream for (document, purpose)
+    Stream streamFor(size_t index, uint64_t purpose) const {
+        return Stream{combineHash(combineHash(options.seed, purpose), index)};
+    }
+
+    // Draw a word rank from the Zipf distribution
+    uint32_t drawRank(Stream& stream) const {
+        double u = stream.unit() * cumulative.back();
+        auto it = std::upper_bound(cumulative.begin(), cumulative.end(), u);
+        size_t rank = static_cast<size_t>(it - cumulative.begin());
+        return static_cast<uint32_t>(std::min(rank, cumulative.size() - 1));
+    }
+
+    // Tokens of an original document
+    std::vector<uint32_t> originalTokens(size_t index) const {
+        Stream stream = streamFor(index, 1);
+
+        double scale = 0.8 + 0.4 * stream.unit();
+        size_t count = std::max<size_t>(1, static_cast<size_t>(options.length * scale));
+
+        std::vector<uint32_t> tokens(count);
+        for (auto& token : tokens) {
+            token = drawRank(stream);
+        }
+        return tokens;
+    }
+
+public:
+
+    /*
+        Objective:
+            Prepare the Zipf table.
+
+        Input:
+            corpusOptions → corpus shape.
+
+        Output:
+            None.
+
+        Side Effects:
+            Allocates one double per vocabulary word.
+    */
+    explicit CorpusGenerator(const CorpusOptions& corpusOptions)
+        : options(corpusOptions) {
+
+        options.vocabulary = std::max<size_t>(1, options.vocabulary);
+        cumulative.resize(options.vocabulary);
+
+        double sum = 0.0;
+        for (size_t r = 0; r < options.vocabulary; r++) {
+            sum += 1.0 / std::pow(static_cast<double>(r + 1), options.zipf);
+            cumulative[r] = sum;
+        }
+    }
+
+    /*
+        Objective:
+            Spell the word of a rank.
+
+        Input:
+            rank → word rank (0 = most frequent).
+
+        Output:
+            Lowercase pseudo-word of two or more consonant-vowel
+            syllables; distinct ranks give distinct words.
+
+        Side Effects:
+            None.
+    */
+    static std::string word(uint32_t rank) {
+        static const char consonants[] = "bcdfghjklmnprstvwxyz";
+        static const char vowels[] = "aeiou";
+
+        std::string text;
+        uint32_t rest = rank;
+
+        auto syllable = [&](uint32_t digit) {
+            text += consonants[digit / 5];
+            text += vowels[digit % 5];
+        };
+
+        // Base-100 digits, at least two, so words are 4+ letters
+        syllable(rest % 100);
+        rest /= 100;
+        do {
+            syllable(rest % 100);
+            rest /= 100;
+        } while (rest > 0);
+
+        return text;
+    }
+
+    /*
+        Objective:
+            Tell whether a document is a planted near-duplicate.
+
+        Input:
+            index → document index.
+
+        Output:
+            true if the document copies an earlier original.
+
+        Side Effects:
+            None.
+    */
+    bool isDuplicate(size_t index) const {
+        return index > 0 && streamFor(index, 2).unit() < options.duplicateRate;
+    }
+
+    /*
+        Objective:
+            Find the original a near-duplicate was copied from.
+
+        Input:
+            index → index of a duplicate document.
+
+        Output:
+            Index of an earlier original document.
+
+        Side Effects:
+            None.
+    */
+    size_t sourceOf(size_t index) const {
+        size_t source = static_cast<size_t>(streamFor(index, 3).next() % index);
+        while (isDuplicate(source)) {
+            source--;
+        }
+        return source;
+    }
+
+    /*
+        Objective:
+            Produce the word ranks of a document.
+
+        Input:
+            index → document index.
+
+        Output:
+            Token ranks; a near-duplicate is its source with editRate of
+            the tokens redrawn.
+
+        Side Effects:
+            None.
+    */
+    std::vector<uint32_t> tokens(size_t index) const {
+        if (!isDuplicate(index)) {
+            return originalTokens(index);
+        }
+
+        std::vector<uint32_t> copied = originalTokens(sourceOf(index));
+        Stream stream = streamFor(index, 4);
+
+        for (auto& token : copied) {
+            if (stream.unit() < options.editRate) {
+                token = drawRank(stream);
+            }
+        }
+        return copied;
+    }
+
+    /*
+        Objective:
+            Render a document as text.
+
+        Input:
+            index → document index.
+
+        Output:
+            Sentences of 8-20 words, capitalized and ended with a
+            period, with a line break every few sentences.
+
+        Side Effects:
+            None.
+    */
+    std::string text(size_t index) const {
+        std::vector<uint32_t> ranks = tokens(index);
+        Stream stream = streamFor(index, 5);
+
+        std::string out;
+        out.reserve(ranks.size() * 8);
+
+        size_t sentenceLeft = 0;
+        size_t sentences = 0;
+
+        for (size_t t = 0; t < ranks.size(); t++) {
+            std::string next = word(ranks[t]);
+
+            if (sentenceLeft == 0) {
+                sentenceLeft = 8 + stream.next() % 13;
+                next[0] = static_cast<char>(next[0] - 'a' + 'A');
+            }
+
+            out += next;
+            sentenceLeft--;
+
+            if (sentenceLeft == 0 || t + 1 == ranks.size()) {
+                out += '.';
+                out += (++sentences % 4 == 0) ? '\n' : ' ';
+            } else {
+                out += ' ';
+            }
+        }
+
+        return out;
+    }
+
+    /*
+        Objective:
+            List the planted near-duplicate pairs.
+
+        Input:
+            None.
+
+        Output:
+            (source, duplicate) pairs in increasing duplicate order.
+
+        Side Effects:
+            None.
+    */
+    std::vector<std::pair<size_t, size_t>> plantedPairs() const {
+        std::vector<std::pair<size_t, size_t>> pairs;
+
+        for (size_t d = 0; d < options.documents; d++) {
+            if (isDuplicate(d)) {
+                pairs.push_back({sourceOf(d), d});
+            }
+        }
+        return pairs;
+    }
+
+    /*
+        Objective:
+            Return the options the generator was built with.
+
+        Input:
+            None.
+
+        Output:
+            Corpus options (vocabulary clamped to at least 1).
+
+        Side Effects:
+            None.
+    */
+    const CorpusOptions& getOptions() const {
+        return options;
+    }
+};
+
+/*
+    Objective:
+        Apply one command-line corpus option.
+
+    Input:
+        flag    → option name (--docs, --length, --vocab, --zipf,
+                  --dup-rate, --edit-rate or --seed).
+        value   → option value.
+        options → options to update.
+
+    Output:
+        true if the flag is a corpus option.
+
+    Side Effects:
+        Throws std::invalid_argument / std::out_of_range on a malformed
+        value.
+*/
+inline bool parseCorpusOption(const std::string& flag, const std::string& value,
+                              CorpusOptions& options) {
+    if (flag == "--docs")           options.documents = std::stoul(value);
+    else if (flag == "--length")    options.length = std::stoul(value);
+    else if (flag == "--vocab")     options.vocabulary = std::stoul(value);
+    else if (flag == "--zipf")      options.zipf = std::stod(value);
+    else if (flag == "--dup-rate")  options.duplicateRate = std::stod(value);
+    else if (flag == "--edit-rate") options.editRate = std::stod(value);
+    else if (flag == "--seed")      options.seed = std::stoull(value);
+    else return false;
+
+    return true;
+}
+
+#endif // CORPUSGENERATOR_H
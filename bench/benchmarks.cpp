@@ -0,0 +1,563 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "CorpusGenerator.h"
+#include "TextCleaner.h"
+#include "TermDictionary.h"
+#include "FeatureExtractor.h"
+#include "SimilarityChecker.h"
+#include "ReportWriter.h"
+#include "HashUtils.h"
+
+/*
+    ========================================================================
+                     PROGRAM : Micro-benchmark runner
+    ========================================================================
+
+    Objective:
+        Time the hot stages of the checker on a deterministic synthetic
+        corpus and emit results in a stable, comparable format:
+            text_cleaner.preprocess           bytes cleaned and interned
+            text_cleaner.preprocess_hashed    bytes cleaned and feature-hashed
+            feature_extractor.build_index     inverted index (DF and postings)
+                                              build, one thread
+            feature_extractor.compute_idf     IDF refresh from the index
+            feature_extractor.compute_tfidf   IDF + TF-IDF vectors
+            similarity_checker.cosine         cosineSimilarity() on
+                                              random pairs (dotProduct)
+            similarity_checker.compare_all    serial all-pairs loop
+            similarity_checker.compare_all_blocked / _dense
+                                              batch engines, one thread
+            report_writer.write_csv / write_binary
+                                              report sinks
+
+    Input:
+        Command-line options:
+            corpus shape   --docs --length --vocab --zipf --dup-rate
+                           --edit-rate --seed (see CorpusGenerator.h)
+            --repeat N     timed repetitions per benchmark (default 5)
+            --filter TEXT  run only benchmarks whose name contains TEXT
+            --out PATH     write results as TSV
+            --baseline PATH
+                           compare medians with an earlier --out file
+            --max-regression PCT
+                           with --baseline, fail if any median is more
+                           than PCT percent slower
+            --help         print the options and exit
+
+    Output:
+        A results table on stdout; TSV and comparison on request.
+        Exit status 1 on a regression beyond --max-regression.
+
+    Side Effects:
+        Writes temporary report files in the working directory.
+*/
+
+namespace {
+
+// One measured benchmark
+struct BenchResult {
+    std::string name;
+    size_t items = 0;
+    std::string unit;
+    double medianMs = 0.0;
+    double minMs = 0.0;
+};
+
+// Discards writes, to silence report messages while timing
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+};
+
+// Accepts pairs without doing anything
+class NullSink : public ResultSink {
+public:
+    double checksum = 0.0;
+
+    void accept(int, int, double score) override {
+        checksum += score;
+    }
+};
+
+/*
+-------------------------------------------------
+Function Name : measure()
+
+Objective:
+    Time a benchmark body.
+
+Input:
+    name    → Benchmark name.
+    unit    → Unit of 'items'.
+    items   → Work items processed by one run of the body.
+    repeats → Timed runs.
+    setup   → Untimed preparation before every run (may be empty).
+    body    → Code to time.
+
+Output:
+    Median and minimum run time.
+
+Side Effect:
+    Runs setup and body 'repeats' times.
+
+Approach:
+    One untimed warm-up run, then time each repetition with the
+    steady clock and sort the samples.
+*/
+BenchResult measure(const std::string& name, const std::string& unit, size_t items,
+                    int repeats, const std::function<void()>& setup,
+                    const std::function<void()>& body) {
+
+    std::vector<double> samples;
+
+    for (int r = -1; r < repeats; r++) {
+        if (setup) {
+            setup();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto end = std::chrono::steady_clock::now();
+
+        if (r >= 0) {
+            samples.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        }
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    BenchResult result;
+    result.name = name;
+    result.items = items;
+    result.unit = unit;
+    result.medianMs = samples[samples.size() / 2];
+    result.minMs = samples.front();
+    return result;
+}
+
+/*
+-------------------------------------------------
+Function Name : loadBaseline()
+
+Objective:
+    Read medians of an earlier run.
+
+Input:
+    path   → TSV written with --out.
+    header → Receives the corpus description line.
+
+Output:
+    Median milliseconds by benchmark name (empty if unreadable).
+
+Side Effect:
+    None.
+
+Approach:
+    Skip '#' lines except the corpus line, and the column header;
+    split the rest on tabs.
+*/
+std::map<std::string, double> loadBaseline(const std::string& path, std::string& header) {
+    std::map<std::string, double> medians;
+    std::ifstream file(path);
+    std::string line;
+
+    while (std::getline(file, line)) {
+        if (line.rfind("# corpus", 0) == 0) {
+            header = line;
+            continue;
+        }
+        if (line.empty() || line[0] == '#' || line.rfind("benchmark\t", 0) == 0) {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        std::string name, items, unit, median;
+        std::getline(fields, name, '\t');
+        std::getline(fields, items, '\t');
+        std::getline(fields, unit, '\t');
+        std::getline(fields, median, '\t');
+
+        try {
+            medians[name] = std::stod(median);
+        } catch (...) {}
+    }
+
+    return medians;
+}
+
+/*
+-------------------------------------------------
+Function Name : printUsage()
+
+Objective:
+    Describe the command-line options.
+
+Input:
+    out → Stream to print to.
+
+Output:
+    None.
+
+Side Effect:
+    Prints the usage text.
+
+Approach:
+    One line per option, as in the program header.
+*/
+void printUsage(std::ostream& out) {
+    out << "Usage: run_benchmarks [--docs N] [--length N] [--vocab N] [--zipf S]\n"
+        << "                      [--dup-rate R] [--edit-rate R] [--seed N]\n"
+        << "                      [--repeat N] [--filter TEXT] [--out PATH]\n"
+        << "                      [--baseline PATH] [--max-regression PCT]\n"
+        << "\n"
+        << "  --repeat N            timed repetitions per benchmark (default 5)\n"
+        << "  --filter TEXT         run only benchmarks whose name contains TEXT\n"
+        << "  --out PATH            write results as TSV\n"
+        << "  --baseline PATH       compare medians with an earlier --out file\n"
+        << "  --max-regression PCT  with --baseline, fail if any median is more\n"
+        << "                        than PCT percent slower\n";
+}
+
+} // namespace
+
+/*
+-------------------------------------------------
+Function Name : main()
+
+Objective:
+    Run the micro-benchmarks.
+
+Input:
+    Command-line options (see the program header).
+
+Output:
+    Exit status 0, or 1 on bad options or a regression.
+
+Side Effect:
+    Prints results; writes TSV and temporary report files.
+
+Approach:
+    Generate the corpus in memory, prepare the inputs of every stage
+    once, then measure each stage in pipeline order.
+
+    // call printUsage()
+    // call CorpusGenerator()
+    // call measure()
+*/
+int main(int argc, char* argv[]) {
+
+    CorpusOptions options;
+    int repeats = 5;
+    std::string filter;
+    std::string outPath;
+    std::string baselinePath;
+    double maxRegression = -1.0;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+
+        if (arg == "--help") {
+            printUsage(std::cout);
+            return 0;
+        }
+
+        if (i + 1 >= argc) {
+            std::cerr << "Error: Missing value for " << arg << ".\n";
+            return 1;
+        }
+
+        std::string value = argv[++i];
+
+        try {
+            if (parseCorpusOption(arg, value, options)) continue;
+            else if (arg == "--repeat") repeats = std::max(1, std::stoi(value));
+            else if (arg == "--filter") filter = value;
+            else if (arg == "--out") outPath = value;
+            else if (arg == "--baseline") baselinePath = value;
+            else if (arg == "--max-regression") maxRegression = std::stod(value);
+            else {
+                std::cerr << "Error: Unknown option " << arg << ".\n";
+                return 1;
+            }
+        } catch (...) {
+            std::cerr << "Error: Invalid value for " << arg << ".\n";
+            return 1;
+        }
+    }
+
+    auto enabled = [&](const std::string& name) {
+        return filter.empty() || name.find(filter) != std::string::npos;
+    };
+
+    // ---------------- CORPUS ----------------
+    // call CorpusGenerator()
+    CorpusGenerator generator(options);
+
+    std::vector<std::string> texts;
+    std::vector<std::string> names;
+    size_t totalBytes = 0;
+
+    for (size_t d = 0; d < options.documents; d++) {
+        texts.push_back(generator.text(d));
+        names.push_back("doc" + std::to_string(d) + ".txt");
+        totalBytes += texts.back().size();
+    }
+
+    std::ostringstream corpusLine;
+    corpusLine << "# corpus docs=" << options.documents << " length=" << options.length
+               << " vocab=" << options.vocabulary << " zipf=" << options.zipf
+               << " dup-rate=" << options.duplicateRate << " edit-rate=" << options.editRate
+               << " seed=" << options.seed;
+
+    std::cout << corpusLine.str() << " bytes=" << totalBytes << "\n";
+
+    std::vector<BenchResult> results;
+
+    // Shared stage inputs, built untimed
+    TextCleaner cleaner;
+    TermDictionary dictionary;
+    std::vector<std::vector<uint32_t>> tokens;
+
+    for (const auto& text : texts) {
+        tokens.push_back(cleaner.preprocess(std::string_view(text), dictionary));
+    }
+
+    // ---------------- TEXT CLEANER ----------------
+    if (enabled("text_cleaner.preprocess")) {
+        std::unique_ptr<TermDictionary> scratch;
+
+        results.push_back(measure("text_cleaner.preprocess", "bytes", totalBytes, repeats,
+            [&] { scratch = std::make_unique<TermDictionary>(); },
+            [&] {
+                for (const auto& text : texts) {
+                    cleaner.preprocess(std::string_view(text), *scratch);
+                }
+            }));
+    }
+
+    if (enabled("text_cleaner.preprocess_hashed")) {
+        FeatureHasher hasher(18);
+
+        results.push_back(measure("text_cleaner.preprocess_hashed", "bytes", totalBytes, repeats,
+            nullptr,
+            [&] {
+                for (const auto& text : texts) {
+                    cleaner.preprocess(std::string_view(text), hasher);
+                }
+            }));
+    }
+
+    // ---------------- FEATURE EXTRACTOR ----------------
+    std::unique_ptr<FeatureExtractor> extractor;
+    auto freshExtractor = [&] {
+        extractor = std::make_unique<FeatureExtractor>(tokens, dictionary);
+    };
+
+    if (enabled("feature_extractor.build_index")) {
+        results.push_back(measure("feature_extractor.build_index", "documents", tokens.size(),
+            repeats, [&] { extractor.reset(); }, freshExtractor));
+    }
+
+    if (enabled("feature_extractor.compute_idf")) {
+        results.push_back(measure("feature_extractor.compute_idf", "terms", dictionary.size(),
+            repeats, freshExtractor, [&] { extractor->getIDF(); }));
+    }
+
+    if (enabled("feature_extractor.compute_tfidf")) {
+        results.push_back(measure("feature_extractor.compute_tfidf", "documents", tokens.size(),
+            repeats, freshExtractor, [&] { extractor->computeTFIDF(); }));
+    }
+
+    freshExtractor();
+    extractor->computeTFIDF();
+
+    size_t activeTerms = extractor->getActiveTermCount();
+    double density = extractor->getDensity();
+
+    SimilarityChecker checker(extractor->takeTFIDFVectors(), names);
+    int numDocs = checker.documentCount();
+    size_t pairCount = (numDocs < 2) ? 0 : static_cast<size_t>(numDocs) * (numDocs - 1) / 2;
+
+    // ---------------- SIMILARITY CHECKER ----------------
+    if (enabled("similarity_checker.cosine") && numDocs > 1) {
+        std::vector<std::pair<int, int>> pairs(200000);
+        uint64_t state = options.seed;
+
+        for (auto& pair : pairs) {
+            state = mixHash(state);
+            pair.first = static_cast<int>(state % numDocs);
+            pair.second = static_cast<int>((state >> 32) % numDocs);
+        }
+
+        // Summed so the calls cannot be optimized away
+        volatile double checksum = 0.0;
+        results.push_back(measure("similarity_checker.cosine", "pairs", pairs.size(), repeats,
+            nullptr,
+            [&] {
+                double sum = 0.0;
+                for (const auto& pair : pairs) {
+                    sum += checker.cosineSimilarity(pair.first, pair.second);
+                }
+                checksum = sum;
+            }));
+    }
+
+    NullSink sink;
+
+    if (enabled("similarity_checker.compare_all")) {
+        results.push_back(measure("similarity_checker.compare_all", "pairs", pairCount, repeats,
+            nullptr, [&] { checker.compareAll(sink); }));
+    }
+
+    // Threshold of the report_writer benchmarks
+    if (enabled("similarity_checker.compare_all_above")) {
+        results.push_back(measure("similarity_checker.compare_all_above", "pairs", pairCount,
+            repeats, nullptr, [&] { checker.compareAllAbove(0.7, 1, sink); }));
+    }
+
+    if (enabled("similarity_checker.compare_all_blocked")) {
+        results.push_back(measure("similarity_checker.compare_all_blocked", "pairs", pairCount,
+            repeats, nullptr, [&] { checker.compareAllBlocked(1, sink); }));
+    }
+
+    // Skipped where the engine would refuse the corpus shape
+    if (enabled("similarity_checker.compare_all_dense") &&
+        SimilarityChecker::shouldUseDense(numDocs, activeTerms, density)) {
+        results.push_back(measure("similarity_checker.compare_all_dense", "pairs", pairCount,
+            repeats, nullptr, [&] { checker.compareAllDense(1, sink); }));
+    }
+
+    // ---------------- REPORT WRITER ----------------
+    if (enabled("report_writer")) {
+        std::vector<SimilarityPair> pairs;
+        pairs.reserve(pairCount);
+
+        for (int i = 0; i < numDocs; i++) {
+            for (int j = i + 1; j < numDocs; j++) {
+                pairs.push_back({i, j, checker.cosineSimilarity(i, j)});
+            }
+        }
+
+        // Report messages would interleave with the table; old files are
+        // removed before each run so truncation is not timed
+        NullBuffer nullBuffer;
+        std::streambuf* console = std::cout.rdbuf();
+
+        const std::string csvPath = "bench_report.tmp.csv";
+        const std::string binaryPath = "bench_report.tmp.bin";
+
+        if (enabled("report_writer.write_csv")) {
+            ReportWriter writer(csvPath, 0.7);
+            results.push_back(measure("report_writer.write_csv", "rows", pairs.size(), repeats,
+                [&] { std::remove(csvPath.c_str()); },
+                [&] {
+                    std::cout.rdbuf(&nullBuffer);
+                    writer.writeCSV(pairs, names);
+                    std::cout.rdbuf(console);
+                }));
+        }
+
+        if (enabled("report_writer.write_binary")) {
+            results.push_back(measure("report_writer.write_binary", "rows", pairs.size(), repeats,
+                [&] { std::remove(binaryPath.c_str()); },
+                [&] {
+                    std::cout.rdbuf(&nullBuffer);
+                    {
+                        BinaryResultSink sink(binaryPath, names, 0.7);
+                        for (const auto& pair : pairs) {
+                            sink.accept(pair.doc1, pair.doc2, pair.score);
+                        }
+                    }
+                    std::cout.rdbuf(console);
+                }));
+        }
+
+        std::remove(csvPath.c_str());
+        std::remove(binaryPath.c_str());
+    }
+
+    // ---------------- RESULTS ----------------
+    std::string baselineHeader;
+    std::map<std::string, double> baseline;
+
+    if (!baselinePath.empty()) {
+        baseline = loadBaseline(baselinePath, baselineHeader);
+
+        if (baseline.empty()) {
+            std::cerr << "Error: Cannot read baseline " << baselinePath << ".\n";
+            return 1;
+        }
+        if (baselineHeader != corpusLine.str()) {
+            std::cout << "Warning: baseline was measured on a different corpus:\n  "
+                      << baselineHeader << "\n";
+        }
+    }
+
+    std::cout << std::left << std::setw(42) << "benchmark" << std::right
+              << std::setw(12) << "median ms" << std::setw(12) << "min ms"
+              << std::setw(18) << "throughput/s";
+    if (!baseline.empty()) {
+        std::cout << std::setw(12) << "vs base";
+    }
+    std::cout << "\n";
+
+    bool regressed = false;
+
+    for (const auto& result : results) {
+        double throughput = (result.medianMs > 0.0) ? result.items / (result.medianMs / 1000.0) : 0.0;
+
+        std::cout << std::left << std::setw(42) << result.name << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(12) << result.medianMs
+                  << std::setw(12) << result.minMs << std::setprecision(0)
+                  << std::setw(14) << throughput << " " << std::left << std::setw(9)
+                  << result.unit << std::right;
+
+        auto base = baseline.find(result.name);
+        if (base != baseline.end() && base->second > 0.0) {
+            double change = (result.medianMs / base->second - 1.0) * 100.0;
+            std::cout << std::showpos << std::setprecision(1) << std::setw(8) << change
+                      << "%" << std::noshowpos;
+
+            if (maxRegression >= 0.0 && change > maxRegression) {
+                std::cout << "  REGRESSION";
+                regressed = true;
+            }
+        }
+        std::cout << "\n";
+    }
+
+    if (!outPath.empty()) {
+        std::ofstream out(outPath);
+
+        if (!out.is_open()) {
+            std::cerr << "Error: Cannot write " << outPath << ".\n";
+            return 1;
+        }
+
+        out << corpusLine.str() << "\n";
+        out << "benchmark\titems\tunit\tmedian_ms\tmin_ms\tthroughput_per_s\n";
+        out << std::fixed;
+
+        for (const auto& result : results) {
+            double throughput = (result.medianMs > 0.0) ? result.items / (result.medianMs / 1000.0) : 0.0;
+            out << result.name << "\t" << result.items << "\t" << result.unit << "\t"
+                << std::setprecision(4) << result.medianMs << "\t" << result.minMs << "\t"
+                << std::setprecision(0) << throughput << "\n";
+        }
+
+        std::cout << "Results written to: " << outPath << "\n";
+    }
+
+    return regressed ? 1 : 0;
+}
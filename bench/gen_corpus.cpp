@@ -0,0 +1,161 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "CorpusGenerator.h"
+
+/*
+-------------------------------------------------
+Function Name : documentFileName()
+
+Objective:
+    Name a generated document.
+
+Input:
+    index → Document index.
+
+Output:
+    "docNNNNNN.txt" (zero-padded, so names sort in index order).
+
+Side Effect:
+    None.
+
+Approach:
+    Format the index with snprintf.
+*/
+static std::string documentFileName(size_t index) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "doc%06zu.txt", index);
+    return name;
+}
+
+/*
+-------------------------------------------------
+Function Name : printUsage()
+
+Objective:
+    Describe the command line.
+
+Input:
+    out → Stream to print to.
+
+Output:
+    None.
+
+Side Effect:
+    Prints the usage text.
+
+Approach:
+    Fixed text; the corpus options are described in CorpusGenerator.h.
+*/
+static void printUsage(std::ostream& out) {
+    out << "Usage: gen_corpus OUTPUT_DIR [--docs N] [--length N] [--vocab N]\n"
+        << "                  [--zipf S] [--dup-rate R] [--edit-rate R] [--seed N]\n";
+}
+
+/*
+-------------------------------------------------
+Function Name : main()
+
+Objective:
+    Write a synthetic corpus to a folder.
+
+Input:
+    Command-line arguments:
+        ./gen_corpus OUTPUT_DIR [--docs N] [--length N] [--vocab N]
+                     [--zipf S] [--dup-rate R] [--edit-rate R] [--seed N]
+        ./gen_corpus --help
+
+Output:
+    OUTPUT_DIR/docNNNNNN.txt for every document, and
+    OUTPUT_DIR/planted.csv listing the planted near-duplicate pairs.
+    Exit status 1, with nothing created, on an unknown option or an
+    option without a value.
+
+Side Effect:
+    Creates the folder and files.
+
+Approach:
+    Parse the corpus options (every argument starting with "--" is an
+    option, never the folder), then generate and write one document at
+    a time.
+
+    // call printUsage()
+    // call CorpusGenerator()
+*/
+int main(int argc, char* argv[]) {
+
+    std::string outputDir;
+    CorpusOptions options;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+
+        if (arg == "--help") {
+            printUsage(std::cout);
+            return 0;
+        }
+
+        if (arg.rfind("--", 0) == 0) {
+            if (i + 1 >= argc) {
+                std::cerr << "Error: Missing value for " << arg << ".\n";
+                return 1;
+            }
+
+            try {
+                if (!parseCorpusOption(arg, argv[i + 1], options)) {
+                    std::cerr << "Error: Unknown option " << arg << ".\n";
+                    return 1;
+                }
+            } catch (...) {
+                std::cerr << "Error: Invalid value for " << arg << ".\n";
+                return 1;
+            }
+            i++;
+        } else if (outputDir.empty()) {
+            outputDir = arg;
+        } else {
+            std::cerr << "Error: Unexpected argument " << arg << ".\n";
+            return 1;
+        }
+    }
+
+    if (outputDir.empty()) {
+        printUsage(std::cerr);
+        return 1;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(outputDir, error);
+
+    // call CorpusGenerator()
+    CorpusGenerator generator(options);
+
+    for (size_t d = 0; d < options.documents; d++) {
+        std::ofstream file(outputDir + "/" + documentFileName(d), std::ios::binary);
+
+        if (!file.is_open()) {
+            std::cerr << "Error: Cannot write to " << outputDir << ".\n";
+            return 1;
+        }
+
+        file << generator.text(d);
+    }
+
+    // Not a supported input type, so the checker does not read it
+    std::ofstream planted(outputDir + "/planted.csv");
+    planted << "source,duplicate\n";
+
+    size_t plantedCount = 0;
+    for (const auto& pair : generator.plantedPairs()) {
+        planted << documentFileName(pair.first) << "," << documentFileName(pair.second) << "\n";
+        plantedCount++;
+    }
+
+    std::cout << "Generated " << options.documents << " documents ("
+              << plantedCount << " planted near-duplicates) in " << outputDir << "\n";
+
+    return 0;
+}
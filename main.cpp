@@ -1,15 +1,35 @@
 #include <iostream>
 #include <vector>
 #include <string>
-#include <map>
 #include <iomanip>
-#include <tuple>
+#include <unordered_set>
+#include <string_view>
+#include <memory_resource>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
+#include <limits>
+#include <system_error>
 
 #include "FileReader.h"
 #include "TextCleaner.h"
+#include "TermDictionary.h"
+#include "IngestPipeline.h"
+#include "CorpusIndex.h"
 #include "FeatureExtractor.h"
+#include "MinHashLSH.h"
+#include "FingerprintIndex.h"
 #include "SimilarityChecker.h"
+#include "DenseKernels.h"
 #include "ReportWriter.h"
+#include "ShardStore.h"
+#include "ResultCache.h"
+#include "TileCoordinator.h"
+#include "TileWorker.h"
+#include "TileProtocol.h"
+#include "RunStats.h"
+#include "HashUtils.h"
 
 /*
 -------------------------------------------------
@@ -26,6 +46,81 @@ Input:
         Mode 2 (File Mode):
             ./checker -f file1.txt file2.txt output.csv threshold
 
+        Mode 3 (Distributed Mode, on a shared --index):
+            ./checker --index PATH --coordinator PORT output.csv threshold
+            ./checker --index PATH --worker HOST:PORT
+
+        Options (any mode, anywhere on the command line):
+            --threads N   clean text and compare pairs on N threads
+                          (0 = all cores)
+            --io-threads N read files on N threads (default 2)
+            --recursive   also read the files of all subdirectories of the
+                          folder, named by their relative path
+            --top-k K     report only the K best matches of each document
+            --prune       report only pairs above threshold, skipping
+                          pairs that cannot reach it
+            --lsh         score only MinHash/LSH near-duplicate candidates
+            --lsh-bands N LSH bands (default 20, implies --lsh)
+            --lsh-rows N  rows per band (default 5, implies --lsh)
+            --shingle N   tokens per shingle (default 3, implies --lsh)
+            --fingerprint report passages shared by documents, found with
+                          winnowed k-gram fingerprints, instead of cosine
+                          similarity
+            --kgram N     tokens per k-gram (default 5, implies
+                          --fingerprint)
+            --winnow N    k-grams per winnowing window (default 4,
+                          implies --fingerprint)
+            --index PATH  load previously indexed documents from PATH and
+                          process only files that are not in it
+            --build-index PATH
+                          save all processed documents to PATH
+            --query       with --index, compare only the new files
+                          against the indexed corpus and each other
+            --engine NAME all-pairs kernel: auto (default), spgemm
+                          (blocked sparse matrix product), dense (SIMD
+                          float32) or pairwise; only pairwise abandons
+                          pairs early under --flagged-only, spgemm and
+                          dense always score every pair
+            --hash-bits K hash tokens into 2^K signed features instead of
+                          building a vocabulary (feature hashing)
+            --stopwords LANG
+                          stopword list: english (default), french,
+                          german, spanish or none
+            --max-memory MB
+                          compare out of core: keep the corpus in on-disk
+                          shards and score shard blocks within about MB
+                          megabytes of memory
+            --shard-dir PATH
+                          directory for the temporary shard files
+                          (default: the system temporary directory)
+            --coordinator PORT
+                          hand tiles of the indexed corpus to workers
+                          and report the pairs above threshold they
+                          return
+            --worker HOST:PORT
+                          score tiles for the coordinator at HOST:PORT
+            --tile-docs N documents per tile edge (default 2048)
+            --tile-timeout S
+                          seconds a worker may take per tile before the
+                          tile is retried elsewhere (default 600, 0 = no
+                          limit)
+            --dedup       score exact duplicates (same cleaned tokens)
+                          once and report their pairs at 100%
+            --cache PATH  reuse the scores of unchanged documents from
+                          the result cache at PATH and update it
+            --cache-tolerance T
+                          largest error allowed for a reused score
+                          (default 0.005)
+            --flagged-only
+                          write only pairs above threshold to the report
+                          (with --engine pairwise or --lsh, also stop
+                          scoring pairs that cannot reach it)
+            --format NAME report format: csv (default) or binary
+                          (columnar doc-id / score batches)
+            --stats       print time, CPU, memory and counters per stage
+            --stats-json PATH
+                          write the same statistics as JSON to PATH
+
 Output:
     - Displays similarity scores on console.
     - Generates CSV report on disk.
@@ -70,8 +165,492 @@ int main(int argc, char* argv[]) {
     std::string outputFile = "plagiarism_report.csv";
     double threshold = 0.70;
     std::vector<std::string> filePaths;
+    std::vector<uint64_t> fileSizes;
     std::vector<std::string> documentNames;
     bool useFileMode = false;
+    int threadCount = 1;
+    int ioThreadCount = 2;
+    int topK = 0;
+    bool pruneBelowThreshold = false;
+    bool useLSH = false;
+    int lshBands = 20;
+    int lshRows = 5;
+    int shingleSize = 3;
+    bool useFingerprint = false;
+    int kgramSize = 5;
+    int winnowWindow = 4;
+    std::string indexPath;
+    std::string buildIndexPath;
+    bool queryMode = false;
+    std::string engine = "auto";
+    int hashBits = 0;
+    const StopWordSet* stopWords = &StopWordSet::english();
+    size_t maxMemoryMB = 0;
+    std::string shardDirectory;
+    int coordinatorPort = 0;
+    std::string workerAddress;
+    int tileDocuments = 2048;
+    int tileTimeout = 600;
+    bool deduplicate = false;
+    std::string cachePath;
+    double cacheTolerance = ResultCache::defaultTolerance;
+    bool recursiveScan = false;
+    bool flaggedOnly = false;
+    ReportFormat reportFormat = ReportFormat::CSV;
+    bool showStats = false;
+    std::string statsJsonPath;
+
+    // Run statistics, collected always and reported on request
+    RunStats stats;
+
+    // Prints / exports the statistics at the end of a run and returns
+    // main()'s exit status (see Section : Run Statistics)
+    auto reportStats = [&]() {
+        if (showStats) {
+            stats.printSummary(std::cout);
+        }
+
+        if (!statsJsonPath.empty() && !stats.writeJSON(statsJsonPath)) {
+            std::cerr << "Error: Cannot write statistics " << statsJsonPath << ".\n";
+            return 1;
+        }
+
+        return 0;
+    };
+
+
+    /*
+    -------------------------------------------------
+    Section : Option Flag Processing
+
+    Objective:
+        Extract "--option value" flags before positional parsing.
+
+    Input:
+        argv[] command-line arguments.
+
+    Output:
+        Option values set; remaining arguments collected in args.
+
+    Side Effect:
+        Terminates program on an invalid option value.
+
+
+    Approach:
+        Consume known flags with their values and keep every other
+        argument, in order, for the mode parsing below.
+    */
+    std::vector<std::string> args;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+
+        if (arg == "--threads" && i + 1 < argc) {
+            try {
+                threadCount = std::stoi(argv[++i]);
+            } catch (...) {
+                std::cerr << "Error: Invalid value for --threads.\n";
+                return 1;
+            }
+        }
+        else if (arg == "--io-threads" && i + 1 < argc) {
+            try {
+                ioThreadCount = std::stoi(argv[++i]);
+            } catch (...) {
+                std::cerr << "Error: Invalid value for --io-threads.\n";
+                return 1;
+            }
+        }
+        else if (arg == "--top-k" && i + 1 < argc) {
+            try {
+                topK = std::stoi(argv[++i]);
+            } catch (...) {
+                std::cerr << "Error: Invalid value for --top-k.\n";
+                return 1;
+            }
+        }
+        else if (arg == "--prune") {
+            pruneBelowThreshold = true;
+        }
+        else if (arg == "--lsh") {
+            useLSH = true;
+        }
+        else if ((arg == "--lsh-bands" || arg == "--lsh-rows" || arg == "--shingle") &&
+                 i + 1 < argc) {
+            int value = 0;
+            try {
+                value = std::stoi(argv[++i]);
+            } catch (...) {
+                std::cerr << "Error: Invalid value for " << arg << ".\n";
+                return 1;
+            }
+
+            if (arg == "--lsh-bands") lshBands = value;
+            else if (arg == "--lsh-rows") lshRows = value;
+            else shingleSize = value;
+
+            useLSH = true;
+        }
+        else if (arg == "--fingerprint") {
+            useFingerprint = true;
+        }
+        else if ((arg == "--kgram" || arg == "--winnow") && i + 1 < argc) {
+            try {
+                (arg == "--kgram" ? kgramSize : winnowWindow) = std::stoi(argv[++i]);
+            } catch (...) {
+                std::cerr << "Error: Invalid value for " << arg << ".\n";
+                return 1;
+            }
+
+            useFingerprint = true;
+        }
+        else if (arg == "--index" && i + 1 < argc) {
+            indexPath = argv[++i];
+        }
+        else if (arg == "--build-index" && i + 1 < argc) {
+            buildIndexPath = argv[++i];
+        }
+        else if (arg == "--query") {
+            queryMode = true;
+        }
+        else if (arg == "--hash-bits" && i + 1 < argc) {
+            try {
+                hashBits = std::stoi(argv[++i]);
+            } catch (...) {
+                hashBits = -1;
+            }
+
+            if (hashBits < 1 || hashBits > FeatureHasher::maxBits) {
+                std::cerr << "Error: Invalid value for --hash-bits (1-"
+                          << FeatureHasher::maxBits << ").\n";
+                return 1;
+            }
+        }
+        else if (arg == "--stopwords" && i + 1 < argc) {
+            stopWords = StopWordSet::forLanguage(argv[++i]);
+
+            if (stopWords == nullptr) {
+                std::cerr << "Error: Invalid value for --stopwords ("
+                          << StopWordSet::languageNames() << ").\n";
+                return 1;
+            }
+        }
+        else if (arg == "--max-memory" && i + 1 < argc) {
+            long long megabytes = 0;
+            try {
+                megabytes = std::stoll(argv[++i]);
+            } catch (...) {}
+
+            if (megabytes < 16) {
+                std::cerr << "Error: Invalid value for --max-memory (MB, at least 16).\n";
+                return 1;
+            }
+
+            maxMemoryMB = static_cast<size_t>(megabytes);
+        }
+        else if (arg == "--shard-dir" && i + 1 < argc) {
+            shardDirectory = argv[++i];
+        }
+        else if ((arg == "--coordinator" || arg == "--tile-docs" || arg == "--tile-timeout") &&
+                 i + 1 < argc) {
+            int value = -1;
+            try {
+                value = std::stoi(argv[++i]);
+            } catch (...) {}
+
+            bool valid = (arg == "--coordinator") ? (value > 0 && value < 65536)
+                       : (arg == "--tile-docs")   ? value > 0
+                                                  : value >= 0;
+            if (!valid) {
+                std::cerr << "Error: Invalid value for " << arg << ".\n";
+                return 1;
+            }
+
+            if (arg == "--coordinator") coordinatorPort = value;
+            else if (arg == "--tile-docs") tileDocuments = value;
+            else tileTimeout = value;
+        }
+        else if (arg == "--worker" && i + 1 < argc) {
+            workerAddress = argv[++i];
+
+            size_t colon = workerAddress.rfind(':');
+            if (colon == std::string::npos || colon == 0 ||
+                workerAddress.find_first_not_of("0123456789", colon + 1) != std::string::npos ||
+                colon + 1 == workerAddress.size()) {
+                std::cerr << "Error: Invalid value for --worker (HOST:PORT).\n";
+                return 1;
+            }
+        }
+        else if (arg == "--dedup") {
+            deduplicate = true;
+        }
+        else if (arg == "--cache" && i + 1 < argc) {
+            cachePath = argv[++i];
+        }
+        else if (arg == "--cache-tolerance" && i + 1 < argc) {
+            try {
+                cacheTolerance = std::stod(argv[++i]);
+            } catch (...) {
+                cacheTolerance = -1.0;
+            }
+
+            if (!(cacheTolerance >= 0.0 && cacheTolerance < 1.0)) {
+                std::cerr << "Error: Invalid value for --cache-tolerance (0 to below 1).\n";
+                return 1;
+            }
+        }
+        else if (arg == "--recursive") {
+            recursiveScan = true;
+        }
+        else if (arg == "--flagged-only") {
+            flaggedOnly = true;
+        }
+        else if (arg == "--stats") {
+            showStats = true;
+        }
+        else if (arg == "--stats-json" && i + 1 < argc) {
+            statsJsonPath = argv[++i];
+        }
+        else if (arg == "--format" && i + 1 < argc) {
+            std::string format = argv[++i];
+
+            if (format == "csv") {
+                reportFormat = ReportFormat::CSV;
+            } else if (format == "binary") {
+                reportFormat = ReportFormat::Binary;
+            } else {
+                std::cerr << "Error: Invalid value for --format.\n";
+                return 1;
+            }
+        }
+        else if (arg == "--engine" && i + 1 < argc) {
+            engine = argv[++i];
+
+            if (engine != "auto" && engine != "spgemm" &&
+                engine != "dense" && engine != "pairwise") {
+                std::cerr << "Error: Invalid value for --engine.\n";
+                return 1;
+            }
+        }
+        else {
+            args.push_back(arg);
+        }
+    }
+
+    // MinHash shingles need token order, which an index does not keep
+    if (useLSH && !indexPath.empty()) {
+        std::cerr << "Error: --lsh cannot be combined with --index.\n";
+        return 1;
+    }
+
+    // Fingerprints also need token order, and spans exist only in CSV
+    if (useFingerprint && (useLSH || !indexPath.empty() || topK > 0 ||
+                           reportFormat != ReportFormat::CSV)) {
+        std::cerr << "Error: --fingerprint cannot be combined with --lsh, --index, "
+                     "--top-k or --format binary.\n";
+        return 1;
+    }
+
+    // An index stores dictionary terms, which hashed features do not have
+    if (hashBits > 0 && (!indexPath.empty() || !buildIndexPath.empty())) {
+        std::cerr << "Error: --hash-bits cannot be combined with --index or --build-index.\n";
+        return 1;
+    }
+
+    // An index does not record which stopwords its documents lost, so
+    // it is built and used with the default list only
+    if (stopWords != &StopWordSet::english() &&
+        (!indexPath.empty() || !buildIndexPath.empty())) {
+        std::cerr << "Error: --stopwords cannot be combined with --index or --build-index.\n";
+        return 1;
+    }
+
+    // Shards hold term counts only and are scored as full blocks
+    if (maxMemoryMB > 0 && (useLSH || useFingerprint || !indexPath.empty() ||
+                            !buildIndexPath.empty() || topK > 0 || pruneBelowThreshold ||
+                            engine == "dense" || engine == "pairwise")) {
+        std::cerr << "Error: --max-memory cannot be combined with --lsh, --fingerprint, "
+                     "--index, --build-index, --top-k, --prune or --engine dense/pairwise.\n";
+        return 1;
+    }
+
+    // Nodes share a prebuilt index and score full tiles of it
+    bool distributed = coordinatorPort > 0 || !workerAddress.empty();
+
+    if (distributed && (indexPath.empty() || (coordinatorPort > 0 && !workerAddress.empty()) ||
+                        useLSH || useFingerprint || topK > 0 || pruneBelowThreshold ||
+                        queryMode || !buildIndexPath.empty() || maxMemoryMB > 0)) {
+        std::cerr << "Error: --coordinator or --worker needs --index and cannot be combined "
+                     "with each other, --lsh, --fingerprint, --top-k, --prune, --query, "
+                     "--build-index or --max-memory.\n";
+        return 1;
+    }
+
+    // Cached scores are all-pairs scores of files read in this run
+    if (!cachePath.empty() && (useLSH || useFingerprint || !indexPath.empty() || topK > 0 ||
+                               pruneBelowThreshold || maxMemoryMB > 0 || distributed ||
+                               engine == "dense" || engine == "pairwise")) {
+        std::cerr << "Error: --cache cannot be combined with --lsh, --fingerprint, --index, "
+                     "--top-k, --prune, --max-memory, --coordinator, --worker or "
+                     "--engine dense/pairwise.\n";
+        return 1;
+    }
+
+    // Duplicates are found on this run's token streams and expanded
+    // into a full all-pairs report
+    if (deduplicate && (useLSH || useFingerprint || !indexPath.empty() || topK > 0 ||
+                        pruneBelowThreshold || maxMemoryMB > 0 || distributed ||
+                        !cachePath.empty() || engine == "dense" || engine == "pairwise")) {
+        std::cerr << "Error: --dedup cannot be combined with --lsh, --fingerprint, --index, "
+                     "--top-k, --prune, --max-memory, --coordinator, --worker, --cache or "
+                     "--engine dense/pairwise.\n";
+        return 1;
+    }
+
+    if (queryMode && (indexPath.empty() || topK > 0)) {
+        std::cerr << "Error: --query needs --index and cannot be combined with --top-k.\n";
+        return 1;
+    }
+
+
+    /*
+    -------------------------------------------------
+    Section : Distributed Mode
+
+    Objective:
+        Score the indexed corpus across several nodes.
+
+    Input:
+        indexPath, coordinatorPort or workerAddress; for the
+        coordinator, args holds [output.csv [threshold]].
+
+    Output:
+        Coordinator: report of the pairs above threshold.
+        Worker: tile results sent to the coordinator.
+
+    Side Effect:
+        Maps the index; network I/O; terminates program when done.
+
+
+    Approach:
+        Every node maps the same index file. A worker rebuilds the
+        TF-IDF vectors from the stored counts exactly as a single-node
+        run does and serves tiles; the coordinator only needs the
+        names, and merges the returned pairs into a flagged-only
+        report, which is therefore identical to a single-node
+        --flagged-only run on the index.
+
+        // call CorpusIndex::load()
+        // call TileWorker::run()
+        // call TileCoordinator::run()
+    */
+    if (distributed) {
+        if (coordinatorPort > 0) {
+            if (!args.empty()) outputFile = args[0];
+
+            if (args.size() > 1) {
+                try {
+                    threshold = std::stod(args[1]);
+                } catch (...) {}
+
+                if (threshold < 0.0 || threshold > 1.0) {
+                    threshold = 0.70;
+                }
+            }
+        }
+
+        stats.beginStage("load_index");
+
+        CorpusIndex sharedIndex;
+
+        if (!sharedIndex.load(indexPath)) {
+            std::cerr << "Error: Cannot load index " << indexPath << ".\n";
+            return 1;
+        }
+
+        uint64_t digest = corpusDigest(sharedIndex);
+        int docTotal = static_cast<int>(sharedIndex.documentCount());
+
+        stats.count("indexed_documents", sharedIndex.documentCount());
+        stats.count("indexed_terms", sharedIndex.termCount());
+        stats.endStage();
+
+        if (!workerAddress.empty()) {
+            size_t colon = workerAddress.rfind(':');
+            std::string host = workerAddress.substr(0, colon);
+            int port = std::stoi(workerAddress.substr(colon + 1));
+
+            stats.beginStage("tfidf");
+
+            std::pmr::monotonic_buffer_resource workerArena;
+            TermDictionary workerDictionary(&workerArena);
+            sharedIndex.loadDictionary(workerDictionary);
+
+            FeatureExtractor extractor(workerDictionary);
+            for (int d = 0; d < docTotal; d++) {
+                extractor.addDocumentCounts(sharedIndex.documentCounts(d),
+                                            sharedIndex.documentLength(d));
+            }
+            extractor.computeTFIDF();
+
+            SimilarityChecker checker(extractor.takeTFIDFVectors(), {});
+
+            stats.count("documents", docTotal);
+            stats.count("nonzeros", extractor.getNonZeroCount());
+            stats.endStage();
+
+            stats.beginStage("compare_report");
+
+            TileWorker worker(checker, sharedIndex.termCount(), digest, threadCount);
+            bool served = worker.run(host, port);
+
+            stats.count("tiles", worker.tileCount());
+            stats.endStage();
+
+            return served ? reportStats() : 1;
+        }
+
+        std::cout << "=== Smart Assignment Plagiarism Checker ===\n";
+        std::cout << "Output file: " << outputFile << "\n";
+        std::cout << "Threshold: " << threshold * 100 << "%\n";
+
+        stats.beginStage("compare_report");
+
+        std::vector<std::string> indexedNames;
+        for (int d = 0; d < docTotal; d++) {
+            indexedNames.push_back(std::string(sharedIndex.documentName(d)));
+        }
+
+        ReportWriter writer(outputFile, threshold);
+        writer.setFlaggedOnly(true);
+        writer.setFormat(reportFormat);
+
+        std::unique_ptr<ResultSink> reportFile = writer.openSink(indexedNames);
+
+        if (!reportFile) {
+            return 1;
+        }
+
+        CountingSink report(*reportFile);
+
+        TileCoordinator coordinator(docTotal, sharedIndex.termCount(), digest, threshold,
+                                    tileDocuments, tileTimeout);
+
+        if (!coordinator.run(coordinatorPort, report)) {
+            return 1;
+        }
+
+        report.finish();
+
+        stats.count("tiles", coordinator.tileCount());
+        stats.count("tile_retries", coordinator.retryCount());
+        stats.count("workers", coordinator.workerCount());
+        stats.count("pairs_total", static_cast<size_t>(docTotal) * (docTotal - (docTotal > 0)) / 2);
+        stats.count("pairs_reported", report.count());
+        stats.endStage();
+
+        return reportStats();
+    }
 
 
     /*
@@ -82,7 +661,7 @@ int main(int argc, char* argv[]) {
         Determine execution mode and parse inputs.
 
     Input:
-        argv[] command-line arguments.
+        args (command-line arguments without option flags).
 
     Output:
         filePaths, outputFile and threshold populated.
@@ -94,15 +673,17 @@ int main(int argc, char* argv[]) {
     Approach:
         Detect "-f" flag or folder mode and extract parameters.
     */
-    if (argc > 1) {
-        std::string firstArg = argv[1];
+    stats.beginStage("scan");
+
+    if (!args.empty()) {
+        std::string firstArg = args[0];
 
         // ---------------- FILE MODE ----------------
         if (firstArg == "-f" || firstArg == "--files") {
             useFileMode = true;
 
-            for (int i = 2; i < argc; i++) {
-                std::string arg = argv[i];
+            for (size_t i = 1; i < args.size(); i++) {
+                std::string arg = args[i];
 
                 if (arg.length() > 4 &&
                     (arg.substr(arg.length() - 4) == ".txt" ||
@@ -133,10 +714,10 @@ int main(int argc, char* argv[]) {
         else {
             std::string inputFolder = firstArg;
 
-            if (argc > 2) outputFile = argv[2];
+            if (args.size() > 1) outputFile = args[1];
 
-            if (argc > 3) {
-                threshold = std::stod(argv[3]);
+            if (args.size() > 2) {
+                threshold = std::stod(args[2]);
                 if (threshold < 0.0 || threshold > 1.0) {
                     threshold = 0.70;
                 }
@@ -144,16 +725,17 @@ int main(int argc, char* argv[]) {
 
             // call FileReader()
             FileReader reader(inputFolder);
-            std::vector<std::string> fileNames = reader.getFileNames();
+            std::vector<ScannedFile> files = reader.scanFiles(recursiveScan);
 
-            if (fileNames.empty()) {
+            if (files.empty()) {
                 std::cerr << "Error: No supported files found.\n";
                 return 1;
             }
 
-            for (const auto& name : fileNames) {
-                filePaths.push_back(inputFolder + "/" + name);
-                documentNames.push_back(name);
+            for (auto& file : files) {
+                filePaths.push_back(inputFolder + "/" + file.name);
+                documentNames.push_back(std::move(file.name));
+                fileSizes.push_back(file.size);
             }
         }
     }
@@ -183,16 +765,17 @@ int main(int argc, char* argv[]) {
     else {
         std::string inputFolder = "assignments";
         FileReader reader(inputFolder);
-        std::vector<std::string> fileNames = reader.getFileNames();
+        std::vector<ScannedFile> files = reader.scanFiles(recursiveScan);
 
-        if (fileNames.empty()) {
+        if (files.empty()) {
             std::cerr << "Error: No supported files.\n";
             return 1;
         }
 
-        for (const auto& name : fileNames) {
-            filePaths.push_back(inputFolder + "/" + name);
-            documentNames.push_back(name);
+        for (auto& file : files) {
+            filePaths.push_back(inputFolder + "/" + file.name);
+            documentNames.push_back(std::move(file.name));
+            fileSizes.push_back(file.size);
         }
     }
 
@@ -201,20 +784,23 @@ int main(int argc, char* argv[]) {
     Section : Extract File Names in File Mode
 
     Objective:
-        Extract file names from file paths.
+        Extract file names (and sizes) from file paths.
 
     Input:
         Full file paths.
 
     Output:
-        documentNames list.
+        documentNames and fileSizes lists.
 
     Side Effect:
-        Populates documentNames vector.
+        Populates documentNames and fileSizes vectors.
 
 
     Approach:
-        Extract substring after last slash or backslash.
+        Extract substring after last slash or backslash; ask the file
+        system for each size, which the folder scan already provides.
+
+        // call FileReader::fileSizeByPath()
     */
     if (useFileMode && documentNames.empty()) {
         for (const auto& path : filePaths) {
@@ -223,6 +809,9 @@ int main(int argc, char* argv[]) {
                                  ? path.substr(lastSlash + 1)
                                  : path;
             documentNames.push_back(name);
+
+            // call FileReader::fileSizeByPath()
+            fileSizes.push_back(FileReader::fileSizeByPath(path));
         }
     }
 
@@ -247,6 +836,14 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
+    stats.count("files_found", filePaths.size());
+
+    for (uint64_t size : fileSizes) {
+        stats.count("bytes_found", size);
+    }
+
+    stats.endStage();
+
     /*
     -------------------------------------------------
     Section : Banner Display
@@ -268,6 +865,236 @@ int main(int argc, char* argv[]) {
     std::cout << "Threshold: " << threshold * 100 << "%\n";
 
 
+    /*
+    -------------------------------------------------
+    Section : Load Corpus Index
+
+    Objective:
+        Reuse documents processed by an earlier run.
+
+    Input:
+        indexPath (--index).
+
+    Output:
+        Shared term dictionary seeded with the stored terms; filePaths
+        and documentNames reduced to files missing from the index.
+
+    Side Effect:
+        Maps the index file; terminates program if it cannot be loaded.
+
+
+    Approach:
+        Intern the stored terms first so stored term IDs stay valid,
+        then skip every input file whose name is already indexed.
+
+        // call CorpusIndex::load()
+        // call CorpusIndex::loadDictionary()
+    */
+    // Shared terms are allocated from one run-long arena and released
+    // together when main() returns
+    std::pmr::monotonic_buffer_resource runArena;
+
+    TextCleaner cleaner(*stopWords);
+    TermDictionary dictionary(&runArena);
+    CorpusIndex corpusIndex;
+
+    if (!indexPath.empty()) {
+        stats.beginStage("load_index");
+
+        if (!corpusIndex.load(indexPath)) {
+            std::cerr << "Error: Cannot load index " << indexPath << ".\n";
+            return 1;
+        }
+
+        corpusIndex.loadDictionary(dictionary);
+
+        std::unordered_set<std::string_view> indexedNames;
+        for (size_t d = 0; d < corpusIndex.documentCount(); d++) {
+            indexedNames.insert(corpusIndex.documentName(d));
+        }
+
+        std::vector<std::string> newPaths;
+        std::vector<std::string> newNames;
+        std::vector<uint64_t> newSizes;
+        for (size_t i = 0; i < filePaths.size(); i++) {
+            if (indexedNames.count(documentNames[i])) continue;
+
+            newPaths.push_back(std::move(filePaths[i]));
+            newNames.push_back(std::move(documentNames[i]));
+            newSizes.push_back(fileSizes[i]);
+        }
+
+        std::cout << "Indexed documents: " << corpusIndex.documentCount()
+                  << ", new files: " << newPaths.size() << "\n";
+
+        stats.count("indexed_documents", corpusIndex.documentCount());
+        stats.count("indexed_terms", corpusIndex.termCount());
+        stats.endStage();
+
+        filePaths = std::move(newPaths);
+        documentNames = std::move(newNames);
+        fileSizes = std::move(newSizes);
+    }
+
+
+    /*
+    -------------------------------------------------
+    Section : Out-of-Core Comparison
+
+    Objective:
+        Score all pairs of a corpus too large for memory (--max-memory).
+
+    Input:
+        filePaths, documentNames, maxMemoryMB, shardDirectory.
+
+    Output:
+        Report with the same pairs and scores as the in-memory
+        all-pairs engines.
+
+    Side Effect:
+        Writes temporary shard and spill files; terminates program
+        when done.
+
+
+    Approach:
+        Ingest the files in batches of about a quarter of the budget
+        (by file size) and append each document's term counts to the
+        shard store, so token lists never accumulate. Once all
+        document frequencies are known, compute IDF and let the store
+        score shard blocks and merge them into the report.
+
+        // call IngestPipeline::run()
+        // call ShardStore::addDocument()
+        // call ShardStore::finish()
+        // call ShardStore::compareAll()
+    */
+    if (maxMemoryMB > 0) {
+        size_t budget = maxMemoryMB << 20;
+
+        stats.beginStage("read_clean");
+
+        FeatureHasher hasher(hashBits);
+
+        if (hashBits > 0) {
+            std::cout << "Feature hashing: " << hasher.dimensions() << " dimensions\n";
+        }
+
+        ShardStore store(shardDirectory, budget, hashBits > 0);
+
+        if (!store.open()) {
+            std::cerr << "Error: Cannot create shard files in "
+                      << (shardDirectory.empty() ? "the temporary directory" : shardDirectory)
+                      << ".\n";
+            return 1;
+        }
+
+        IngestPipeline pipeline(cleaner, ioThreadCount, threadCount);
+        std::vector<std::string> storedNames;
+
+        for (size_t first = 0; first < filePaths.size();) {
+            std::vector<std::string> batch;
+            std::vector<uint64_t> batchSizes;
+            size_t batchBytes = 0;
+
+            while (first + batch.size() < filePaths.size() &&
+                   (batch.empty() || batchBytes < budget / 4)) {
+                uint64_t size = fileSizes[first + batch.size()];
+
+                batchBytes += static_cast<size_t>(size);
+                batch.push_back(filePaths[first + batch.size()]);
+                batchSizes.push_back(size);
+            }
+
+            std::vector<IngestedDocument> ingested = (hashBits > 0)
+                ? pipeline.run(batch, hasher, batchSizes)
+                : pipeline.run(batch, dictionary, batchSizes);
+
+            stats.count("files", ingested.size());
+
+            for (size_t i = 0; i < ingested.size(); i++) {
+                stats.count("bytes_read", ingested[i].bytesRead);
+
+                if (!ingested[i].hasContent) continue;
+
+                stats.count("tokens", ingested[i].termIds.size());
+
+                if (!store.addDocument(ingested[i].termIds)) {
+                    std::cerr << "Error: Cannot write shard files.\n";
+                    return 1;
+                }
+
+                storedNames.push_back(std::move(documentNames[first + i]));
+            }
+
+            first += batch.size();
+        }
+
+        stats.count("documents", store.documentCount());
+        stats.count(hashBits > 0 ? "hash_dimensions" : "vocabulary",
+                    hashBits > 0 ? hasher.dimensions() : dictionary.size());
+        stats.endStage();
+
+        if (store.documentCount() == 0) {
+            std::cerr << "Error: No valid data.\n";
+            return 1;
+        }
+
+        stats.beginStage("tfidf");
+
+        if (!store.finish()) {
+            std::cerr << "Error: Cannot write shard files.\n";
+            return 1;
+        }
+
+        std::cout << "Out-of-core: " << store.shardCount() << " shards, "
+                  << maxMemoryMB << " MB budget\n";
+
+        stats.count("documents", store.documentCount());
+        stats.count("active_terms", store.activeTermCount());
+        stats.count("shards", store.shardCount());
+        stats.count("shard_bytes", store.diskBytes());
+        stats.endStage();
+
+        stats.beginStage("compare_report");
+
+        ReportWriter writer(outputFile, threshold);
+        writer.setFlaggedOnly(flaggedOnly);
+        writer.setFormat(reportFormat);
+
+        std::unique_ptr<ResultSink> reportFile = writer.openSink(storedNames);
+
+        if (!reportFile) {
+            return 1;
+        }
+
+        CountingSink report(*reportFile);
+
+        // A flagged-only report never needs the pairs below threshold,
+        // so they are not spilled either
+        double minScore = flaggedOnly ? threshold : -std::numeric_limits<double>::infinity();
+
+        if (!store.compareAll(threadCount, report, minScore)) {
+            std::cerr << "Error: Cannot read or write shard files.\n";
+            return 1;
+        }
+
+        report.finish();
+
+        size_t docTotal = storedNames.size();
+        size_t pairsTotal = docTotal * (docTotal - 1) / 2;
+
+        stats.count("pairs_total", pairsTotal);
+        stats.count("pairs_scored", pairsTotal);
+        stats.count("pairs_pruned", 0);
+        stats.count("pairs_reported", report.count());
+        stats.count("blocks", store.blockCount());
+        stats.count("spilled_bytes", store.spilledBytes());
+        stats.endStage();
+
+        return reportStats();
+    }
+
+
     /*
     -------------------------------------------------
     Section : Read & Preprocess Documents
@@ -279,36 +1106,149 @@ int main(int argc, char* argv[]) {
         filePaths vector.
 
     Output:
-        processedDocuments vector.
+        processedDocuments vector (term IDs) and shared term dictionary.
 
     Side Effect:
         None.
 
    
     Approach:
-        Load each file and clean text.
-
-        // call TextCleaner()
-        // call FileReader::readFileByPath()
+        Run the ingest pipeline: ioThreadCount readers map files,
+        largest first, while threadCount workers clean text straight
+        from the mappings with one shared TextCleaner; documents come
+        back in input order.
+        Unreadable or empty files are dropped together with their
+        names so document indices stay aligned with documentNames.
+        With --hash-bits, tokens are hashed into signed features and
+        no dictionary is built.
+
+        // call IngestPipeline::run()
     */
-    TextCleaner cleaner;
-    std::vector<std::vector<std::string>> processedDocuments;
+    std::vector<std::vector<uint32_t>> processedDocuments;
+    std::vector<std::string> processedNames;
+    std::vector<uint64_t> contentHashes;
 
-    for (size_t i = 0; i < filePaths.size(); i++) {
-        std::string content = FileReader::readFileByPath(filePaths[i]);
+    stats.beginStage("read_clean");
 
-        if (content.empty()) continue;
+    FeatureHasher hasher(hashBits);
 
-        std::vector<std::string> tokens = cleaner.preprocess(content);
-        processedDocuments.push_back(tokens);
+    if (hashBits > 0) {
+        std::cout << "Feature hashing: " << hasher.dimensions() << " dimensions\n";
     }
 
-    if (processedDocuments.empty()) {
+    IngestPipeline pipeline(cleaner, ioThreadCount, threadCount);
+    std::vector<IngestedDocument> ingested = (hashBits > 0)
+        ? pipeline.run(filePaths, hasher, fileSizes)
+        : pipeline.run(filePaths, dictionary, fileSizes);
+
+    stats.count("files", ingested.size());
+
+    for (size_t i = 0; i < ingested.size(); i++) {
+        stats.count("bytes_read", ingested[i].bytesRead);
+
+        if (!ingested[i].hasContent) continue;
+
+        stats.count("tokens", ingested[i].termIds.size());
+
+        processedDocuments.push_back(std::move(ingested[i].termIds));
+        processedNames.push_back(std::move(documentNames[i]));
+        contentHashes.push_back(ingested[i].contentHash);
+    }
+
+    stats.count("documents", processedDocuments.size());
+    stats.count(hashBits > 0 ? "hash_dimensions" : "vocabulary",
+                hashBits > 0 ? hasher.dimensions() : dictionary.size());
+    stats.endStage();
+
+    documentNames = std::move(processedNames);
+
+    if (processedDocuments.empty() && corpusIndex.documentCount() == 0) {
         std::cerr << "Error: No valid data.\n";
         return 1;
     }
 
 
+    /*
+    -------------------------------------------------
+    Section : Exact Duplicates
+
+    Objective:
+        Group documents with identical cleaned token streams (--dedup).
+
+    Input:
+        processedDocuments.
+
+    Output:
+        representative: for every document, the index of its group
+        among the distinct documents, in order of first appearance.
+
+    Side Effect:
+        Prints the number of duplicates.
+
+
+    Approach:
+        Hash each token stream with XXH64 and confirm a hash match by
+        comparing the streams, so a collision can never merge two
+        different documents. Copies that differ only in case,
+        punctuation, whitespace or stopwords clean to the same stream.
+        Documents without tokens stay on their own: they score 0.0,
+        not 100%, against each other.
+
+        // call xxHash64()
+    */
+    std::vector<int> representative;
+
+    if (deduplicate) {
+        stats.beginStage("dedup");
+
+        std::unordered_map<uint64_t, std::vector<int>> groupsByHash;
+        std::vector<size_t> firstDocument;
+        std::vector<size_t> groupSize;
+
+        for (size_t d = 0; d < processedDocuments.size(); d++) {
+            const std::vector<uint32_t>& tokens = processedDocuments[d];
+            int group = -1;
+
+            if (!tokens.empty()) {
+                // call xxHash64()
+                std::vector<int>& candidates = groupsByHash[
+                    xxHash64(tokens.data(), tokens.size() * sizeof(uint32_t))];
+
+                for (int candidate : candidates) {
+                    if (processedDocuments[firstDocument[candidate]] == tokens) {
+                        group = candidate;
+                        break;
+                    }
+                }
+
+                if (group < 0) {
+                    candidates.push_back(static_cast<int>(firstDocument.size()));
+                }
+            }
+
+            if (group < 0) {
+                group = static_cast<int>(firstDocument.size());
+                firstDocument.push_back(d);
+                groupSize.push_back(0);
+            }
+
+            representative.push_back(group);
+            groupSize[group]++;
+        }
+
+        size_t duplicateGroups = std::count_if(groupSize.begin(), groupSize.end(),
+                                               [](size_t size) { return size > 1; });
+        size_t duplicates = processedDocuments.size() - firstDocument.size();
+
+        std::cout << "Exact duplicates: " << duplicates << " documents in "
+                  << duplicateGroups << " groups\n";
+
+        stats.count("duplicate_groups", duplicateGroups);
+        stats.count("duplicate_documents", duplicates);
+        stats.endStage();
+    }
+
+
     /*
     -------------------------------------------------
     Section : TF-IDF Generation
@@ -320,77 +1260,335 @@ int main(int argc, char* argv[]) {
         processedDocuments.
 
     Output:
-        TF-IDF vectors.
+        TF-IDF vectors (held by the extractor).
 
     Side Effect:
         None.
 
  
     Approach:
-        Initialize extractor and compute vectors.
+        Add indexed documents from their stored counts, then the new
+        documents in one parallel batch (term-ID shards, one per
+        thread), so new documents occupy the last indices; IDF is
+        refreshed once when the vectors are computed. Token lists are
+        released once indexed unless LSH or fingerprinting still needs
+        them.
+        With --build-index, save the combined corpus for later runs.
 
         // call FeatureExtractor()
+        // call addDocumentCounts() / addDocuments()
         // call computeTFIDF()
+        // call CorpusIndex::write()
     */
-    FeatureExtractor extractor(processedDocuments);
+    stats.beginStage("tfidf");
+
+    FeatureExtractor extractor(dictionary);
+    extractor.setSignedFeatures(hashBits > 0);
+    std::vector<std::string> corpusNames;
+
+    for (size_t d = 0; d < corpusIndex.documentCount(); d++) {
+        extractor.addDocumentCounts(corpusIndex.documentCounts(d),
+                                    corpusIndex.documentLength(d));
+        corpusNames.push_back(std::string(corpusIndex.documentName(d)));
+    }
+
+    // call addDocuments()
+    int firstNewDocument = extractor.addDocuments(processedDocuments, threadCount);
+
+    for (size_t d = 0; d < processedDocuments.size(); d++) {
+        corpusNames.push_back(std::move(documentNames[d]));
+    }
+
+    if (!useLSH && !useFingerprint) {
+        std::vector<std::vector<uint32_t>>().swap(processedDocuments);
+    }
+
+    documentNames = std::move(corpusNames);
+
     extractor.computeTFIDF();
-    std::vector<std::map<std::string, double>> tfidfVectors =
-        extractor.getAllTFIDFVectors();
+
+    stats.count("documents", documentNames.size());
+    stats.count(hashBits > 0 ? "hash_dimensions" : "vocabulary",
+                hashBits > 0 ? hasher.dimensions() : dictionary.size());
+    stats.count("active_terms", extractor.getActiveTermCount());
+    stats.count("nonzeros", extractor.getNonZeroCount());
+    stats.endStage();
+
+    if (!buildIndexPath.empty()) {
+        stats.beginStage("build_index");
+
+        if (CorpusIndex::write(buildIndexPath, dictionary, documentNames,
+                               extractor.getInvertedIndex(),
+                               extractor.getAllTFIDFVectors())) {
+            std::cout << "Index written: " << buildIndexPath << " ("
+                      << documentNames.size() << " documents)\n";
+            stats.count("documents", documentNames.size());
+        } else {
+            std::cerr << "Error: Cannot write index " << buildIndexPath << ".\n";
+        }
+
+        stats.endStage();
+    }
 
 
     /*
     -------------------------------------------------
-    Section : Similarity Computation
+    Section : Report Output
 
     Objective:
-        Compare documents for similarity.
+        Open the report before any pair is scored.
 
     Input:
-        TF-IDF vectors.
+        outputFile, threshold, flaggedOnly, reportFormat.
 
     Output:
-        similarity results list.
+        Streaming report sink.
 
     Side Effect:
-        None.
+        Creates the output file; terminates program if it cannot be
+        opened.
+
 
-    
     Approach:
-        Compute cosine similarity.
+        Vectors and names move into the checker, and the report
+        resolves names through the checker's list while pairs are
+        pushed into it.
 
         // call SimilarityChecker()
-        // call compareAll()
+        // call ReportWriter()
+        // call openSink()
     */
-    SimilarityChecker checker(tfidfVectors, documentNames);
-    std::vector<std::tuple<std::string, std::string, double>> results =
-        checker.compareAll();
+    // Normalization, opening the report and streaming pairs into it
+    // are measured together
+    stats.beginStage("compare_report");
+
+    // Vectors and names move into the checker; nothing is copied.
+    // With --dedup, only the first vector of every group is kept.
+    std::vector<SparseVector> vectors = extractor.takeTFIDFVectors();
+
+    if (deduplicate) {
+        std::vector<SparseVector> distinct;
+
+        for (size_t d = 0; d < vectors.size(); d++) {
+            if (representative[d] == static_cast<int>(distinct.size())) {
+                distinct.push_back(std::move(vectors[d]));
+            }
+        }
+
+        vectors = std::move(distinct);
+    }
+
+    SimilarityChecker checker(std::move(vectors), std::move(documentNames));
+    const std::vector<std::string>& names = checker.getDocumentNames();
+
+    ReportWriter writer(outputFile, threshold);
+    writer.setFlaggedOnly(flaggedOnly);
+    writer.setFormat(reportFormat);
+    writer.setMatchedSpans(useFingerprint);
+
+    std::unique_ptr<ResultSink> reportFile = writer.openSink(names);
+
+    if (!reportFile) {
+        return 1;
+    }
+
+    CountingSink report(*reportFile);
 
 
     /*
     -------------------------------------------------
-    Section : Report Generation
+    Section : Similarity Computation
 
     Objective:
-        Save results in CSV format.
+        Compare documents for similarity and report them.
 
     Input:
-        results list.
+        TF-IDF vectors.
 
     Output:
-        CSV file.
+        CSV report (all pairs, or pruned pairs).
 
     Side Effect:
         Writes to disk.
 
-   
+    
     Approach:
-        Create report writer and export CSV.
-
-        // call ReportWriter()
-        // call writeCSV()
+        Compute cosine similarity for all pairs with the blocked
+        sparse matrix product, the dense SIMD kernel (chosen
+        automatically for small, dense vocabularies), or pair by pair
+        with --engine pairwise, serially or on threadCount threads
+        (with --flagged-only, abandoning each pair once its score
+        bound falls below the threshold); all-pairs engines stream
+        every score into the report while computing, so results are
+        never held in memory.
+        With --dedup, score only one document of every group of exact
+        duplicates and expand the scores to the whole corpus.
+        With --cache, reuse the cached scores of documents whose
+        content is unchanged and rescore only pairs with a changed,
+        new or drifted document.
+        With --lsh, score only the candidate pairs proposed by the
+        MinHash/LSH stage; with --top-k or --prune, run the pruned
+        search instead and keep only qualifying pairs. With --query,
+        score only pairs involving a new document. With --fingerprint,
+        report the pairs found by joining the fingerprint index, with
+        their matched passages.
+
+        // call compareQueries()
+        // call compareAllExpanded()
+        // call ResultCache::load() / compareAll()
+        // call MinHashLSH::generateCandidates() / compareCandidates()
+        // call FingerprintIndex::build() / findMatches()
+        // call shouldUseDense()
+        // call compareAllBlocked() / compareAllDense()
+        // call compareAll() / compareAllParallel() / compareAllAbove()
+        // call findTopK() / compareAboveThreshold()
+        // call finish()
+        // call lastScoredPairs()
     */
-    ReportWriter writer(outputFile, threshold);
-    writer.writeCSV(results);
+    std::vector<SimilarityPair> prunedResults;
+    size_t scoredPairs = 0;
+    size_t reusedPairs = 0;
+
+    if (queryMode) {
+        std::cout << "Query documents: " << (names.size() - firstNewDocument)
+                  << " against " << firstNewDocument << " indexed\n";
 
-    return 0;
+        checker.compareQueries(firstNewDocument,
+                               pruneBelowThreshold ? threshold : -1.0, report);
+    }
+    else if (deduplicate) {
+        checker.compareAllExpanded(representative, threadCount, report);
+    }
+    else if (!cachePath.empty()) {
+        ResultCache cache(ResultCache::configurationHash(hashBits, stopWords->digest()));
+        cache.load(cachePath);
+
+        bool saved = cache.compareAll(checker, contentHashes,
+                                      hashBits > 0 ? nullptr : &dictionary,
+                                      hashBits > 0 ? &extractor.getColumnBuckets() : nullptr,
+                                      threshold, cacheTolerance, threadCount,
+                                      report, cachePath);
+
+        std::cout << "Result cache: " << cache.reusedDocumentCount() << " of "
+                  << names.size() << " documents reused\n";
+
+        if (!saved) {
+            std::cerr << "Error: Cannot write result cache " << cachePath << ".\n";
+        }
+
+        stats.count("cached_documents", cache.reusedDocumentCount());
+        stats.count("pairs_reused", cache.reusedPairCount());
+        scoredPairs = cache.scoredPairCount();
+        reusedPairs = cache.reusedPairCount();
+    }
+    else if (useLSH) {
+        MinHashLSH lsh(lshBands, lshRows, shingleSize);
+        const CandidateGenerator& generator = lsh;
+
+        std::vector<std::pair<int, int>> candidates =
+            generator.generateCandidates(processedDocuments);
+
+        std::cout << "Candidate pairs: " << candidates.size() << "\n";
+
+        stats.count("candidate_pairs", candidates.size());
+
+        // A flagged-only report drops the same pairs, so both bound the scoring
+        prunedResults = checker.compareCandidates(
+            candidates, (pruneBelowThreshold || flaggedOnly) ? threshold : -1.0);
+    }
+    else if (useFingerprint) {
+        FingerprintIndex fingerprints(kgramSize, winnowWindow);
+        fingerprints.build(processedDocuments, threadCount);
+
+        std::vector<FingerprintMatch> matches = fingerprints.findMatches();
+
+        std::cout << "Fingerprints: " << fingerprints.fingerprintCount()
+                  << ", matching pairs: " << matches.size() << "\n";
+
+        stats.count("fingerprints", fingerprints.fingerprintCount());
+        scoredPairs = matches.size();
+
+        for (const auto& match : matches) {
+            if (pruneBelowThreshold && match.score <= threshold) continue;
+
+            report.acceptMatch(match.doc1, match.doc2, match.score, match.spans);
+        }
+    }
+    else if (topK > 0) {
+        prunedResults = checker.findTopK(topK, pruneBelowThreshold ? threshold : 0.0);
+    }
+    else if (pruneBelowThreshold) {
+        prunedResults = checker.compareAboveThreshold(threshold);
+    }
+    else if (engine != "pairwise") {
+        if (engine == "auto") {
+            engine = SimilarityChecker::shouldUseDense(names.size(),
+                                                       extractor.getActiveTermCount(),
+                                                       extractor.getDensity())
+                         ? "dense" : "spgemm";
+        }
+
+        if (engine == "dense") {
+            std::cout << "Similarity engine: dense (" << denseKernelName() << ")\n";
+            checker.compareAllDense(threadCount, report);
+        } else {
+            checker.compareAllBlocked(threadCount, report);
+        }
+    }
+    else if (flaggedOnly) {
+        checker.compareAllAbove(threshold, threadCount, report);
+    }
+    else if (threadCount == 1) {
+        checker.compareAll(report);
+    }
+    else {
+        checker.compareAllParallel(threadCount, report);
+    }
+
+    // Pruned searches return their (small, sorted) result lists
+    for (const auto& pair : prunedResults) {
+        report.accept(pair.doc1, pair.doc2, pair.score);
+    }
+
+    report.finish();
+
+    // Pairs in scope: all pairs, or only those with a query document
+    size_t docTotal = names.size();
+    size_t queries = queryMode ? docTotal - firstNewDocument : docTotal;
+    size_t pairsInScope = queries * (docTotal - queries) + queries * (queries - (queries > 0)) / 2;
+
+    if (!useFingerprint && cachePath.empty()) {
+        scoredPairs = checker.lastScoredPairs();
+    }
+
+    stats.count("pairs_total", pairsInScope);
+    stats.count("pairs_scored", scoredPairs);
+    stats.count("pairs_pruned", pairsInScope - std::min(pairsInScope, scoredPairs + reusedPairs));
+    stats.count("pairs_reported", report.count());
+    stats.endStage();
+
+
+    /*
+    -------------------------------------------------
+    Section : Run Statistics
+
+    Objective:
+        Report where the run spent its time and memory.
+
+    Input:
+        stats collected by the sections above.
+
+    Output:
+        Summary table (--stats) and JSON file (--stats-json).
+
+    Side Effect:
+        Prints to stdout; writes the JSON file.
+
+    Approach:
+        Print and export the per-stage measurements.
+
+        // call printSummary()
+        // call writeJSON()
+    */
+    return reportStats();
 }
@@ -0,0 +1,87 @@
+#!/bin/sh
+#
+# ========================================================================
+#                     TEST : result cache reruns
+# ========================================================================
+#
+# Objective:
+#     A run with --cache must report what a run without it reports:
+#     byte for byte on a cold cache, on an unchanged rerun and with
+#     --cache-tolerance 0, and within the tolerance with the same
+#     Plagiarized flags while documents keep being added, so reused
+#     scores never drift further than the tolerance over many reruns.
+#
+# Input:
+#     $1 → plagiarism_checker binary (default ./plagiarism_checker)
+#     $2 → gen_corpus binary (default ./bench/gen_corpus)
+#
+# Output:
+#     Exit status 0 if every case passes, 1 otherwise.
+#
+# Side Effects:
+#     Writes corpora, caches and reports to a temporary directory,
+#     removed at exit.
+
+CHECKER=${1:-./plagiarism_checker}
+GENERATOR=${2:-./bench/gen_corpus}
+
+WORK=$(mktemp -d) || exit 1
+trap 'rm -rf "$WORK"' EXIT
+
+"$GENERATOR" "$WORK/pool" --docs 130 --length 80 --vocab 400 --seed 11 >/dev/null || exit 1
+
+mkdir "$WORK/corpus"
+ls "$WORK/pool" | head -100 | while read -r name; do
+    cp "$WORK/pool/$name" "$WORK/corpus/"
+done
+
+status=0
+
+# Report of the current corpus with and without the cache ($1 = tolerance)
+run() {
+    "$CHECKER" "$WORK/corpus" "$WORK/cached.csv" 0.5 --cache "$WORK/scores.cache" \
+        --cache-tolerance "$1" >/dev/null || exit 1
+    "$CHECKER" "$WORK/corpus" "$WORK/fresh.csv" 0.5 --engine spgemm >/dev/null || exit 1
+}
+
+# Byte-identical reports ($1 = case)
+same() {
+    if ! cmp -s "$WORK/fresh.csv" "$WORK/cached.csv"; then
+        echo "FAIL: $1 report differs from --engine spgemm"
+        status=1
+    fi
+}
+
+run 0.05
+same "cold cache"
+
+run 0.05
+same "unchanged rerun"
+
+# Two documents more per run: unchanged documents drift a little each
+# time, and reused scores are reused again by the next run
+for step in 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15; do
+    ls "$WORK/pool" | sed -n "$((99 + 2 * step)),$((100 + 2 * step))p" | while read -r name; do
+        cp "$WORK/pool/$name" "$WORK/corpus/"
+    done
+
+    run 0.05
+
+    # Percentages are rounded to 0.01, so allow that on top of 5 points
+    if ! paste -d, "$WORK/cached.csv" "$WORK/fresh.csv" | awk -F, '
+            NR > 1 {
+                gap = $2 - $5
+                if (gap < 0) gap = -gap
+                if (gap > 5.01 || $3 != $6) bad++
+            }
+            END { exit bad > 0 }'; then
+        echo "FAIL: run $step reused a score further than the tolerance or changed a flag"
+        status=1
+    fi
+done
+
+run 0
+same "--cache-tolerance 0"
+
+[ $status -eq 0 ] && echo "PASS: cached reruns match runs without the cache"
+exit $status
@@ -0,0 +1,104 @@
+#!/bin/sh
+#
+# ========================================================================
+#                     TEST : engine and mode agreement
+# ========================================================================
+#
+# Objective:
+#     Signed feature hashing makes some dot products negative. Every
+#     engine must apply the same [0, 1] score rule, so the pairwise,
+#     spgemm and dense engines have to write identical reports. The
+#     out-of-core mode must also match an in-memory spgemm run, with
+#     and without --hash-bits and in binary flagged-only form, and a
+#     distributed run must match a single-node run on the same index.
+#
+# Input:
+#     $1 → plagiarism_checker binary (default ./plagiarism_checker)
+#     $2 → gen_corpus binary (default ./bench/gen_corpus)
+#
+# Output:
+#     Exit status 0 if the reports match, 1 otherwise.
+#
+# Side Effects:
+#     Writes corpora, shards, an index and reports to a temporary
+#     directory, removed at exit. Listens on one local TCP port.
+
+CHECKER=${1:-./plagiarism_checker}
+GENERATOR=${2:-./bench/gen_corpus}
+
+WORK=$(mktemp -d) || exit 1
+trap 'rm -rf "$WORK"' EXIT
+
+"$GENERATOR" "$WORK/corpus" --docs 40 --length 200 --vocab 2000 --seed 7 >/dev/null || exit 1
+
+# 2^4 buckets: many collisions, so negative dot products are certain
+for engine in pairwise spgemm dense; do
+    "$CHECKER" "$WORK/corpus" "$WORK/$engine.csv" 0.5 --hash-bits 4 \
+        --engine "$engine" >/dev/null || exit 1
+done
+
+status=0
+
+for engine in spgemm dense; do
+    if ! cmp -s "$WORK/pairwise.csv" "$WORK/$engine.csv"; then
+        echo "FAIL: --engine $engine report differs from --engine pairwise"
+        status=1
+    fi
+done
+
+if grep -q -- ',-' "$WORK/pairwise.csv"; then
+    echo "FAIL: report has negative similarity percentages"
+    status=1
+fi
+
+# Out-of-core: large enough for several shards at the 16 MB minimum
+"$GENERATOR" "$WORK/large" --docs 1500 --length 400 --vocab 20000 --dup-rate 0.1 \
+    --seed 9 >/dev/null || exit 1
+mkdir "$WORK/shards"
+
+# Out-of-core report vs. in-memory spgemm report ($1 = case, rest = options)
+out_of_core() {
+    label=$1
+    shift
+    "$CHECKER" "$WORK/large" "$WORK/memory.out" 0.5 "$@" >/dev/null || exit 1
+    "$CHECKER" "$WORK/large" "$WORK/disk.out" 0.5 --max-memory 16 \
+        --shard-dir "$WORK/shards" "$@" >/dev/null || exit 1
+
+    if ! cmp -s "$WORK/memory.out" "$WORK/disk.out"; then
+        echo "FAIL: --max-memory $label report differs from --engine spgemm"
+        status=1
+    fi
+}
+
+out_of_core "csv" --engine spgemm
+out_of_core "--hash-bits" --engine spgemm --hash-bits 12
+out_of_core "binary flagged-only" --engine spgemm --format binary --flagged-only
+
+# Distributed: a coordinator and two workers on small tiles vs. one node
+"$GENERATOR" "$WORK/shared" --docs 300 --length 150 --vocab 3000 --dup-rate 0.2 \
+    --seed 5 >/dev/null || exit 1
+"$CHECKER" "$WORK/shared" "$WORK/build.csv" 0.5 --build-index "$WORK/shared.idx" >/dev/null || exit 1
+"$CHECKER" "$WORK/shared" "$WORK/single.csv" 0.5 --index "$WORK/shared.idx" \
+    --flagged-only >/dev/null || exit 1
+
+port=$((20000 + $$ % 20000))
+"$CHECKER" --index "$WORK/shared.idx" --coordinator "$port" "$WORK/distributed.csv" 0.5 \
+    --tile-docs 64 >/dev/null &
+coordinator=$!
+
+for _ in 1 2; do
+    "$CHECKER" --index "$WORK/shared.idx" --worker "127.0.0.1:$port" >/dev/null &
+done
+
+if ! wait $coordinator; then
+    echo "FAIL: coordinator run failed"
+    status=1
+elif ! cmp -s "$WORK/single.csv" "$WORK/distributed.csv"; then
+    echo "FAIL: distributed report differs from the single-node --flagged-only report"
+    status=1
+fi
+
+wait
+
+[ $status -eq 0 ] && echo "PASS: engines, out-of-core and distributed reports are identical"
+exit $status
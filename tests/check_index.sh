@@ -0,0 +1,74 @@
+#!/bin/sh
+#
+# ========================================================================
+#                     TEST : corpus index round trip and validation
+# ========================================================================
+#
+# Objective:
+#     A run on a saved corpus index must report exactly what a run on
+#     the folder reports, and an index whose document entries are out
+#     of term order must be refused instead of crashing the checker.
+#
+# Input:
+#     $1 → plagiarism_checker binary (default ./plagiarism_checker)
+#     $2 → gen_corpus binary (default ./bench/gen_corpus)
+#
+# Output:
+#     Exit status 0 if every case passes, 1 otherwise.
+#
+# Side Effects:
+#     Writes a corpus, indexes and reports to a temporary directory,
+#     removed at exit.
+
+CHECKER=${1:-./plagiarism_checker}
+GENERATOR=${2:-./bench/gen_corpus}
+
+WORK=$(mktemp -d) || exit 1
+trap 'rm -rf "$WORK"' EXIT
+
+"$GENERATOR" "$WORK/corpus" --docs 60 --length 150 --vocab 3000 --seed 3 >/dev/null || exit 1
+
+status=0
+
+# Round trip: folder run vs. run on the index built from it
+"$CHECKER" "$WORK/corpus" "$WORK/folder.csv" 0.3 >/dev/null || exit 1
+"$CHECKER" "$WORK/corpus" "$WORK/build.csv" 0.3 --build-index "$WORK/corpus.idx" >/dev/null || exit 1
+"$CHECKER" "$WORK/corpus" "$WORK/index.csv" 0.3 --index "$WORK/corpus.idx" >/dev/null || exit 1
+
+if ! cmp -s "$WORK/folder.csv" "$WORK/index.csv"; then
+    echo "FAIL: --index report differs from the folder report"
+    status=1
+fi
+
+# Read a little-endian uint64 header field at byte offset $2 of file $1
+field() {
+    od -An -t u8 -j "$2" -N 8 "$1" | tr -d ' '
+}
+
+# Write the uint32 $3 little-endian at byte offset $2 of file $1
+patch32() {
+    value=$3
+    bytes=""
+    for _ in 1 2 3 4; do
+        bytes="$bytes$(printf '\\%03o' $((value % 256)))"
+        value=$((value / 256))
+    done
+    printf "$bytes" | dd of="$1" bs=1 seek="$2" conv=notrunc 2>/dev/null
+}
+
+# Corruption: first entry of document 0 gets the largest term ID, so the
+# document's term IDs stay in range but are no longer increasing
+# (header: termCount at byte 24, entriesAt at byte 96)
+cp "$WORK/corpus.idx" "$WORK/bad.idx"
+patch32 "$WORK/bad.idx" "$(field "$WORK/bad.idx" 96)" $(($(field "$WORK/bad.idx" 24) - 1))
+
+"$CHECKER" "$WORK/corpus" "$WORK/bad.csv" 0.3 --index "$WORK/bad.idx" >/dev/null 2>&1
+rc=$?
+
+if [ $rc -ne 1 ]; then
+    echo "FAIL: unsorted index was not refused cleanly (exit status $rc)"
+    status=1
+fi
+
+[ $status -eq 0 ] && echo "PASS: index round trip matches and unsorted entries are refused"
+exit $status